@@ -26,6 +26,13 @@
 #include <string>
 #include <cmath>
 #include <array>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+
+namespace CppVerseHub::Concurrency {
+    class WorkStealingThreadPool;
+}
 
 namespace CppVerseHub::Algorithms {
 
@@ -77,6 +84,20 @@ namespace CppVerseHub::Algorithms {
               danger_level(danger), requires_special_clearance(clearance), route_type(type) {}
     };
 
+    /**
+     * @enum RouteType
+     * @brief Interned form of SpaceRoute::route_type
+     */
+    enum class RouteType : uint8_t {
+        DIRECT,
+        RELAY,
+        EMERGENCY,
+        OTHER  // any other route_type string
+    };
+
+    RouteType route_type_from_string(const std::string& type);
+    std::string route_type_to_string(RouteType type);
+
     /**
      * @struct PathResult
      * @brief Results from pathfinding algorithms
@@ -143,12 +164,120 @@ namespace CppVerseHub::Algorithms {
         size_t docking_capacity_;
     };
 
+    class SpaceGraph;
+
+    /**
+     * @class FrozenSpaceGraph
+     * @brief Immutable compressed sparse row (CSR) copy of a SpaceGraph's routes
+     * @details The routes leaving station s are the route indices
+     * [route_begin(s), route_end(s)), in the order they were added. Targets,
+     * each cost and the station positions live in separate contiguous arrays,
+     * so a search only pulls the fields it reads through the cache.
+     *
+     * The routes arriving at station s are [incoming_begin(s), incoming_end(s)):
+     * incoming_route(i) is the route and incoming_source(i) the station it
+     * leaves. A directed graph keeps a second, reversed index for these; an
+     * undirected graph stores every route in both directions, so they are the
+     * twins of the routes leaving s and cost the same.
+     *
+     * The layout also records which stations were damaged and how far into
+     * the graph's change journal it was built, so DynamicShortestPaths can
+     * catch up with later changes.
+     */
+    class FrozenSpaceGraph {
+    public:
+        static constexpr size_t npos = SIZE_MAX;
+
+        explicit FrozenSpaceGraph(const SpaceGraph& graph);
+
+        size_t station_count() const { return route_offsets_.size() - 1; }
+        size_t route_count() const { return targets_.size(); }
+        bool directed() const { return directed_; }
+
+        size_t route_begin(size_t station) const { return route_offsets_[station]; }
+        size_t route_end(size_t station) const { return route_offsets_[station + 1]; }
+
+        size_t target(size_t route) const { return targets_[route]; }
+        double fuel_cost(size_t route) const { return fuel_costs_[route]; }
+        double time_cost(size_t route) const { return time_costs_[route]; }
+        double danger_level(size_t route) const { return danger_levels_[route]; }
+        bool requires_clearance(size_t route) const { return requires_clearance_[route] != 0; }
+        RouteType route_type(size_t route) const { return route_types_[route]; }
+
+        size_t incoming_begin(size_t station) const {
+            return directed_ ? incoming_offsets_[station] : route_offsets_[station];
+        }
+        size_t incoming_end(size_t station) const {
+            return directed_ ? incoming_offsets_[station + 1] : route_offsets_[station + 1];
+        }
+        size_t incoming_route(size_t index) const { return directed_ ? incoming_routes_[index] : index; }
+        size_t incoming_source(size_t index) const { return directed_ ? incoming_sources_[index] : targets_[index]; }
+
+        // First route added from -> to, or npos
+        size_t find_route(size_t from, size_t to) const;
+
+        SpaceCoordinate position(size_t station) const { return {xs_[station], ys_[station], zs_[station]}; }
+
+        bool station_damaged(size_t station) const { return damaged_[station] != 0; }
+        // SpaceGraph::revision() and generation() this layout reflects
+        size_t revision() const { return revision_; }
+        size_t generation() const { return generation_; }
+
+    private:
+        std::vector<size_t> route_offsets_;  // station_count() + 1 entries
+        std::vector<uint32_t> targets_;
+        std::vector<double> fuel_costs_;
+        std::vector<double> time_costs_;
+        std::vector<double> danger_levels_;
+        std::vector<uint8_t> requires_clearance_;
+        std::vector<RouteType> route_types_;
+        std::vector<double> xs_, ys_, zs_;
+        std::vector<uint8_t> damaged_;
+        size_t revision_;
+        size_t generation_;
+
+        // Reversed index, directed graphs only
+        bool directed_;
+        std::vector<size_t> incoming_offsets_;
+        std::vector<size_t> incoming_routes_;
+        std::vector<uint32_t> incoming_sources_;
+    };
+
     /**
      * @class SpaceGraph
      * @brief Graph representation of space routes and stations
+     * @details freeze() builds a FrozenSpaceGraph that pathfinders and other
+     * readers share. Adding stations or routes afterwards discards it; readers
+     * holding the old layout keep searching that snapshot.
+     *
+     * Every station, route and damage report is also appended to changes(),
+     * which DynamicShortestPaths::sync replays instead of rebuilding. The
+     * journal only keeps recent history, a quarter to a half of the network's
+     * size: a reader further behind would replay more than a rebuild costs,
+     * so it rebuilds instead.
      */
     class SpaceGraph {
     public:
+        /**
+         * @struct NetworkChange
+         * @brief One entry of the change journal
+         */
+        struct NetworkChange {
+            enum class Kind {
+                STATION_ADDED,
+                ROUTE_ADDED,
+                STATION_DAMAGED,
+                STATION_REPAIRED
+            };
+
+            Kind kind;
+            size_t from;  // The station, for station changes
+            size_t to;
+            double fuel_cost;
+            double time_cost;
+            double danger_level;
+        };
+
         explicit SpaceGraph(bool directed = false);
         
         // Station management
@@ -161,9 +290,31 @@ namespace CppVerseHub::Algorithms {
         
         // Getters
         size_t station_count() const { return stations_.size(); }
+        bool is_directed() const { return directed_; }
         const SpaceStation& get_station(size_t id) const;
         const std::vector<SpaceRoute>& get_routes_from(size_t station_id) const;
         
+        // A damaged station keeps its routes; evacuation routes avoid it.
+        // Station ids out of range are ignored
+        void set_station_damaged(size_t station, bool damaged = true);
+        bool is_station_damaged(size_t station) const;
+        // Sorted station ids
+        const std::vector<size_t>& damaged_stations() const { return damaged_stations_; }
+        
+        // Change journal, oldest first: changes()[i] is revision
+        // first_revision() + i. Regenerating the network clears it and starts
+        // a new generation
+        const std::vector<NetworkChange>& changes() const { return changes_; }
+        size_t first_revision() const { return first_revision_; }
+        size_t revision() const { return first_revision_ + changes_.size(); }
+        size_t generation() const { return generation_; }
+        
+        // CSR layout
+        void freeze();
+        bool is_frozen() const { return frozen_ != nullptr; }
+        // The layout built by freeze(), or a new unshared one if the graph isn't frozen
+        std::shared_ptr<const FrozenSpaceGraph> frozen() const;
+        
         // Graph operations
         void generate_complete_routes(double max_distance = 1000.0);
         void generate_realistic_space_network();
@@ -177,13 +328,128 @@ namespace CppVerseHub::Algorithms {
         std::vector<SpaceStation> stations_;
         std::vector<std::vector<SpaceRoute>> adjacency_list_;
         bool directed_;
+        std::shared_ptr<const FrozenSpaceGraph> frozen_;
+        std::vector<size_t> damaged_stations_;
+        std::vector<NetworkChange> changes_;
+        size_t first_revision_ = 0;
+        size_t generation_ = 0;
+        size_t route_count_ = 0;
         static std::vector<SpaceRoute> empty_routes_;
         
+        // Appends to the journal, dropping the oldest entries past its bound
+        void record_change(const NetworkChange& change);
+        
         double calculate_realistic_fuel_cost(const SpaceCoordinate& from, const SpaceCoordinate& to) const;
         double calculate_travel_time(const SpaceCoordinate& from, const SpaceCoordinate& to, 
                                    const std::string& route_type = "direct") const;
     };
 
+    /**
+     * @class IndexedDaryHeap
+     * @brief Min-heap of station ids keyed by cost, with decrease-key
+     * @details Each station is queued at most once: pushing a queued station
+     * lowers its key in place instead of adding a stale duplicate. Four
+     * children per node make the heap half as deep as a binary one, and a
+     * sift-down compares siblings that sit next to each other in memory.
+     */
+    class IndexedDaryHeap {
+    public:
+        static constexpr size_t Arity = 4;
+
+        struct Entry {
+            double key;
+            uint32_t station;
+        };
+
+        // Empties the heap and makes room for station ids below stations;
+        // costs the number of entries left queued, not the station count
+        void reset(size_t stations);
+
+        bool empty() const { return entries_.empty(); }
+        size_t size() const { return entries_.size(); }
+        bool contains(size_t station) const { return position_[station] != NotQueued; }
+        const Entry& top() const { return entries_.front(); }
+
+        // Queues station, or lowers its key if it is queued with a higher one
+        void push(size_t station, double key);
+        Entry pop();
+
+    private:
+        static constexpr uint32_t NotQueued = std::numeric_limits<uint32_t>::max();
+
+        std::vector<Entry> entries_;
+        std::vector<uint32_t> position_;  // Index in entries_, or NotQueued
+
+        void sift_up(size_t index);
+        void sift_down(size_t index);
+    };
+
+    /**
+     * @class SearchWorkspace
+     * @brief Reusable state for one shortest-path search
+     * @details Distances and parents are dense arrays indexed by station id.
+     * Entries only count when their stamp belongs to the current search, so
+     * start() never clears them and costs nothing however large the graph is.
+     * Stations are settled in the order the queue hands them out; a settled
+     * station is final and relax() leaves it alone.
+     *
+     * for_thread() returns workspaces owned by the calling thread, which is how
+     * SpacePathfinder and ContractionHierarchy queries avoid allocating. A
+     * search must be done with its workspace before another search on the
+     * same thread starts with the same slot.
+     */
+    class SearchWorkspace {
+    public:
+        static constexpr size_t npos = SIZE_MAX;
+        static constexpr size_t ThreadSlots = 2;
+
+        static SearchWorkspace& for_thread(size_t slot = 0);
+
+        SearchWorkspace() = default;
+        // Counts searches from first_generation instead of zero, so the stamp
+        // wraparound in start() can be reached without billions of searches
+        explicit SearchWorkspace(uint32_t first_generation)
+            : generation_(std::min(first_generation, std::numeric_limits<uint32_t>::max() - 1) & ~1u) {}
+
+        // Forgets the previous search and sizes the arrays for stations
+        void start(size_t stations);
+
+        bool reached(size_t station) const { return stamp_[station] >= generation_; }
+        bool settled(size_t station) const { return stamp_[station] == generation_ + 1; }
+        double distance(size_t station) const {
+            return reached(station) ? distance_[station] : std::numeric_limits<double>::infinity();
+        }
+        size_t parent(size_t station) const {
+            return reached(station) && parent_[station] != NoParent ? parent_[station] : npos;
+        }
+
+        // Records distance and parent if they improve on an unsettled
+        // station, queueing it under key; returns whether they did
+        bool relax(size_t station, double distance, size_t parent, double key);
+        bool relax(size_t station, double distance, size_t parent) { return relax(station, distance, parent, distance); }
+
+        // Settles and returns the queued station with the smallest key
+        size_t settle_next();
+
+        const IndexedDaryHeap& queue() const { return queue_; }
+
+        // Stations from the search root to station along parents; empty if
+        // station was not reached
+        std::vector<size_t> path_to(size_t station) const;
+
+    private:
+        static constexpr uint32_t NoParent = std::numeric_limits<uint32_t>::max();
+
+        std::vector<double> distance_;
+        std::vector<uint32_t> parent_;
+        // generation_ while reached, generation_ + 1 once settled
+        std::vector<uint32_t> stamp_;
+        uint32_t generation_ = 0;
+        IndexedDaryHeap queue_;
+    };
+
+    class ContractionHierarchy;
+
     /**
      * @class SpacePathfinder
      * @brief Advanced pathfinding algorithms for space navigation
@@ -198,7 +464,10 @@ namespace CppVerseHub::Algorithms {
             MINIMUM_HOPS
         };
 
-        explicit SpacePathfinder(const SpaceGraph& graph) : graph_(graph) {}
+        // Searches graph.frozen(): the shared layout if the graph is frozen,
+        // otherwise a snapshot taken here
+        explicit SpacePathfinder(const SpaceGraph& graph);
+        ~SpacePathfinder();
         
         // Core pathfinding algorithms
         PathResult dijkstra_shortest_path(size_t start, size_t destination, OptimizationGoal goal = OptimizationGoal::BALANCED);
@@ -216,6 +485,11 @@ namespace CppVerseHub::Algorithms {
         
         PathResult find_safest_path(size_t start, size_t destination, double max_danger_threshold = 0.3);
         
+        // Fastest route that avoids the damaged stations and those damaged on
+        // the graph. Unlike the other searches this follows the live graph:
+        // each destination keeps a DynamicShortestPaths tree that is synced
+        // with new routes and damage, then repaired for the damaged list
+        // rather than searched again
         PathResult find_emergency_evacuation_path(size_t start, size_t destination, 
                                                  const std::vector<size_t>& damaged_stations = {});
         
@@ -228,8 +502,39 @@ namespace CppVerseHub::Algorithms {
         PathResult multi_destination_optimal_route(size_t start, const std::vector<size_t>& destinations,
                                                   bool return_to_start = true);
 
+        // One search from start, stopped once every target is settled; one
+        // PathResult per target, in the order given
+        std::vector<PathResult> one_to_many(size_t start, const std::vector<size_t>& targets,
+                                            OptimizationGoal goal = OptimizationGoal::BALANCED);
+
+        // table[i][j] is the cost from sources[i] to targets[j], or infinity
+        // if unreachable; one one-to-many search per source across a pool
+        std::vector<std::vector<double>> distance_table(const std::vector<size_t>& sources,
+                                                        const std::vector<size_t>& targets,
+                                                        OptimizationGoal goal = OptimizationGoal::BALANCED,
+                                                        size_t num_threads = std::thread::hardware_concurrency());
+        std::vector<std::vector<double>> distance_table(const std::vector<size_t>& sources,
+                                                        const std::vector<size_t>& targets,
+                                                        OptimizationGoal goal,
+                                                        Concurrency::WorkStealingThreadPool& pool);
+
+        // Answers dijkstra_shortest_path for hierarchy->goal() from a prebuilt
+        // index; it must have been built from a graph with the same stations
+        void use_contraction_hierarchy(std::shared_ptr<const ContractionHierarchy> hierarchy);
+
+        // Cost of one route under goal
+        static double route_cost(double fuel_cost, double time_cost, double danger_level, OptimizationGoal goal);
+
     private:
+        static constexpr size_t GoalCount = 5;
+
+        struct EvacuationTree;
+
         const SpaceGraph& graph_;
+        std::shared_ptr<const FrozenSpaceGraph> routes_;
+        std::array<std::shared_ptr<const ContractionHierarchy>, GoalCount> hierarchies_;
+        std::mutex evacuation_mutex_;
+        std::unordered_map<size_t, std::unique_ptr<EvacuationTree>> evacuation_trees_;  // By destination
         
         // Heuristic functions for A*
         double euclidean_heuristic(size_t current, size_t destination) const;
@@ -239,10 +544,16 @@ namespace CppVerseHub::Algorithms {
         
         // Cost calculation functions
         double calculate_route_cost(const SpaceRoute& route, OptimizationGoal goal) const;
+        double calculate_route_cost(size_t route, OptimizationGoal goal) const;
         double calculate_path_cost(const std::vector<size_t>& path, OptimizationGoal goal) const;
         
+        // Settles stations from start until every valid target is settled or
+        // nothing is left to settle; returns how many were settled
+        size_t search_targets(SearchWorkspace& search, size_t start, const std::vector<size_t>& targets,
+                              OptimizationGoal goal) const;
+        
         // Utility functions
-        std::vector<size_t> reconstruct_path(const std::unordered_map<size_t, size_t>& parent,
+        std::vector<size_t> reconstruct_path(const SearchWorkspace& search,
                                            size_t start, size_t destination) const;
         
         PathResult create_path_result(const std::string& algorithm_name, const std::vector<size_t>& path,
@@ -250,6 +561,164 @@ namespace CppVerseHub::Algorithms {
                                     size_t nodes_explored = 0) const;
     };
 
+    /**
+     * @class ContractionHierarchy
+     * @brief Contraction-hierarchy index for repeated point-to-point queries
+     * @details Built offline for one OptimizationGoal: stations are contracted
+     * in order of importance, adding shortcut routes that preserve shortest
+     * distances, and queries then run a bidirectional Dijkstra that only
+     * climbs the hierarchy, settling a few hundred stations instead of the
+     * whole network. The index can be saved and loaded (native byte order)
+     * so it is not rebuilt at every start-up; rebuild it when routes change.
+     */
+    class ContractionHierarchy {
+    public:
+        struct QueryResult {
+            double cost;                // infinity if unreachable
+            std::vector<size_t> path;   // stations start..destination, empty if unreachable or not unpacked
+            size_t nodes_settled;
+        };
+
+        ContractionHierarchy(const FrozenSpaceGraph& routes, SpacePathfinder::OptimizationGoal goal);
+        ContractionHierarchy(const SpaceGraph& graph, SpacePathfinder::OptimizationGoal goal)
+            : ContractionHierarchy(*graph.frozen(), goal) {}
+
+        // Thread-safe; each thread reuses its own search workspace
+        QueryResult query(size_t start, size_t destination, bool unpack_path = true) const;
+        double distance(size_t start, size_t destination) const { return query(start, destination, false).cost; }
+
+        SpacePathfinder::OptimizationGoal goal() const { return goal_; }
+        size_t station_count() const { return upward_offsets_.size() - 1; }
+        size_t arc_count() const { return upward_arcs_.size() + downward_arcs_.size(); }
+
+        void save(const std::string& filename) const;
+        static ContractionHierarchy load(const std::string& filename);
+
+    private:
+        struct Arc {
+            uint32_t node;
+            uint32_t middle;  // contracted station a shortcut bypasses, or NoMiddle
+            double cost;
+        };
+
+        static constexpr uint32_t NoMiddle = std::numeric_limits<uint32_t>::max();
+
+        SpacePathfinder::OptimizationGoal goal_;
+        // upward_arcs_[upward_offsets_[s]..]: s -> node, node ranked above s
+        std::vector<uint64_t> upward_offsets_;
+        std::vector<Arc> upward_arcs_;
+        // downward_arcs_[downward_offsets_[s]..]: node -> s, node ranked above s
+        std::vector<uint64_t> downward_offsets_;
+        std::vector<Arc> downward_arcs_;
+
+        ContractionHierarchy() = default;
+
+        const Arc* find_arc(const std::vector<uint64_t>& offsets, const std::vector<Arc>& arcs,
+                            uint32_t station, uint32_t node) const;
+        void append_unpacked(uint32_t from, uint32_t to, uint32_t middle, std::vector<size_t>& path) const;
+    };
+
+    /**
+     * @class DynamicShortestPaths
+     * @brief Shortest-path tree from or to one station, repaired in place as
+     * routes and stations change
+     * @details FROM_ROOT keeps the best route from root to every station;
+     * TO_ROOT keeps every station's best route to root, such as an evacuation
+     * point. The tree keeps its own copy of the routes, one per ordered pair
+     * of stations (the cheapest of any parallel routes); route changes on an
+     * undirected graph apply in both directions, as SpaceGraph::add_route does.
+     *
+     * Cheaper or new routes propagate improvements Dijkstra-style from the
+     * route's far end. Dearer or removed tree routes, and disabled stations,
+     * reset only the subtree hanging below them, then settle it again from
+     * its unaffected neighbours. Either way an update touches the stations
+     * whose routes actually change, not the whole network.
+     *
+     * sync() applies the SpaceGraph changes made since the tree's layout was
+     * frozen: new stations and routes, and damaged stations, which are
+     * disabled. A route only counts there if it is cheaper than any parallel
+     * one the tree already keeps.
+     */
+    class DynamicShortestPaths {
+    public:
+        enum class Direction {
+            FROM_ROOT,
+            TO_ROOT
+        };
+
+        DynamicShortestPaths(const FrozenSpaceGraph& routes, size_t root, SpacePathfinder::OptimizationGoal goal,
+                             Direction direction = Direction::FROM_ROOT);
+        // Built from graph.frozen(), then synced with any damage reported since
+        DynamicShortestPaths(const SpaceGraph& graph, size_t root, SpacePathfinder::OptimizationGoal goal,
+                             Direction direction = Direction::FROM_ROOT);
+
+        // Catches up with graph, which must be the graph the tree was built
+        // from; a regenerated network, or one whose journal no longer reaches
+        // back to the tree's revision, is rebuilt from scratch
+        void sync(const SpaceGraph& graph);
+
+        // Appends an unreachable station with no routes
+        void add_station();
+        // Route changes; station ids out of range are ignored. add_route keeps
+        // the cheaper of the new and any existing route, as parallel routes do
+        void add_route(size_t from, size_t to, double fuel_cost, double time_cost, double danger_level = 0.0);
+        void set_route(size_t from, size_t to, double fuel_cost, double time_cost, double danger_level = 0.0);
+        void remove_route(size_t from, size_t to);
+        // A disabled station keeps its routes but no path may use it
+        void disable_station(size_t station);
+        void restore_station(size_t station);
+
+        bool reachable(size_t station) const;
+        // Cost between station and root, infinity if unreachable
+        double distance(size_t station) const;
+        // Stations in travel order: root..station for FROM_ROOT, station..root
+        // for TO_ROOT; empty if unreachable
+        std::vector<size_t> path(size_t station) const;
+
+        size_t root() const { return root_; }
+        size_t station_count() const { return distance_.size(); }
+        bool station_disabled(size_t station) const { return station < station_count() && disabled_[station] != 0; }
+        // Stations settled by the most recent change, or by all those sync() applied
+        size_t last_update_work() const { return last_update_work_; }
+
+    private:
+        struct Arc {
+            uint32_t node;
+            double cost;
+        };
+
+        static constexpr uint32_t NoParent = std::numeric_limits<uint32_t>::max();
+
+        SpacePathfinder::OptimizationGoal goal_;
+        Direction direction_;
+        bool directed_;
+        size_t root_;
+        // Arcs in search direction: out_[v] leads away from root, in_[v]
+        // towards it; for TO_ROOT these are the routes reversed
+        std::vector<std::vector<Arc>> out_;
+        std::vector<std::vector<Arc>> in_;
+        std::vector<double> distance_;
+        std::vector<uint32_t> parent_;
+        std::vector<uint8_t> disabled_;
+        std::vector<uint32_t> mark_;  // Stamped with mark_generation_ while affected
+        uint32_t mark_generation_ = 0;
+        IndexedDaryHeap queue_;
+        size_t last_update_work_ = 0;
+        size_t revision_;  // Graph changes applied so far
+        size_t generation_;
+
+        // Applies the graph changes past revision_; the tree must be of the
+        // graph's generation and not ahead of it
+        void replay(const SpaceGraph& graph);
+        void set_arc(size_t tail, size_t head, double cost);
+        void remove_arc(size_t tail, size_t head);
+        // Offers head a path through tail, then propagates any improvement
+        void improve(size_t tail, size_t head);
+        void propagate();
+        // Resets the subtrees below roots and settles them again
+        void repair(const std::vector<size_t>& roots);
+    };
+
     /**
      * @class FlowNetwork
      * @brief Maximum flow algorithms for space traffic management
@@ -297,9 +766,21 @@ namespace CppVerseHub::Algorithms {
     public:
         explicit SpaceNetworkAnalysis(const SpaceGraph& graph) : graph_(graph) {}
         
-        // Centrality measures
-        std::vector<double> calculate_betweenness_centrality();
-        std::vector<double> calculate_closeness_centrality();
+        // Centrality measures. Betweenness (Brandes' algorithm, normalized to
+        // [0, 1]) and closeness run one single-source search per station
+        // across a thread pool, each worker accumulating into its own arrays.
+        // Routes are weighted by goal; MINIMUM_HOPS counts routes.
+        std::vector<double> calculate_betweenness_centrality(
+            SpacePathfinder::OptimizationGoal goal = SpacePathfinder::OptimizationGoal::MINIMUM_HOPS,
+            size_t num_threads = std::thread::hardware_concurrency());
+        std::vector<double> calculate_betweenness_centrality(SpacePathfinder::OptimizationGoal goal,
+                                                             Concurrency::WorkStealingThreadPool& pool);
+        // Wasserman-Faust closeness over the stations each one can reach
+        std::vector<double> calculate_closeness_centrality(
+            SpacePathfinder::OptimizationGoal goal = SpacePathfinder::OptimizationGoal::MINIMUM_HOPS,
+            size_t num_threads = std::thread::hardware_concurrency());
+        std::vector<double> calculate_closeness_centrality(SpacePathfinder::OptimizationGoal goal,
+                                                           Concurrency::WorkStealingThreadPool& pool);
         std::vector<double> calculate_degree_centrality();
         
         // Network properties
@@ -437,6 +918,12 @@ namespace CppVerseHub::Algorithms {
         
         SimulationStats get_simulation_statistics() const;
 
+    private:
+        const SpaceGraph& graph_;
+        SimulationParameters params_;
+        std::vector<ShipStatus> ships_;
+    };
+
     /**
      * @class GraphAlgorithmsDemo
      * @brief Main demonstration coordinator for graph algorithms
@@ -5,6 +5,7 @@
  */
 
 #include "SortingAlgorithms.hpp"
+#include "concurrency/ThreadPool.hpp"
 #include <climits>
 #include <cmath>
 #include <sstream>
@@ -707,6 +708,150 @@ namespace CppVerseHub::Algorithms {
         }
     }
 
+    // ========== ParallelSort Implementation ==========
+
+    template<typename T, typename Compare>
+    SortingResult ParallelSort<T, Compare>::parallel_quicksort(std::vector<T>& arr, Compare comp, size_t num_threads) {
+        Concurrency::WorkStealingThreadPool pool(std::max<size_t>(1, num_threads));
+        return parallel_quicksort(arr, pool, comp);
+    }
+
+    template<typename T, typename Compare>
+    SortingResult ParallelSort<T, Compare>::parallel_mergesort(std::vector<T>& arr, Compare comp, size_t num_threads) {
+        Concurrency::WorkStealingThreadPool pool(std::max<size_t>(1, num_threads));
+        return parallel_mergesort(arr, pool, comp);
+    }
+
+    template<typename T, typename Compare>
+    SortingResult ParallelSort<T, Compare>::parallel_quicksort(std::vector<T>& arr, 
+                                                             Concurrency::WorkStealingThreadPool& pool, 
+                                                             Compare comp) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        
+        if (arr.size() > 1) {
+            parallel_quicksort_impl(arr, 0, static_cast<int>(arr.size() - 1), comp, 0, 
+                                    max_depth_for(pool.thread_count()), pool);
+        }
+        
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+        
+        return {
+            "Parallel QuickSort",
+            duration,
+            0,  // Comparisons are not tracked across tasks
+            0,
+            arr.size(),
+            false,
+            "O(n log n) average, O(n²) worst",
+            "O(log n)"
+        };
+    }
+
+    template<typename T, typename Compare>
+    SortingResult ParallelSort<T, Compare>::parallel_mergesort(std::vector<T>& arr, 
+                                                             Concurrency::WorkStealingThreadPool& pool, 
+                                                             Compare comp) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        
+        if (arr.size() > 1) {
+            std::vector<T> temp(arr.size());
+            parallel_mergesort_impl(arr, temp, 0, static_cast<int>(arr.size() - 1), comp, 0, 
+                                    max_depth_for(pool.thread_count()), pool);
+        }
+        
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+        
+        return {
+            "Parallel MergeSort",
+            duration,
+            0,
+            0,
+            arr.size(),
+            true,
+            "O(n log n)",
+            "O(n)"
+        };
+    }
+
+    template<typename T, typename Compare>
+    void ParallelSort<T, Compare>::parallel_quicksort_impl(std::vector<T>& arr, int low, int high, 
+                                                          Compare& comp, size_t depth, size_t max_depth,
+                                                          Concurrency::WorkStealingThreadPool& pool) {
+        auto first = arr.begin() + low;
+        auto last = arr.begin() + high + 1;
+        
+        if (static_cast<size_t>(high - low + 1) <= parallel_cutoff || depth >= max_depth) {
+            std::sort(first, last, comp);
+            return;
+        }
+        
+        // Median-of-three pivot, then three-way partition so runs of equal keys are not revisited
+        const T& a = arr[low];
+        const T& b = arr[low + (high - low) / 2];
+        const T& c = arr[high];
+        T pivot = comp(a, b) ? (comp(b, c) ? b : (comp(a, c) ? c : a))
+                             : (comp(a, c) ? a : (comp(b, c) ? c : b));
+        
+        auto less_end = std::partition(first, last, [&](const T& x) { return comp(x, pivot); });
+        auto equal_end = std::partition(less_end, last, [&](const T& x) { return !comp(pivot, x); });
+        
+        int left_high = static_cast<int>(less_end - arr.begin()) - 1;
+        int right_low = static_cast<int>(equal_end - arr.begin());
+        
+        pool.parallel_invoke(
+            [&arr, low, left_high, &comp, depth, max_depth, &pool]() {
+                if (low < left_high) {
+                    parallel_quicksort_impl(arr, low, left_high, comp, depth + 1, max_depth, pool);
+                }
+            },
+            [&arr, right_low, high, &comp, depth, max_depth, &pool]() {
+                if (right_low < high) {
+                    parallel_quicksort_impl(arr, right_low, high, comp, depth + 1, max_depth, pool);
+                }
+            }
+        );
+    }
+
+    template<typename T, typename Compare>
+    void ParallelSort<T, Compare>::parallel_mergesort_impl(std::vector<T>& arr, std::vector<T>& temp,
+                                                          int left, int right, Compare& comp, 
+                                                          size_t depth, size_t max_depth,
+                                                          Concurrency::WorkStealingThreadPool& pool) {
+        if (static_cast<size_t>(right - left + 1) <= parallel_cutoff || depth >= max_depth) {
+            std::stable_sort(arr.begin() + left, arr.begin() + right + 1, comp);
+            return;
+        }
+        
+        int mid = left + (right - left) / 2;
+        
+        // Halves touch disjoint ranges of arr and temp, so they can run concurrently
+        pool.parallel_invoke(
+            [&arr, &temp, left, mid, &comp, depth, max_depth, &pool]() {
+                parallel_mergesort_impl(arr, temp, left, mid, comp, depth + 1, max_depth, pool);
+            },
+            [&arr, &temp, mid, right, &comp, depth, max_depth, &pool]() {
+                parallel_mergesort_impl(arr, temp, mid + 1, right, comp, depth + 1, max_depth, pool);
+            }
+        );
+        
+        std::merge(std::make_move_iterator(arr.begin() + left), std::make_move_iterator(arr.begin() + mid + 1),
+                   std::make_move_iterator(arr.begin() + mid + 1), std::make_move_iterator(arr.begin() + right + 1),
+                   temp.begin() + left, comp);
+        std::move(temp.begin() + left, temp.begin() + right + 1, arr.begin() + left);
+    }
+
+    template<typename T, typename Compare>
+    size_t ParallelSort<T, Compare>::max_depth_for(size_t num_threads) {
+        // Enough levels for several tasks per worker so stealing can balance uneven splits
+        size_t depth = 0;
+        while ((size_t{1} << depth) < num_threads) {
+            ++depth;
+        }
+        return depth + 4;
+    }
+
     // Explicit template instantiations for common types
     template class QuickSort<int>;
     template class MergeSort<int>;
@@ -714,5 +859,6 @@ namespace CppVerseHub::Algorithms {
     template class InsertionSort<int>;
     template class SelectionSort<int>;
     template class BubbleSort<int>;
+    template class ParallelSort<int>;
 
 } // namespace CppVerseHub::Algorithms
\ No newline at end of file
@@ -23,6 +23,10 @@
 #include <future>
 #include <iomanip>
 
+namespace CppVerseHub::Concurrency {
+    class WorkStealingThreadPool;
+}
+
 namespace CppVerseHub::Algorithms {
 
     /**
@@ -380,26 +384,43 @@ namespace CppVerseHub::Algorithms {
     /**
      * @class ParallelSort
      * @brief Parallel implementations of sorting algorithms
+     *
+     * Quicksort and mergesort recurse with WorkStealingThreadPool::parallel_invoke,
+     * so every level of the recursion runs as fork-join tasks on one pool instead
+     * of spawning threads. Ranges below parallel_cutoff are sorted sequentially.
      */
     template<typename T, typename Compare = std::less<T>>
     class ParallelSort {
     public:
+        static constexpr size_t parallel_cutoff = 4096;
+
         static SortingResult parallel_quicksort(std::vector<T>& arr, Compare comp = Compare{}, 
                                                size_t num_threads = std::thread::hardware_concurrency());
         
         static SortingResult parallel_mergesort(std::vector<T>& arr, Compare comp = Compare{}, 
                                                size_t num_threads = std::thread::hardware_concurrency());
+
+        // Variants that reuse an existing pool instead of creating one per call
+        static SortingResult parallel_quicksort(std::vector<T>& arr, Concurrency::WorkStealingThreadPool& pool,
+                                               Compare comp = Compare{});
+
+        static SortingResult parallel_mergesort(std::vector<T>& arr, Concurrency::WorkStealingThreadPool& pool,
+                                               Compare comp = Compare{});
         
         static SortingResult parallel_radix_sort(std::vector<int>& arr, 
                                                 size_t num_threads = std::thread::hardware_concurrency());
 
     private:
         static void parallel_quicksort_impl(std::vector<T>& arr, int low, int high, 
-                                          Compare& comp, size_t depth, size_t max_depth);
+                                          Compare& comp, size_t depth, size_t max_depth,
+                                          Concurrency::WorkStealingThreadPool& pool);
         
         static void parallel_mergesort_impl(std::vector<T>& arr, std::vector<T>& temp,
                                           int left, int right, Compare& comp, 
-                                          size_t depth, size_t max_depth);
+                                          size_t depth, size_t max_depth,
+                                          Concurrency::WorkStealingThreadPool& pool);
+
+        static size_t max_depth_for(size_t num_threads);
     };
 
     /**
@@ -11,6 +11,191 @@
 
 namespace CppVerseHub::Concurrency {
 
+    // TaskBlockCache Implementation
+    namespace detail {
+
+        namespace {
+
+            struct FreeBlock {
+                FreeBlock* next;
+            };
+
+            struct ThreadBlockCache {
+                FreeBlock* heads[TaskBlockCache::size_classes] = {};
+                size_t counts[TaskBlockCache::size_classes] = {};
+
+                ~ThreadBlockCache();
+            };
+
+            /**
+             * Shared exchange for whole batches of free blocks. A thread whose cache
+             * for a size class is full hands half of it here, and a thread whose cache
+             * is empty takes a batch back, so blocks freed by workers flow back to the
+             * threads that submit tasks without those threads touching malloc.
+             */
+            struct BlockDepot {
+                struct Batch {
+                    FreeBlock* head;
+                    size_t count;
+                };
+
+                std::mutex mutex;
+                std::vector<Batch> batches[TaskBlockCache::size_classes];
+            };
+
+            // Never destroyed: threads may still return blocks during static teardown
+            BlockDepot& block_depot() {
+                static BlockDepot* depot = new BlockDepot();
+                return *depot;
+            }
+
+            void delete_chain(FreeBlock* head) noexcept {
+                while (head != nullptr) {
+                    FreeBlock* next = head->next;
+                    ::operator delete(head);
+                    head = next;
+                }
+            }
+
+            void give_to_depot(size_t size_class, FreeBlock* head, size_t count) noexcept {
+                BlockDepot& depot = block_depot();
+                FreeBlock* evicted = head;
+                {
+                    std::lock_guard<std::mutex> lock(depot.mutex);
+                    auto& batches = depot.batches[size_class];
+                    try {
+                        if (batches.size() < TaskBlockCache::max_depot_batches) {
+                            batches.push_back({head, count});
+                            evicted = nullptr;
+                        } else {
+                            // Full: the oldest batch makes room, being the least likely to be cache-warm
+                            evicted = batches.front().head;
+                            batches.erase(batches.begin());
+                            batches.push_back({head, count});
+                        }
+                    } catch (...) {
+                        // No room to record the batch; free it below
+                    }
+                }
+                delete_chain(evicted);
+            }
+
+            void refill_from_depot(ThreadBlockCache& cache, size_t size_class) {
+                BlockDepot& depot = block_depot();
+                std::lock_guard<std::mutex> lock(depot.mutex);
+                auto& batches = depot.batches[size_class];
+                if (!batches.empty()) {
+                    cache.heads[size_class] = batches.back().head;
+                    cache.counts[size_class] = batches.back().count;
+                    batches.pop_back();
+                }
+            }
+
+            // Trivially destructible, so it stays readable while thread_locals are torn down
+            thread_local bool cache_destroyed = false;
+
+            // nullptr once the thread's cache is gone (frees during thread/static teardown)
+            ThreadBlockCache* local_cache() {
+                if (cache_destroyed) {
+                    return nullptr;
+                }
+                thread_local ThreadBlockCache cache;
+                return &cache;
+            }
+
+            ThreadBlockCache::~ThreadBlockCache() {
+                cache_destroyed = true;
+                // Blocks outlive the thread: other threads pick them up from the depot
+                for (size_t size_class = 0; size_class < TaskBlockCache::size_classes; ++size_class) {
+                    if (heads[size_class] != nullptr) {
+                        give_to_depot(size_class, heads[size_class], counts[size_class]);
+                    }
+                }
+            }
+
+            size_t size_class_for(size_t bytes) {
+                return (std::max<size_t>(bytes, 1) - 1) / TaskBlockCache::block_granularity;
+            }
+
+        } // namespace
+
+        void* TaskBlockCache::allocate(size_t bytes) {
+            const size_t size_class = size_class_for(bytes);
+            if (size_class >= size_classes) {
+                return ::operator new(bytes);
+            }
+
+            ThreadBlockCache* cache = local_cache();
+            if (cache != nullptr) {
+                if (cache->heads[size_class] == nullptr) {
+                    refill_from_depot(*cache, size_class);
+                }
+                if (FreeBlock* block = cache->heads[size_class]) {
+                    cache->heads[size_class] = block->next;
+                    --cache->counts[size_class];
+                    return block;
+                }
+            }
+            return ::operator new((size_class + 1) * block_granularity);
+        }
+
+        void TaskBlockCache::deallocate(void* block, size_t bytes) noexcept {
+            if (block == nullptr) {
+                return;
+            }
+
+            const size_t size_class = size_class_for(bytes);
+            ThreadBlockCache* cache = size_class < size_classes ? local_cache() : nullptr;
+            if (cache == nullptr) {
+                ::operator delete(block);
+                return;
+            }
+
+            if (cache->counts[size_class] >= max_cached_per_class) {
+                // Keep the newest half (still warm in this thread's cache) and pass on the rest
+                FreeBlock* keep_tail = cache->heads[size_class];
+                for (size_t i = 1; i < max_cached_per_class / 2; ++i) {
+                    keep_tail = keep_tail->next;
+                }
+                give_to_depot(size_class, keep_tail->next, cache->counts[size_class] - max_cached_per_class / 2);
+                keep_tail->next = nullptr;
+                cache->counts[size_class] = max_cached_per_class / 2;
+            }
+
+            auto* free_block = static_cast<FreeBlock*>(block);
+            free_block->next = cache->heads[size_class];
+            cache->heads[size_class] = free_block;
+            ++cache->counts[size_class];
+        }
+
+        void BulkCompletion::record_exception(std::exception_ptr exception) noexcept {
+            std::lock_guard<std::mutex> lock(exception_mutex_);
+            if (!first_exception_) {
+                first_exception_ = exception;
+            }
+        }
+
+        void BulkCompletion::finish_chunk() noexcept {
+            if (remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+
+            // Last chunk: no other thread touches the exception slot any more
+            if (first_exception_) {
+                promise_.set_exception(first_exception_);
+            } else {
+                promise_.set_value();
+            }
+        }
+
+        std::future<void> make_ready_future() {
+            std::promise<void> promise;
+            promise.set_value();
+            return promise.get_future();
+        }
+
+    } // namespace detail
+
     // BasicThreadPool Implementation
     BasicThreadPool::BasicThreadPool(size_t num_threads) {
         threads_.reserve(num_threads);
@@ -26,7 +211,7 @@ namespace CppVerseHub::Concurrency {
 
     void BasicThreadPool::worker_thread() {
         while (true) {
-            std::function<void()> task;
+            PoolTask task;
             
             {
                 std::unique_lock<std::mutex> lock(queue_mutex_);
@@ -48,6 +233,27 @@ namespace CppVerseHub::Concurrency {
         }
     }
 
+    void BasicThreadPool::enqueue_batch(std::vector<PoolTask>& tasks) {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            if (shutdown_.load()) {
+                throw std::runtime_error("Cannot submit task to shutdown thread pool");
+            }
+            for (auto& task : tasks) {
+                tasks_.push(std::move(task));
+            }
+        }
+
+        // One wake-up per task, but never more than there are workers to wake
+        if (tasks.size() >= threads_.size()) {
+            cv_.notify_all();
+        } else {
+            for (size_t i = 0; i < tasks.size(); ++i) {
+                cv_.notify_one();
+            }
+        }
+    }
+
     size_t BasicThreadPool::pending_tasks() const {
         std::lock_guard<std::mutex> lock(queue_mutex_);
         return tasks_.size();
@@ -102,6 +308,26 @@ namespace CppVerseHub::Concurrency {
         }
     }
 
+    void PriorityThreadPool::enqueue_batch(Priority priority, std::vector<PoolTask>& tasks) {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            if (shutdown_.load()) {
+                throw std::runtime_error("Cannot submit task to shutdown thread pool");
+            }
+            for (auto& task : tasks) {
+                task_queue_.emplace(std::move(task), priority, next_task_id_.fetch_add(1));
+            }
+        }
+
+        if (tasks.size() >= threads_.size()) {
+            cv_.notify_all();
+        } else {
+            for (size_t i = 0; i < tasks.size(); ++i) {
+                cv_.notify_one();
+            }
+        }
+    }
+
     size_t PriorityThreadPool::pending_tasks() const {
         std::lock_guard<std::mutex> lock(queue_mutex_);
         return task_queue_.size();
@@ -120,12 +346,15 @@ namespace CppVerseHub::Concurrency {
     }
 
     // WorkStealingThreadPool Implementation
+    thread_local WorkStealingThreadPool* WorkStealingThreadPool::current_pool_ = nullptr;
+    thread_local size_t WorkStealingThreadPool::current_worker_ = 0;
+
     WorkStealingThreadPool::WorkStealingThreadPool(size_t num_threads) {
         queues_.reserve(num_threads);
         threads_.reserve(num_threads);
 
         for (size_t i = 0; i < num_threads; ++i) {
-            queues_.emplace_back(std::make_unique<WorkerQueue>());
+            queues_.emplace_back(std::make_unique<ChaseLevDeque<TaskFunction*>>());
         }
 
         for (size_t i = 0; i < num_threads; ++i) {
@@ -140,95 +369,127 @@ namespace CppVerseHub::Concurrency {
     }
 
     void WorkStealingThreadPool::worker_thread(size_t thread_id) {
-        auto& my_queue = *queues_[thread_id];
-        
-        while (!shutdown_.load()) {
-            std::function<void()> task;
-            bool found_task = false;
+        current_pool_ = this;
+        current_worker_ = thread_id;
 
-            // Try to get work from own queue
-            {
-                std::lock_guard<std::mutex> lock(my_queue.mutex);
-                if (!my_queue.tasks.empty()) {
-                    task = std::move(my_queue.tasks.front());
-                    my_queue.tasks.pop_front();
-                    found_task = true;
-                }
-            }
-
-            // If no work in own queue, try to steal
-            if (!found_task) {
-                found_task = try_steal_work(thread_id);
-                if (found_task) {
-                    // try_steal_work updates task if successful
-                    {
-                        std::lock_guard<std::mutex> lock(my_queue.mutex);
-                        if (!my_queue.tasks.empty()) {
-                            task = std::move(my_queue.tasks.front());
-                            my_queue.tasks.pop_front();
-                        } else {
-                            found_task = false;
-                        }
-                    }
-                }
-            }
+        size_t idle_rounds = 0;
 
-            if (found_task) {
-                try {
-                    task();
-                } catch (const std::exception& e) {
-                    std::cout << "WorkStealingThreadPool: Thread " << thread_id << " task exception - " << e.what() << "\n";
-                }
+        while (!shutdown_.load(std::memory_order_acquire)) {
+            if (TaskFunction* raw_task = find_task()) {
+                idle_rounds = 0;
+                execute_task(raw_task);
+            } else if (++idle_rounds < 64) {
+                std::this_thread::yield();
             } else {
-                // No work available, sleep briefly
+                // No work available for a while, sleep briefly
                 std::this_thread::sleep_for(std::chrono::milliseconds(1));
             }
         }
+
+        current_pool_ = nullptr;
     }
 
-    bool WorkStealingThreadPool::try_steal_work(size_t my_id) {
-        // Try to steal from other queues
-        for (size_t i = 0; i < queues_.size(); ++i) {
-            if (i == my_id) continue;
+    WorkStealingThreadPool::TaskFunction* WorkStealingThreadPool::find_task() {
+        const bool is_worker = current_pool_ == this;
 
-            auto& other_queue = *queues_[i];
-            std::lock_guard<std::mutex> lock(other_queue.mutex);
-            
-            if (other_queue.tasks.size() > 1) { // Only steal if queue has multiple tasks
-                auto stolen_task = std::move(other_queue.tasks.back());
-                other_queue.tasks.pop_back();
-                
-                // Add stolen task to my queue
-                auto& my_queue = *queues_[my_id];
-                std::lock_guard<std::mutex> my_lock(my_queue.mutex);
-                my_queue.tasks.push_back(std::move(stolen_task));
-                return true;
+        // Own deque first (LIFO), then external submissions, then steal (FIFO)
+        if (is_worker) {
+            if (auto local = queues_[current_worker_]->pop()) {
+                return *local;
             }
         }
+        if (TaskFunction* injected = try_take_injected()) {
+            return injected;
+        }
+        return try_steal_work(is_worker ? current_worker_ : queues_.size());
+    }
+
+    void WorkStealingThreadPool::execute_task(TaskFunction* raw_task) {
+        try {
+            (*raw_task)();
+        } catch (const std::exception& e) {
+            std::cout << "WorkStealingThreadPool: Thread " << std::this_thread::get_id()
+                      << " task exception - " << e.what() << "\n";
+        }
+        release_task(raw_task);
+    }
+
+    void WorkStealingThreadPool::release_task(TaskFunction* raw_task) noexcept {
+        raw_task->~TaskFunction();
+        detail::TaskBlockCache::deallocate(raw_task, sizeof(TaskFunction));
+    }
+
+    bool WorkStealingThreadPool::run_pending_task() {
+        if (TaskFunction* raw_task = find_task()) {
+            execute_task(raw_task);
+            return true;
+        }
         return false;
     }
 
-    void WorkStealingThreadPool::push_task_to_queue(size_t queue_id, std::function<void()> task) {
-        auto& queue = *queues_[queue_id];
-        std::lock_guard<std::mutex> lock(queue.mutex);
-        queue.tasks.push_back(std::move(task));
+    WorkStealingThreadPool::TaskFunction* WorkStealingThreadPool::try_steal_work(size_t my_id) {
+        // Start at a rotating victim so thieves spread out instead of all hitting queue 0
+        const size_t count = queues_.size();
+        const size_t start = next_victim_.fetch_add(1, std::memory_order_relaxed);
+
+        for (size_t i = 0; i < count; ++i) {
+            size_t victim = (start + i) % count;
+            if (victim == my_id) continue;
+
+            if (auto stolen = queues_[victim]->steal()) {
+                return *stolen;
+            }
+        }
+        return nullptr;
+    }
+
+    WorkStealingThreadPool::TaskFunction* WorkStealingThreadPool::try_take_injected() {
+        std::lock_guard<std::mutex> lock(injection_mutex_);
+        if (injection_queue_.empty()) {
+            return nullptr;
+        }
+        TaskFunction* task = injection_queue_.front();
+        injection_queue_.pop_front();
+        return task;
+    }
+
+    void WorkStealingThreadPool::push_task(TaskFunction task) {
+        // Deques hold pointers, so the task is relocated into a cached block
+        auto* raw_task = ::new (detail::TaskBlockCache::allocate(sizeof(TaskFunction))) TaskFunction(std::move(task));
+
+        if (current_pool_ == this) {
+            // Called from one of our workers: lock-free push onto its own deque
+            queues_[current_worker_]->push(raw_task);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(injection_mutex_);
+            // shutdown() drains this queue under the same lock; anything pushed after that is dropped here
+            if (!shutdown_.load(std::memory_order_acquire)) {
+                injection_queue_.push_back(raw_task);
+                return;
+            }
+        }
+        release_task(raw_task);
     }
 
     size_t WorkStealingThreadPool::total_pending_tasks() const {
         size_t total = 0;
         for (const auto& queue : queues_) {
-            std::lock_guard<std::mutex> lock(queue->mutex);
-            total += queue->tasks.size();
+            total += queue->size();
         }
-        return total;
+        std::lock_guard<std::mutex> lock(injection_mutex_);
+        return total + injection_queue_.size();
     }
 
     void WorkStealingThreadPool::print_queue_status() const {
         std::cout << "WorkStealingThreadPool queue status:\n";
         for (size_t i = 0; i < queues_.size(); ++i) {
-            std::lock_guard<std::mutex> lock(queues_[i]->mutex);
-            std::cout << "  Queue " << i << ": " << queues_[i]->tasks.size() << " tasks\n";
+            std::cout << "  Queue " << i << ": " << queues_[i]->size() << " tasks\n";
         }
+        std::lock_guard<std::mutex> lock(injection_mutex_);
+        std::cout << "  Injection queue: " << injection_queue_.size() << " tasks\n";
     }
 
     void WorkStealingThreadPool::shutdown() {
@@ -238,10 +499,63 @@ namespace CppVerseHub::Concurrency {
                     thread.join();
                 }
             }
+
+            // Workers are gone, so draining the deques from here is race-free
+            for (auto& queue : queues_) {
+                while (auto leftover = queue->pop()) {
+                    release_task(*leftover);
+                }
+            }
+            std::lock_guard<std::mutex> lock(injection_mutex_);
+            for (TaskFunction* leftover : injection_queue_) {
+                release_task(leftover);
+            }
+            injection_queue_.clear();
+
             std::cout << "WorkStealingThreadPool: Shutdown complete\n";
         }
     }
 
+    // TaskGroup Implementation
+    TaskGroup::~TaskGroup() {
+        // Children capture this group, so they must finish before it goes away
+        wait_for_children();
+    }
+
+    void TaskGroup::sync() {
+        wait_for_children();
+
+        std::exception_ptr exception;
+        {
+            std::lock_guard<std::mutex> lock(exception_mutex_);
+            std::swap(exception, first_exception_);
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void TaskGroup::wait_for_children() {
+        // Help-first waiting: keep the thread busy with queued work instead of blocking
+        while (pending_.load(std::memory_order_acquire) > 0) {
+            if (!pool_.run_pending_task()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void TaskGroup::record_exception(std::exception_ptr exception) {
+        std::lock_guard<std::mutex> lock(exception_mutex_);
+        if (!first_exception_) {
+            first_exception_ = exception;
+        }
+    }
+
+    void TaskGroup::cancel_child() noexcept {
+        record_exception(std::make_exception_ptr(std::runtime_error("TaskGroup child dropped by thread pool shutdown")));
+        pending_.fetch_sub(1, std::memory_order_release);
+    }
+
     // ThreadPoolManager Implementation
     ThreadPoolManager& ThreadPoolManager::instance() {
         static ThreadPoolManager instance;
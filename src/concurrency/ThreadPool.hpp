@@ -25,9 +25,356 @@
 #include <random>
 #include <algorithm>
 #include <type_traits>
+#include <optional>
+#include <cstdint>
+#include <exception>
+#include <tuple>
+#include <utility>
+#include <new>
+#include <cstddef>
+#include <iterator>
 
 namespace CppVerseHub::Concurrency {
 
+    namespace detail {
+
+        /**
+         * @class TaskBlockCache
+         * @brief Per-thread free lists of small blocks for task callables and future state
+         *
+         * Blocks are rounded up to 64-byte size classes; anything larger than the
+         * biggest class goes straight to operator new. A block may be released on a
+         * different thread than the one that allocated it, which is the normal case
+         * for tasks submitted from outside a pool. The releasing thread's cache then
+         * overflows in half-cache batches into a shared depot, and a thread whose
+         * cache runs dry refills a whole batch from there, so the submitting thread
+         * reuses the blocks its workers freed. Caches hand their blocks to the depot
+         * when their thread exits; blocks beyond the depot's bound are freed.
+         */
+        class TaskBlockCache {
+        public:
+            static constexpr size_t block_granularity = 64;
+            static constexpr size_t size_classes = 4;           // 64, 128, 192, 256 bytes
+            static constexpr size_t max_cached_per_class = 256;
+            static constexpr size_t max_depot_batches = 64;     // per size class
+
+            static void* allocate(size_t bytes);
+            static void deallocate(void* block, size_t bytes) noexcept;
+        };
+
+        /**
+         * @brief Standard allocator over TaskBlockCache, used for std::promise shared state
+         */
+        template<typename T>
+        class PooledStateAllocator {
+        public:
+            using value_type = T;
+
+            PooledStateAllocator() noexcept = default;
+            template<typename U>
+            PooledStateAllocator(const PooledStateAllocator<U>&) noexcept {}
+
+            T* allocate(size_t n) {
+                return static_cast<T*>(TaskBlockCache::allocate(n * sizeof(T)));
+            }
+
+            void deallocate(T* p, size_t n) noexcept {
+                TaskBlockCache::deallocate(p, n * sizeof(T));
+            }
+
+            template<typename U>
+            bool operator==(const PooledStateAllocator<U>&) const noexcept { return true; }
+            template<typename U>
+            bool operator!=(const PooledStateAllocator<U>&) const noexcept { return false; }
+        };
+
+    } // namespace detail
+
+    /**
+     * @class PoolTask
+     * @brief Move-only, type-erased void() callable with small-buffer storage
+     *
+     * Replaces std::function<void()> in the pools. Callables up to inline_capacity
+     * bytes (that are nothrow-movable) are stored in place; larger ones live in a
+     * TaskBlockCache block. Unlike std::function it accepts move-only callables, so
+     * a std::promise can be captured directly instead of through a shared_ptr.
+     */
+    class PoolTask {
+    public:
+        static constexpr size_t inline_capacity = 56;
+
+        PoolTask() noexcept = default;
+
+        template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, PoolTask>>>
+        PoolTask(F&& f) {
+            using Fn = std::decay_t<F>;
+            static_assert(alignof(Fn) <= alignof(std::max_align_t), "Over-aligned callables are not supported");
+
+            if constexpr (stored_inline<Fn>()) {
+                ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(f));
+                vtable_ = &inline_vtable<Fn>;
+            } else {
+                void* memory = detail::TaskBlockCache::allocate(sizeof(Fn));
+                try {
+                    *reinterpret_cast<Fn**>(storage_) = ::new (memory) Fn(std::forward<F>(f));
+                } catch (...) {
+                    detail::TaskBlockCache::deallocate(memory, sizeof(Fn));
+                    throw;
+                }
+                vtable_ = &heap_vtable<Fn>;
+            }
+        }
+
+        PoolTask(PoolTask&& other) noexcept {
+            move_from(other);
+        }
+
+        PoolTask& operator=(PoolTask&& other) noexcept {
+            if (this != &other) {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        PoolTask(const PoolTask&) = delete;
+        PoolTask& operator=(const PoolTask&) = delete;
+
+        ~PoolTask() { reset(); }
+
+        void operator()() {
+            if (!vtable_) {
+                throw std::bad_function_call();
+            }
+            vtable_->invoke(storage_);
+        }
+
+        explicit operator bool() const noexcept { return vtable_ != nullptr; }
+
+        void reset() noexcept {
+            if (vtable_) {
+                vtable_->destroy(storage_);
+                vtable_ = nullptr;
+            }
+        }
+
+    private:
+        struct VTable {
+            void (*invoke)(void* storage);
+            void (*relocate)(void* destination, void* source) noexcept;
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template<typename Fn>
+        static constexpr bool stored_inline() {
+            return sizeof(Fn) <= inline_capacity && std::is_nothrow_move_constructible_v<Fn>;
+        }
+
+        template<typename Fn>
+        static constexpr VTable inline_vtable = {
+            [](void* storage) { (*std::launder(static_cast<Fn*>(storage)))(); },
+            [](void* destination, void* source) noexcept {
+                Fn* from = std::launder(static_cast<Fn*>(source));
+                ::new (destination) Fn(std::move(*from));
+                from->~Fn();
+            },
+            [](void* storage) noexcept { std::launder(static_cast<Fn*>(storage))->~Fn(); }
+        };
+
+        template<typename Fn>
+        static constexpr VTable heap_vtable = {
+            [](void* storage) { (**static_cast<Fn**>(storage))(); },
+            [](void* destination, void* source) noexcept {
+                *static_cast<Fn**>(destination) = *static_cast<Fn**>(source);
+            },
+            [](void* storage) noexcept {
+                Fn* callable = *static_cast<Fn**>(storage);
+                callable->~Fn();
+                detail::TaskBlockCache::deallocate(callable, sizeof(Fn));
+            }
+        };
+
+        void move_from(PoolTask& other) noexcept {
+            if (other.vtable_) {
+                other.vtable_->relocate(storage_, other.storage_);
+                vtable_ = other.vtable_;
+                other.vtable_ = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) unsigned char storage_[inline_capacity];
+        const VTable* vtable_ = nullptr;
+    };
+
+    namespace detail {
+
+        /**
+         * @brief Wrap f(args...) into a PoolTask plus the future for its result
+         *
+         * The promise's shared state comes from TaskBlockCache and the promise is
+         * captured by value, so the common case costs no malloc at all once the
+         * per-thread caches are warm.
+         */
+        template<typename F, typename... Args>
+        auto package_task(F&& f, Args&&... args)
+            -> std::pair<PoolTask, std::future<std::invoke_result_t<F, Args...>>> {
+            using return_type = std::invoke_result_t<F, Args...>;
+
+            std::promise<return_type> promise(std::allocator_arg, PooledStateAllocator<return_type>{});
+            auto future = promise.get_future();
+
+            PoolTask task([promise = std::move(promise),
+                           func = std::forward<F>(f),
+                           bound_args = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+                try {
+                    if constexpr (std::is_void_v<return_type>) {
+                        std::apply(std::move(func), std::move(bound_args));
+                        promise.set_value();
+                    } else {
+                        promise.set_value(std::apply(std::move(func), std::move(bound_args)));
+                    }
+                } catch (...) {
+                    promise.set_exception(std::current_exception());
+                }
+            });
+
+            return {std::move(task), std::move(future)};
+        }
+
+        /**
+         * @class BulkCompletion
+         * @brief Shared completion state for one submit_bulk/parallel_for call
+         *
+         * Counts outstanding chunks and fulfils a single future when the last one
+         * finishes. The first exception thrown by any chunk is delivered through
+         * that future; the remaining chunks still run.
+         */
+        class BulkCompletion {
+        public:
+            explicit BulkCompletion(size_t chunks) : remaining_(chunks) {}
+
+            std::future<void> get_future() { return promise_.get_future(); }
+
+            // Register chunks created by splitting after construction
+            void add_chunks(size_t count) { remaining_.fetch_add(count, std::memory_order_relaxed); }
+
+            template<typename Chunk>
+            void run_chunk(Chunk&& chunk) noexcept {
+                try {
+                    chunk();
+                } catch (...) {
+                    record_exception(std::current_exception());
+                }
+                finish_chunk();
+            }
+
+        private:
+            std::atomic<size_t> remaining_;
+            std::promise<void> promise_;
+            std::mutex exception_mutex_;
+            std::exception_ptr first_exception_;
+
+            void record_exception(std::exception_ptr exception) noexcept;
+            void finish_chunk() noexcept;
+        };
+
+        template<typename F>
+        struct BulkJob : BulkCompletion {
+            BulkJob(size_t chunks, F&& function) : BulkCompletion(chunks), fn(std::move(function)) {}
+            F fn;
+        };
+
+        std::future<void> make_ready_future();
+
+        /**
+         * @class GuidedRange
+         * @brief Shared cursor over [begin, end) for guided self-scheduling
+         *
+         * Each claim takes 1/(2 * workers) of what is left, but never less than the
+         * grain: early claims are large and cheap, the last ones small, so runners
+         * that start late or draw expensive elements still finish close together.
+         */
+        template<typename Index>
+        class GuidedRange {
+        public:
+            GuidedRange(Index begin, Index end, Index grain, size_t workers)
+                : next_(begin), end_(end), grain_(std::max<Index>(grain, 1)),
+                  divisor_(static_cast<Index>(std::max<size_t>(1, workers * 2))) {}
+
+            // Claim the next piece as [lo, hi); false once the range is exhausted
+            bool claim(Index& lo, Index& hi) {
+                Index current = next_.load(std::memory_order_relaxed);
+                while (current < end_) {
+                    const auto remaining = static_cast<Index>(end_ - current);
+                    const Index size = std::min<Index>(remaining, std::max<Index>(grain_, static_cast<Index>(remaining / divisor_)));
+                    if (next_.compare_exchange_weak(current, static_cast<Index>(current + size), std::memory_order_relaxed)) {
+                        lo = current;
+                        hi = static_cast<Index>(current + size);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+        private:
+            std::atomic<Index> next_;
+            const Index end_;
+            const Index grain_;
+            const Index divisor_;
+        };
+
+        template<typename F, typename Index>
+        struct GuidedJob : BulkJob<F> {
+            GuidedJob(size_t runners, F&& function, Index begin, Index end, Index grain, size_t workers)
+                : BulkJob<F>(runners, std::move(function)), range(begin, end, grain, workers) {}
+            GuidedRange<Index> range;
+        };
+
+        /**
+         * @brief parallel_for for central-queue pools: one runner task per worker (fewer
+         * for short ranges), each claiming guided pieces until the range is exhausted
+         *
+         * Runners that are dequeued late simply find less left to claim, so the split
+         * adapts to how busy the pool is instead of being fixed at submission time.
+         */
+        template<typename Index, typename F>
+        std::future<void> make_guided_tasks(Index begin, Index end, Index grain, size_t workers, F fn,
+                                            std::vector<PoolTask>& tasks) {
+            const Index count = end - begin;
+            const Index min_piece = std::max<Index>(grain, 1);
+            const auto pieces = static_cast<size_t>(count / min_piece + (count % min_piece != 0));
+            const size_t runners = std::clamp<size_t>(pieces, 1, std::max<size_t>(1, workers));
+
+            auto job = std::make_shared<GuidedJob<F, Index>>(runners, std::move(fn), begin, end, grain, workers);
+            tasks.reserve(runners);
+            for (size_t runner = 0; runner < runners; ++runner) {
+                tasks.emplace_back([job]() {
+                    job->run_chunk([&]() {
+                        Index lo{};
+                        Index hi{};
+                        while (job->range.claim(lo, hi)) {
+                            for (Index i = lo; i < hi; ++i) {
+                                job->fn(i);
+                            }
+                        }
+                    });
+                });
+            }
+            return job->get_future();
+        }
+
+        template<typename Range>
+        using range_iterator_t = decltype(std::begin(std::declval<Range&>()));
+
+        template<typename Range>
+        constexpr void require_random_access_range() {
+            static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                              typename std::iterator_traits<range_iterator_t<Range>>::iterator_category>,
+                          "submit_bulk requires a random-access range");
+        }
+
+    } // namespace detail
+
     /**
      * @class BasicThreadPool
      * @brief Simple thread pool with work queue
@@ -41,6 +388,16 @@ namespace CppVerseHub::Concurrency {
         template<typename F, typename... Args>
         auto submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>;
 
+        // Call fn(i) for every i in [begin, end). One runner per worker is enqueued under a single
+        // lock; runners claim guided pieces of at least grain (0 = 1) from a shared cursor.
+        // The returned future completes when the whole range has run.
+        template<typename Index, typename F>
+        std::future<void> parallel_for(Index begin, Index end, Index grain, F fn);
+
+        // Call fn(element) for every element of a random-access range, which must outlive the future
+        template<typename Range, typename F>
+        std::future<void> submit_bulk(Range& range, F fn);
+
         // Get pool statistics
         size_t active_threads() const { return threads_.size(); }
         size_t pending_tasks() const;
@@ -50,12 +407,13 @@ namespace CppVerseHub::Concurrency {
 
     private:
         std::vector<std::thread> threads_;
-        std::queue<std::function<void()>> tasks_;
+        std::queue<PoolTask> tasks_;
         mutable std::mutex queue_mutex_;
         std::condition_variable cv_;
         std::atomic<bool> shutdown_{false};
 
         void worker_thread();
+        void enqueue_batch(std::vector<PoolTask>& tasks);
     };
 
     /**
@@ -67,12 +425,12 @@ namespace CppVerseHub::Concurrency {
         enum class Priority { LOW = 1, NORMAL = 2, HIGH = 3, CRITICAL = 4 };
 
         struct Task {
-            std::function<void()> function;
+            PoolTask function;
             Priority priority;
             std::chrono::steady_clock::time_point submit_time;
             size_t id;
 
-            Task(std::function<void()> f, Priority p, size_t task_id)
+            Task(PoolTask f, Priority p, size_t task_id)
                 : function(std::move(f)), priority(p), submit_time(std::chrono::steady_clock::now()), id(task_id) {}
 
             bool operator<(const Task& other) const {
@@ -89,6 +447,13 @@ namespace CppVerseHub::Concurrency {
         template<typename F, typename... Args>
         auto submit(Priority priority, F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>;
 
+        // Bulk variants of submit; every runner is queued at the given priority
+        template<typename Index, typename F>
+        std::future<void> parallel_for(Priority priority, Index begin, Index end, Index grain, F fn);
+
+        template<typename Range, typename F>
+        std::future<void> submit_bulk(Priority priority, Range& range, F fn);
+
         size_t pending_tasks() const;
         void shutdown();
 
@@ -101,38 +466,273 @@ namespace CppVerseHub::Concurrency {
         std::atomic<size_t> next_task_id_{0};
 
         void worker_thread();
+        void enqueue_batch(Priority priority, std::vector<PoolTask>& tasks);
+    };
+
+    /**
+     * @class ChaseLevDeque
+     * @brief Lock-free work-stealing deque (Chase & Lev, with the C11 orderings of Le et al.)
+     *
+     * The owning thread pushes and pops at the bottom (LIFO) while any number of
+     * thieves steal from the top (FIFO). Only the single-element race between the
+     * owner and a thief is resolved with a CAS on top_. Elements must be trivially
+     * copyable (typically raw task pointers). Buffers replaced during growth are
+     * retired and released when the deque is destroyed, since a thief may still be
+     * reading from them.
+     */
+    template<typename T>
+    class ChaseLevDeque {
+        static_assert(std::is_trivially_copyable_v<T>, "ChaseLevDeque elements must be trivially copyable");
+
+    public:
+        explicit ChaseLevDeque(size_t initial_capacity = 64)
+            : buffer_(new Buffer(round_up_pow2(initial_capacity))) {}
+
+        ~ChaseLevDeque() {
+            delete buffer_.load(std::memory_order_relaxed);
+            for (Buffer* retired : retired_buffers_) {
+                delete retired;
+            }
+        }
+
+        ChaseLevDeque(const ChaseLevDeque&) = delete;
+        ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+
+        // Owner only: push at the bottom
+        void push(T item) {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_acquire);
+            Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+
+            if (b - t > static_cast<int64_t>(buffer->capacity) - 1) {
+                buffer = grow(buffer, t, b);
+            }
+
+            buffer->put(b, item);
+            // Release store (rather than fence + relaxed) publishes the item to thieves
+            bottom_.store(b + 1, std::memory_order_release);
+        }
+
+        // Owner only: pop the most recently pushed item
+        std::optional<T> pop() {
+            int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+            bottom_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top_.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                // Deque was empty
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            std::optional<T> item = buffer->get(b);
+            if (t == b) {
+                // Last element: race against thieves for it
+                if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    item.reset();
+                }
+                bottom_.store(b + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        // Any thread: steal the oldest item; empty result on an empty deque or a lost race
+        std::optional<T> steal() {
+            int64_t t = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom_.load(std::memory_order_acquire);
+
+            if (t >= b) {
+                return std::nullopt;
+            }
+
+            Buffer* buffer = buffer_.load(std::memory_order_acquire);
+            T item = buffer->get(t);
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return std::nullopt;
+            }
+            return item;
+        }
+
+        // Approximate number of queued items (exact when quiescent)
+        size_t size() const {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<size_t>(b - t) : 0;
+        }
+
+        bool empty() const { return size() == 0; }
+
+    private:
+        struct Buffer {
+            size_t capacity;
+            size_t mask;
+            std::unique_ptr<std::atomic<T>[]> slots;
+
+            explicit Buffer(size_t cap) : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+            T get(int64_t index) const {
+                return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+            }
+
+            void put(int64_t index, T item) {
+                slots[static_cast<size_t>(index) & mask].store(item, std::memory_order_relaxed);
+            }
+        };
+
+        static size_t round_up_pow2(size_t n) {
+            size_t cap = 2;
+            while (cap < n) cap <<= 1;
+            return cap;
+        }
+
+        Buffer* grow(Buffer* old_buffer, int64_t t, int64_t b) {
+            auto* new_buffer = new Buffer(old_buffer->capacity * 2);
+            for (int64_t i = t; i < b; ++i) {
+                new_buffer->put(i, old_buffer->get(i));
+            }
+            retired_buffers_.push_back(old_buffer);
+            buffer_.store(new_buffer, std::memory_order_release);
+            return new_buffer;
+        }
+
+        // Keep owner-written bottom_ and thief-written top_ on separate cache lines
+        alignas(64) std::atomic<int64_t> top_{0};
+        alignas(64) std::atomic<int64_t> bottom_{0};
+        alignas(64) std::atomic<Buffer*> buffer_;
+        std::vector<Buffer*> retired_buffers_; // Owner only
     };
 
     /**
      * @class WorkStealingThreadPool
      * @brief Advanced thread pool with work stealing for load balancing
+     *
+     * Each worker owns a lock-free ChaseLevDeque: tasks submitted from inside a
+     * worker go to the bottom of its own deque and are popped LIFO for locality,
+     * while idle workers steal FIFO from the top of other deques. Submissions from
+     * outside the pool land in a shared injection queue.
+     *
+     * Blocking on a future returned by submit() from inside a worker stalls that
+     * worker and can deadlock the pool; nested parallelism should use TaskGroup or
+     * parallel_invoke(), whose waits keep executing queued work.
      */
     class WorkStealingThreadPool {
     public:
+        using TaskFunction = PoolTask;
+
         explicit WorkStealingThreadPool(size_t num_threads = std::thread::hardware_concurrency());
         ~WorkStealingThreadPool();
 
         template<typename F, typename... Args>
         auto submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>;
 
+        // Fork-join: run all callables, possibly in parallel, and return once all finished
+        template<typename... Fs>
+        void parallel_invoke(Fs&&... fs);
+
+        // Call fn(i) for every i in [begin, end). The range is split in halves on demand, so
+        // thieves steal the largest remaining pieces; grain is the leaf size (0 = automatic).
+        template<typename Index, typename F>
+        std::future<void> parallel_for(Index begin, Index end, Index grain, F fn);
+
+        template<typename Range, typename F>
+        std::future<void> submit_bulk(Range& range, F fn);
+
+        // Execute one queued task on the calling thread; false if none was found
+        bool run_pending_task();
+
+        size_t thread_count() const { return threads_.size(); }
         size_t total_pending_tasks() const;
         void print_queue_status() const;
         void shutdown();
 
     private:
-        struct WorkerQueue {
-            std::deque<std::function<void()>> tasks;
-            mutable std::mutex mutex;
-        };
+        friend class TaskGroup;
 
         std::vector<std::thread> threads_;
-        std::vector<std::unique_ptr<WorkerQueue>> queues_;
+        std::vector<std::unique_ptr<ChaseLevDeque<TaskFunction*>>> queues_;
+        std::deque<TaskFunction*> injection_queue_;
+        mutable std::mutex injection_mutex_;
         std::atomic<bool> shutdown_{false};
-        std::atomic<size_t> next_queue_{0};
+        std::atomic<size_t> next_victim_{0};
+
+        // Identifies the pool and deque owned by the calling worker thread, if any
+        static thread_local WorkStealingThreadPool* current_pool_;
+        static thread_local size_t current_worker_;
 
         void worker_thread(size_t thread_id);
-        bool try_steal_work(size_t my_id);
-        void push_task_to_queue(size_t queue_id, std::function<void()> task);
+        TaskFunction* find_task();
+        TaskFunction* try_steal_work(size_t my_id);
+        TaskFunction* try_take_injected();
+        void push_task(TaskFunction task);
+        void execute_task(TaskFunction* raw_task);
+
+        template<typename Job, typename Index>
+        void run_range(std::shared_ptr<Job> job, Index begin, Index end, Index leaf_size);
+        static void release_task(TaskFunction* raw_task) noexcept;
+    };
+
+    /**
+     * @class TaskGroup
+     * @brief spawn/sync fork-join scope on a WorkStealingThreadPool
+     *
+     * spawn() pushes a child task (onto the caller's own deque when called from a
+     * worker); sync() waits for every spawned child while executing other queued
+     * tasks, so a worker waiting on its children never idles or deadlocks the pool.
+     * The first exception thrown by a child is rethrown from sync(). Children the
+     * pool drops unrun at shutdown count as finished with a std::runtime_error.
+     */
+    class TaskGroup {
+    public:
+        explicit TaskGroup(WorkStealingThreadPool& pool) : pool_(pool) {}
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        template<typename F>
+        void spawn(F&& f);
+
+        void sync();
+
+        size_t pending() const { return pending_.load(std::memory_order_acquire); }
+
+    private:
+        WorkStealingThreadPool& pool_;
+        std::atomic<size_t> pending_{0};
+        std::exception_ptr first_exception_;
+        std::mutex exception_mutex_;
+
+        /**
+         * @brief Travels inside a spawned child; completing it ends the child normally,
+         * destroying it unrun (a task dropped at shutdown) cancels the child instead
+         */
+        class ChildTicket {
+        public:
+            explicit ChildTicket(TaskGroup* group) noexcept : group_(group) {}
+            ChildTicket(ChildTicket&& other) noexcept : group_(std::exchange(other.group_, nullptr)) {}
+            ChildTicket& operator=(ChildTicket&&) = delete;
+            ~ChildTicket() {
+                if (group_ != nullptr) {
+                    group_->cancel_child();
+                }
+            }
+
+            TaskGroup* group() const noexcept { return group_; }
+
+            void complete() noexcept {
+                std::exchange(group_, nullptr)->pending_.fetch_sub(1, std::memory_order_release);
+            }
+
+        private:
+            TaskGroup* group_;
+        };
+
+        void wait_for_children();
+        void record_exception(std::exception_ptr exception);
+        void cancel_child() noexcept;
     };
 
     /**
@@ -199,35 +799,45 @@ namespace CppVerseHub::Concurrency {
 
     template<typename F, typename... Args>
     auto BasicThreadPool::submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
-        using return_type = std::invoke_result_t<F, Args...>;
-
-        auto task = std::make_shared<std::packaged_task<return_type()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-        );
-
-        auto future = task->get_future();
+        auto [task, future] = detail::package_task(std::forward<F>(f), std::forward<Args>(args)...);
 
         {
             std::lock_guard<std::mutex> lock(queue_mutex_);
             if (shutdown_.load()) {
                 throw std::runtime_error("Cannot submit task to shutdown thread pool");
             }
-            tasks_.emplace([task]() { (*task)(); });
+            tasks_.push(std::move(task));
         }
 
         cv_.notify_one();
+        return std::move(future);
+    }
+
+    template<typename Index, typename F>
+    std::future<void> BasicThreadPool::parallel_for(Index begin, Index end, Index grain, F fn) {
+        static_assert(std::is_integral_v<Index>, "parallel_for requires an integral index type");
+        if (end <= begin) {
+            return detail::make_ready_future();
+        }
+
+        std::vector<PoolTask> tasks;
+        auto future = detail::make_guided_tasks(begin, end, grain, threads_.size(), std::move(fn), tasks);
+
+        enqueue_batch(tasks);
         return future;
     }
 
+    template<typename Range, typename F>
+    std::future<void> BasicThreadPool::submit_bulk(Range& range, F fn) {
+        detail::require_random_access_range<Range>();
+        auto first = std::begin(range);
+        return parallel_for<size_t>(0, static_cast<size_t>(std::distance(first, std::end(range))), 0,
+                                    [first, fn = std::move(fn)](size_t i) mutable { fn(first[static_cast<std::ptrdiff_t>(i)]); });
+    }
+
     template<typename F, typename... Args>
     auto PriorityThreadPool::submit(Priority priority, F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
-        using return_type = std::invoke_result_t<F, Args...>;
-
-        auto task = std::make_shared<std::packaged_task<return_type()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-        );
-
-        auto future = task->get_future();
+        auto [task, future] = detail::package_task(std::forward<F>(f), std::forward<Args>(args)...);
 
         {
             std::lock_guard<std::mutex> lock(queue_mutex_);
@@ -236,34 +846,131 @@ namespace CppVerseHub::Concurrency {
             }
 
             size_t task_id = next_task_id_.fetch_add(1);
-            task_queue_.emplace([task]() { (*task)(); }, priority, task_id);
+            task_queue_.emplace(std::move(task), priority, task_id);
         }
 
         cv_.notify_one();
+        return std::move(future);
+    }
+
+    template<typename Index, typename F>
+    std::future<void> PriorityThreadPool::parallel_for(Priority priority, Index begin, Index end, Index grain, F fn) {
+        static_assert(std::is_integral_v<Index>, "parallel_for requires an integral index type");
+        if (end <= begin) {
+            return detail::make_ready_future();
+        }
+
+        std::vector<PoolTask> tasks;
+        auto future = detail::make_guided_tasks(begin, end, grain, threads_.size(), std::move(fn), tasks);
+
+        enqueue_batch(priority, tasks);
         return future;
     }
 
+    template<typename Range, typename F>
+    std::future<void> PriorityThreadPool::submit_bulk(Priority priority, Range& range, F fn) {
+        detail::require_random_access_range<Range>();
+        auto first = std::begin(range);
+        return parallel_for<size_t>(priority, 0, static_cast<size_t>(std::distance(first, std::end(range))), 0,
+                                    [first, fn = std::move(fn)](size_t i) mutable { fn(first[static_cast<std::ptrdiff_t>(i)]); });
+    }
+
     template<typename F, typename... Args>
     auto WorkStealingThreadPool::submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
-        using return_type = std::invoke_result_t<F, Args...>;
+        if (shutdown_.load()) {
+            throw std::runtime_error("Cannot submit task to shutdown thread pool");
+        }
+
+        auto [task, future] = detail::package_task(std::forward<F>(f), std::forward<Args>(args)...);
+        push_task(std::move(task));
 
-        auto task = std::make_shared<std::packaged_task<return_type()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-        );
+        return std::move(future);
+    }
 
-        auto future = task->get_future();
+    template<typename... Fs>
+    void WorkStealingThreadPool::parallel_invoke(Fs&&... fs) {
+        static_assert(sizeof...(Fs) > 0, "parallel_invoke requires at least one callable");
+
+        TaskGroup group(*this);
+        // Spawn every callable except the last, which runs inline on the calling thread.
+        // If the inline call throws, ~TaskGroup still waits for the spawned children.
+        auto spawn_or_run = [&group, remaining = sizeof...(Fs)](auto&& f) mutable {
+            if (--remaining > 0) {
+                group.spawn(std::forward<decltype(f)>(f));
+            } else {
+                std::forward<decltype(f)>(f)();
+            }
+        };
+        (spawn_or_run(std::forward<Fs>(fs)), ...);
+        group.sync();
+    }
 
+    template<typename Index, typename F>
+    std::future<void> WorkStealingThreadPool::parallel_for(Index begin, Index end, Index grain, F fn) {
+        static_assert(std::is_integral_v<Index>, "parallel_for requires an integral index type");
+        if (end <= begin) {
+            return detail::make_ready_future();
+        }
         if (shutdown_.load()) {
             throw std::runtime_error("Cannot submit task to shutdown thread pool");
         }
 
-        // Round-robin distribution to worker queues
-        size_t queue_id = next_queue_.fetch_add(1) % queues_.size();
-        push_task_to_queue(queue_id, [task]() { (*task)(); });
+        // Leaves default to ~8 per worker; splitting below that only adds overhead
+        const Index count = end - begin;
+        const auto target_leaves = static_cast<Index>(std::max<size_t>(1, threads_.size() * 8));
+        const Index leaf_size = grain > 0 ? grain : std::max<Index>(1, static_cast<Index>(count / target_leaves));
+
+        auto job = std::make_shared<detail::BulkJob<F>>(1, std::move(fn));
+        auto future = job->get_future();
 
+        push_task([this, job, begin, end, leaf_size]() { run_range(job, begin, end, leaf_size); });
         return future;
     }
 
+    template<typename Range, typename F>
+    std::future<void> WorkStealingThreadPool::submit_bulk(Range& range, F fn) {
+        detail::require_random_access_range<Range>();
+        auto first = std::begin(range);
+        return parallel_for<size_t>(0, static_cast<size_t>(std::distance(first, std::end(range))), 0,
+                                    [first, fn = std::move(fn)](size_t i) mutable { fn(first[static_cast<std::ptrdiff_t>(i)]); });
+    }
+
+    template<typename Job, typename Index>
+    void WorkStealingThreadPool::run_range(std::shared_ptr<Job> job, Index begin, Index end, Index leaf_size) {
+        // Peel off the upper half until a leaf remains; pushed halves land on this worker's
+        // deque where idle workers steal them, largest first
+        while (end - begin > leaf_size) {
+            Index mid = static_cast<Index>(begin + (end - begin) / 2);
+            job->add_chunks(1);
+            push_task([this, job, mid, end, leaf_size]() { run_range(job, mid, end, leaf_size); });
+            end = mid;
+        }
+
+        job->run_chunk([&]() {
+            for (Index i = begin; i < end; ++i) {
+                job->fn(i);
+            }
+        });
+    }
+
+    template<typename F>
+    void TaskGroup::spawn(F&& f) {
+        if (pool_.shutdown_.load()) {
+            throw std::runtime_error("Cannot spawn task on shutdown thread pool");
+        }
+
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        // If the push fails, the closure is destroyed with its ticket, which cancels the child
+        pool_.push_task([ticket = ChildTicket(this), func = std::forward<F>(f)]() mutable {
+            try {
+                func();
+            } catch (...) {
+                ticket.group()->record_exception(std::current_exception());
+            }
+            ticket.complete();
+        });
+    }
+
 } // namespace CppVerseHub::Concurrency
 
 #endif // THREADPOOL_HPP
\ No newline at end of file
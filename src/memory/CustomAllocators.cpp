@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <numeric>
 #include <iomanip>
+#include <list>
 
 namespace CppVerseHub::Memory {
 
@@ -175,6 +176,7 @@ namespace CppVerseHub::Memory {
         std::cout << "\n=== Allocator Performance Demonstration ===\n";
         
         AllocatorBenchmark::compare_allocators(1000);
+        AllocatorBenchmark::compare_pmr_resources(1000);
     }
 
     void CustomAllocatorDemo::demonstrateSTLContainersWithCustomAllocators() {
@@ -223,6 +225,47 @@ namespace CppVerseHub::Memory {
         TrackingAllocator<int>::print_statistics();
     }
 
+    void CustomAllocatorDemo::demonstratePmrResources() {
+        std::cout << "\n=== PMR Memory Resource Adapters ===\n";
+        
+        MonotonicAllocator<1024> arena;
+        MonotonicAllocatorResource<1024> frame_resource(arena);
+        
+        // Per-frame containers: allocation is a pointer bump, teardown is one reset
+        for (int frame = 0; frame < 3; ++frame) {
+            {
+                std::pmr::vector<int> values(&frame_resource);
+                std::pmr::unordered_map<int, std::pmr::string> names(&frame_resource);
+                
+                for (int i = 0; i < 20; ++i) {
+                    values.push_back(i * frame);
+                    names.emplace(i, "Entity number " + std::to_string(i) + " of frame " + std::to_string(frame));
+                }
+                
+                std::cout << "Frame " << frame << ": " << values.size() << " values, "
+                          << names.size() << " names, arena holds "
+                          << arena.total_allocated() << " bytes\n";
+            }
+            frame_resource.release();
+        }
+        frame_resource.print_statistics("MonotonicAllocator");
+        
+        // Chaining: a small pool in front of the frame arena
+        PoolAllocator<64, 16> pool;
+        PoolAllocatorResource<64, 16> pool_resource(pool, &frame_resource);
+        {
+            std::pmr::list<int> nodes(&pool_resource);
+            for (int i = 0; i < 32; ++i) {
+                nodes.push_back(i);
+            }
+            std::cout << "List of " << nodes.size() << " nodes: " << pool.allocated_count()
+                      << " from the pool, " << pool_resource.statistics().upstream_allocations
+                      << " from the arena upstream\n";
+        }
+        frame_resource.release();
+        pool_resource.print_statistics("PoolAllocator");
+    }
+
     void CustomAllocatorDemo::runAllDemonstrations() {
         std::cout << "\n========== CUSTOM ALLOCATOR COMPREHENSIVE DEMO ==========\n";
         
@@ -231,6 +274,7 @@ namespace CppVerseHub::Memory {
         demonstrateTrackingAllocator();
         demonstrateMonotonicAllocator();
         demonstrateSTLContainersWithCustomAllocators();
+        demonstratePmrResources();
         demonstrateAllocatorPerformance();
         
         std::cout << "\n========== CUSTOM ALLOCATOR DEMO COMPLETE ==========\n";
@@ -442,6 +486,153 @@ namespace CppVerseHub::Memory {
                   << std::setw(15) << (stack_result.total_memory / 1024) << "\n";
     }
 
+    AllocatorBenchmark::BenchmarkResult 
+    AllocatorBenchmark::benchmark_pmr_vector(const AllocationPattern& pattern, size_t iterations,
+                                             std::pmr::memory_resource* resource,
+                                             const std::function<void()>& end_of_frame) {
+        auto start = std::chrono::high_resolution_clock::now();
+        size_t total_memory = 0;
+        
+        for (size_t iter = 0; iter < iterations; ++iter) {
+            {
+                // The inner vectors pick up the resource through uses-allocator construction
+                std::pmr::vector<std::pmr::vector<char>> blocks(resource);
+                
+                for (size_t i = 0; i < pattern.sizes.size(); ++i) {
+                    blocks.emplace_back(pattern.sizes[i], static_cast<char>(i));
+                    total_memory += pattern.sizes[i];
+                    
+                    if (pattern.deallocate_immediately[i]) {
+                        blocks.pop_back();
+                    }
+                }
+            }
+            
+            if (end_of_frame) end_of_frame();
+        }
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        auto total_time = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        
+        return {
+            total_time,
+            total_time / (iterations * pattern.sizes.size()),
+            total_time / (iterations * pattern.sizes.size()),
+            total_memory,
+            0
+        };
+    }
+
+    AllocatorBenchmark::BenchmarkResult 
+    AllocatorBenchmark::benchmark_pmr_unordered_map(const AllocationPattern& pattern, size_t iterations,
+                                                    std::pmr::memory_resource* resource,
+                                                    const std::function<void()>& end_of_frame) {
+        auto start = std::chrono::high_resolution_clock::now();
+        size_t total_memory = 0;
+        
+        for (size_t iter = 0; iter < iterations; ++iter) {
+            {
+                std::pmr::unordered_map<size_t, std::pmr::string> entries(resource);
+                
+                for (size_t i = 0; i < pattern.sizes.size(); ++i) {
+                    entries.try_emplace(i, pattern.sizes[i], 'x');
+                    total_memory += pattern.sizes[i];
+                    
+                    if (pattern.deallocate_immediately[i]) {
+                        entries.erase(i);
+                    }
+                }
+            }
+            
+            if (end_of_frame) end_of_frame();
+        }
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        auto total_time = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        
+        return {
+            total_time,
+            total_time / (iterations * pattern.sizes.size()),
+            total_time / (iterations * pattern.sizes.size()),
+            total_memory,
+            0
+        };
+    }
+
+    void AllocatorBenchmark::compare_pmr_resources(size_t iterations) {
+        std::cout << "\n=== PMR Container Workloads ===\n";
+        
+        auto pattern = create_mixed_pattern(100);
+        
+        std::cout << "Running pmr::vector and pmr::unordered_map frames with "
+                  << iterations << " iterations...\n";
+        
+        std::cout << "\nResults:\n";
+        std::cout << std::setw(24) << "Resource" 
+                  << std::setw(18) << "Vector (ns/op)" 
+                  << std::setw(18) << "Map (ns/op)" 
+                  << std::setw(20) << "Upstream allocs" << "\n";
+        
+        auto print_row = [](const char* name, const BenchmarkResult& vector_result,
+                            const BenchmarkResult& map_result, const std::string& upstream) {
+            std::cout << std::setw(24) << name 
+                      << std::setw(18) << vector_result.avg_allocation_time.count()
+                      << std::setw(18) << map_result.avg_allocation_time.count()
+                      << std::setw(20) << upstream << "\n";
+        };
+        
+        auto run_std = [&](const char* name, std::pmr::memory_resource* resource,
+                           const std::function<void()>& end_of_frame) {
+            auto vector_result = benchmark_pmr_vector(pattern, iterations, resource, end_of_frame);
+            auto map_result = benchmark_pmr_unordered_map(pattern, iterations, resource, end_of_frame);
+            print_row(name, vector_result, map_result, "-");
+        };
+        
+        auto run_adapter = [&](const char* name, AllocatorResource& resource,
+                               const std::function<void()>& end_of_frame) {
+            auto vector_result = benchmark_pmr_vector(pattern, iterations, &resource, end_of_frame);
+            auto map_result = benchmark_pmr_unordered_map(pattern, iterations, &resource, end_of_frame);
+            print_row(name, vector_result, map_result,
+                      std::to_string(resource.statistics().upstream_allocations));
+        };
+        
+        run_std("new_delete_resource", std::pmr::new_delete_resource(), {});
+        
+        {
+            std::pmr::unsynchronized_pool_resource resource;
+            run_std("unsynchronized_pool", &resource, {});
+        }
+        
+        {
+            std::pmr::monotonic_buffer_resource resource;
+            run_std("monotonic_buffer", &resource, [&]() { resource.release(); });
+        }
+        
+        {
+            auto allocator = std::make_unique<StackAllocator<65536>>();
+            StackAllocatorResource<65536> resource(*allocator);
+            run_adapter("StackAllocator", resource, [&]() { resource.release(); });
+        }
+        
+        {
+            MonotonicAllocator<16384> allocator;
+            MonotonicAllocatorResource<16384> resource(allocator);
+            run_adapter("MonotonicAllocator", resource, [&]() { resource.release(); });
+        }
+        
+        {
+            auto allocator = std::make_unique<PoolAllocator<64, 1000>>();
+            PoolAllocatorResource<64, 1000> resource(*allocator);
+            run_adapter("PoolAllocator", resource, {});
+        }
+        
+        {
+            SmallObjectAllocator<256, 4096> allocator;
+            SmallObjectAllocatorResource<256, 4096> resource(allocator);
+            run_adapter("SmallObjectAllocator", resource, {});
+        }
+    }
+
     AllocatorBenchmark::AllocationPattern 
     AllocatorBenchmark::create_random_pattern(size_t count) {
         AllocationPattern pattern;
@@ -486,6 +677,16 @@ namespace CppVerseHub::Memory {
         return pattern;
     }
 
+    void AllocatorResource::print_statistics(const std::string& name) const {
+        std::cout << "\n=== " << name << " Resource Statistics ===\n";
+        std::cout << "Allocations: " << stats_.allocations << "\n";
+        std::cout << "Deallocations: " << stats_.deallocations << "\n";
+        std::cout << "Bytes allocated: " << stats_.bytes_allocated << "\n";
+        std::cout << "Bytes in use: " << stats_.bytes_in_use() << "\n";
+        std::cout << "Peak bytes in use: " << stats_.peak_bytes_in_use << "\n";
+        std::cout << "Upstream allocations: " << stats_.upstream_allocations << "\n";
+    }
+
     // AllocatorUtils implementations
     namespace AllocatorUtils {
         
@@ -4,7 +4,8 @@
  * @details File location: src/memory/CustomAllocators.hpp
  * 
  * This file demonstrates various custom allocator implementations including
- * stack allocators, pool allocators, and tracking allocators.
+ * stack allocators, pool allocators, and tracking allocators, together with
+ * std::pmr::memory_resource adapters that plug them into pmr containers.
  */
 
 #ifndef CUSTOM_ALLOCATORS_HPP
@@ -23,6 +24,25 @@
 #include <unordered_map>
 #include <mutex>
 #include <atomic>
+#include <functional>
+#include <string>
+#include <memory_resource>
+
+/**
+ * @brief Per-operation tracing switch, shared with MemoryPools.hpp
+ * @details See CPPVERSEHUB_MEMORY_POOL_LOGGING in MemoryPools.hpp.
+ */
+#ifndef CPPVERSEHUB_MEMORY_POOL_LOGGING
+#define CPPVERSEHUB_MEMORY_POOL_LOGGING 1
+#endif
+
+#ifndef MEMORY_POOL_LOG
+#if CPPVERSEHUB_MEMORY_POOL_LOGGING
+#define MEMORY_POOL_LOG(stream_expr) do { std::cout << stream_expr; } while (0)
+#else
+#define MEMORY_POOL_LOG(stream_expr) do { } while (0)
+#endif
+#endif
 
 namespace CppVerseHub::Memory {
 
@@ -37,18 +57,30 @@ namespace CppVerseHub::Memory {
         StackAllocator() : top_(0) {}
 
         void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+            void* result = try_allocate(size, alignment);
+            if (!result) {
+                throw std::bad_alloc{};
+            }
+            return result;
+        }
+
+        /**
+         * @brief Allocate without throwing
+         * @return nullptr if the remaining stack space cannot hold the request
+         */
+        void* try_allocate(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
             // Align the allocation
             size_t aligned_top = align(top_, alignment);
             
-            if (aligned_top + size > Size) {
-                throw std::bad_alloc{};
+            if (aligned_top > Size || size > Size - aligned_top) {
+                return nullptr;
             }
             
             void* result = buffer_ + aligned_top;
             top_ = aligned_top + size;
             
-            std::cout << "StackAllocator: Allocated " << size 
-                      << " bytes at offset " << aligned_top << "\n";
+            MEMORY_POOL_LOG("StackAllocator: Allocated " << size 
+                            << " bytes at offset " << aligned_top << "\n");
             
             return result;
         }
@@ -57,16 +89,20 @@ namespace CppVerseHub::Memory {
             // Stack allocator: can only deallocate in reverse order
             if (static_cast<char*>(ptr) + size == buffer_ + top_) {
                 top_ -= size;
-                std::cout << "StackAllocator: Deallocated " << size 
-                          << " bytes, top now at " << top_ << "\n";
+                MEMORY_POOL_LOG("StackAllocator: Deallocated " << size 
+                                << " bytes, top now at " << top_ << "\n");
             } else {
-                std::cout << "StackAllocator: Cannot deallocate out of order!\n";
+                MEMORY_POOL_LOG("StackAllocator: Cannot deallocate out of order!\n");
             }
         }
 
         void reset() {
             top_ = 0;
-            std::cout << "StackAllocator: Reset to beginning\n";
+            MEMORY_POOL_LOG("StackAllocator: Reset to beginning\n");
+        }
+
+        bool owns(const void* ptr) const {
+            return ptr >= buffer_ && ptr < buffer_ + Size;
         }
 
         size_t bytes_used() const { return top_; }
@@ -104,8 +140,8 @@ namespace CppVerseHub::Memory {
             free_head_ = reinterpret_cast<Block*>(buffer_);
             allocated_count_ = 0;
             
-            std::cout << "PoolAllocator: Initialized with " << BlockCount 
-                      << " blocks of " << BlockSize << " bytes each\n";
+            MEMORY_POOL_LOG("PoolAllocator: Initialized with " << BlockCount 
+                            << " blocks of " << BlockSize << " bytes each\n");
         }
 
         void* allocate() {
@@ -117,8 +153,8 @@ namespace CppVerseHub::Memory {
             free_head_ = free_head_->next;
             ++allocated_count_;
 
-            std::cout << "PoolAllocator: Allocated block (" 
-                      << allocated_count_ << "/" << BlockCount << " used)\n";
+            MEMORY_POOL_LOG("PoolAllocator: Allocated block (" 
+                            << allocated_count_ << "/" << BlockCount << " used)\n");
 
             return result;
         }
@@ -132,8 +168,8 @@ namespace CppVerseHub::Memory {
             free_head_ = block;
             --allocated_count_;
 
-            std::cout << "PoolAllocator: Deallocated block (" 
-                      << allocated_count_ << "/" << BlockCount << " used)\n";
+            MEMORY_POOL_LOG("PoolAllocator: Deallocated block (" 
+                            << allocated_count_ << "/" << BlockCount << " used)\n");
         }
 
         bool is_from_pool(void* ptr) const {
@@ -192,7 +228,7 @@ namespace CppVerseHub::Memory {
                 allocations_[result] = bytes;
                 total_allocated_ += bytes;
                 ++allocation_count_;
-                peak_usage_ = std::max(peak_usage_, total_allocated_ - total_deallocated_);
+                peak_usage_ = std::max<size_t>(peak_usage_, total_allocated_ - total_deallocated_);
             }
 
             std::cout << "TrackingAllocator: Allocated " << bytes << " bytes for " 
@@ -300,43 +336,54 @@ namespace CppVerseHub::Memory {
             size_t used;
             std::unique_ptr<Chunk> next;
 
-            Chunk() : memory(std::make_unique<char[]>(ChunkSize)), used(0) {}
+            Chunk() : memory(std::make_unique_for_overwrite<char[]>(ChunkSize)), used(0) {}
         };
 
     public:
         MonotonicAllocator() : current_chunk_(std::make_unique<Chunk>()) {
-            std::cout << "MonotonicAllocator: Initialized with chunk size " 
-                      << ChunkSize << "\n";
+            MEMORY_POOL_LOG("MonotonicAllocator: Initialized with chunk size " 
+                            << ChunkSize << "\n");
         }
 
+        /**
+         * @brief Bump-allocate from the current chunk
+         * @details Requests larger than ChunkSize can never fit and throw
+         * std::bad_alloc. Chunk memory is aligned to alignof(std::max_align_t).
+         */
         void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
-            size_t aligned_size = align(size, alignment);
+            if (size > ChunkSize) {
+                throw std::bad_alloc{};
+            }
+
+            size_t offset = align(current_chunk_->used, alignment);
             
             // Check if current chunk has enough space
-            if (current_chunk_->used + aligned_size > ChunkSize) {
+            if (offset + size > ChunkSize) {
                 // Need a new chunk
                 auto new_chunk = std::make_unique<Chunk>();
                 new_chunk->next = std::move(current_chunk_);
                 current_chunk_ = std::move(new_chunk);
+                offset = 0;
                 
-                std::cout << "MonotonicAllocator: Allocated new chunk\n";
+                MEMORY_POOL_LOG("MonotonicAllocator: Allocated new chunk\n");
             }
 
-            void* result = current_chunk_->memory.get() + current_chunk_->used;
-            current_chunk_->used += aligned_size;
-            total_allocated_ += aligned_size;
+            void* result = current_chunk_->memory.get() + offset;
+            total_allocated_ += offset + size - current_chunk_->used;
+            current_chunk_->used = offset + size;
 
-            std::cout << "MonotonicAllocator: Allocated " << size 
-                      << " bytes (aligned to " << aligned_size << ")\n";
+            MEMORY_POOL_LOG("MonotonicAllocator: Allocated " << size 
+                            << " bytes at offset " << offset << "\n");
 
             return result;
         }
 
-        // No individual deallocation - only reset all
+        // No individual deallocation - only reset all; the current chunk is kept for reuse
         void reset() {
-            current_chunk_ = std::make_unique<Chunk>();
+            current_chunk_->next.reset();
+            current_chunk_->used = 0;
             total_allocated_ = 0;
-            std::cout << "MonotonicAllocator: Reset all allocations\n";
+            MEMORY_POOL_LOG("MonotonicAllocator: Reset all allocations\n");
         }
 
         size_t total_allocated() const { return total_allocated_; }
@@ -370,6 +417,7 @@ namespace CppVerseHub::Memory {
         void demonstrateMonotonicAllocator();
         void demonstrateAllocatorPerformance();
         void demonstrateSTLContainersWithCustomAllocators();
+        void demonstratePmrResources();
         
         void runAllDemonstrations();
 
@@ -406,6 +454,23 @@ namespace CppVerseHub::Memory {
             const AllocationPattern& pattern, size_t iterations);
 
         static void compare_allocators(size_t iterations = 1000);
+
+        /**
+         * @brief Per-frame pmr container workloads on the given resource
+         * @details Each iteration builds and destroys its containers, then
+         * calls end_of_frame (e.g. to release an arena).
+         */
+        static BenchmarkResult benchmark_pmr_vector(
+            const AllocationPattern& pattern, size_t iterations,
+            std::pmr::memory_resource* resource,
+            const std::function<void()>& end_of_frame = {});
+
+        static BenchmarkResult benchmark_pmr_unordered_map(
+            const AllocationPattern& pattern, size_t iterations,
+            std::pmr::memory_resource* resource,
+            const std::function<void()>& end_of_frame = {});
+
+        static void compare_pmr_resources(size_t iterations = 1000);
         
         static AllocationPattern create_random_pattern(size_t count);
         static AllocationPattern create_sequential_pattern(size_t count, size_t size);
@@ -514,11 +579,25 @@ namespace CppVerseHub::Memory {
                 return std::malloc(size); // Fall back to standard allocator
             }
 
-            size_t pool_index = (size - 1) / sizeof(void*);
-            Pool& pool = *pools_[pool_index];
+            void* result = try_allocate(size);
+            if (!result) {
+                throw std::bad_alloc{};
+            }
+            return result;
+        }
 
+        /**
+         * @brief Allocate from the size-class pool without throwing
+         * @return nullptr if size exceeds MaxObjectSize or the pool is exhausted
+         */
+        void* try_allocate(size_t size) noexcept {
+            if (size > MaxObjectSize) {
+                return nullptr;
+            }
+
+            Pool& pool = *pools_[pool_index(size)];
             if (!pool.free_list) {
-                throw std::bad_alloc{};
+                return nullptr;
             }
 
             void* result = pool.free_list;
@@ -527,14 +606,31 @@ namespace CppVerseHub::Memory {
             return result;
         }
 
+        /**
+         * @brief Whether ptr is a block of the pool serving size
+         */
+        bool owns(const void* ptr, size_t size) const {
+            if (size > MaxObjectSize) {
+                return false;
+            }
+            const Pool& pool = *pools_[pool_index(size)];
+            return ptr >= pool.memory && ptr < pool.memory + PoolSize;
+        }
+
+        /**
+         * @brief Size of the block that serves a request of size bytes
+         */
+        static constexpr size_t block_size(size_t size) {
+            return (pool_index(size) + 1) * sizeof(void*);
+        }
+
         void deallocate(void* ptr, size_t size) {
             if (size > MaxObjectSize) {
                 std::free(ptr);
                 return;
             }
 
-            size_t pool_index = (size - 1) / sizeof(void*);
-            Pool& pool = *pools_[pool_index];
+            Pool& pool = *pools_[pool_index(size)];
 
             *static_cast<void**>(ptr) = pool.free_list;
             pool.free_list = ptr;
@@ -542,6 +638,263 @@ namespace CppVerseHub::Memory {
 
     private:
         std::unique_ptr<Pool> pools_[NumPools];
+
+        static constexpr size_t pool_index(size_t size) {
+            return size == 0 ? 0 : (size - 1) / sizeof(void*);
+        }
+    };
+
+    /**
+     * @struct ResourceStatistics
+     * @brief Counters kept by every allocator memory resource
+     */
+    struct ResourceStatistics {
+        size_t allocations = 0;
+        size_t deallocations = 0;
+        size_t bytes_allocated = 0;
+        size_t bytes_deallocated = 0;
+        size_t peak_bytes_in_use = 0;
+        size_t upstream_allocations = 0;    ///< Requests the allocator could not serve
+
+        size_t bytes_in_use() const { return bytes_allocated - bytes_deallocated; }
+    };
+
+    /**
+     * @class AllocatorResource
+     * @brief Common base of the std::pmr::memory_resource adapters below
+     * @details Each adapter serves what its allocator can and forwards the
+     * rest (oversized, over-aligned or exhausted requests) to an upstream
+     * resource, so chaining an adapter in front of another pmr resource gives
+     * a fast path with a general fallback. Like the allocators they wrap, the
+     * adapters are not synchronized; use one per thread or per frame.
+     */
+    class AllocatorResource : public std::pmr::memory_resource {
+    public:
+        explicit AllocatorResource(std::pmr::memory_resource* upstream)
+            : upstream_(upstream ? upstream : std::pmr::get_default_resource()) {}
+
+        std::pmr::memory_resource* upstream_resource() const noexcept { return upstream_; }
+
+        const ResourceStatistics& statistics() const noexcept { return stats_; }
+        void reset_statistics() noexcept { stats_ = ResourceStatistics{}; }
+        void print_statistics(const std::string& name) const;
+
+    protected:
+        void* allocate_upstream(size_t bytes, size_t alignment) {
+            void* result = upstream_->allocate(bytes, alignment);
+            ++stats_.upstream_allocations;
+            return result;
+        }
+
+        void deallocate_upstream(void* ptr, size_t bytes, size_t alignment) {
+            upstream_->deallocate(ptr, bytes, alignment);
+        }
+
+        void record_allocation(size_t bytes) noexcept {
+            ++stats_.allocations;
+            stats_.bytes_allocated += bytes;
+            stats_.peak_bytes_in_use = std::max(stats_.peak_bytes_in_use, stats_.bytes_in_use());
+        }
+
+        void record_deallocation(size_t bytes) noexcept {
+            ++stats_.deallocations;
+            stats_.bytes_deallocated += bytes;
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+
+    private:
+        std::pmr::memory_resource* upstream_;
+        ResourceStatistics stats_;
+    };
+
+    /**
+     * @class StackAllocatorResource
+     * @brief std::pmr::memory_resource over a StackAllocator
+     * @details Deallocations in LIFO order give the space back; any other
+     * order leaves it in place until release() resets the stack, which makes
+     * this a per-frame scratch arena for pmr containers. Requests that do not
+     * fit go upstream.
+     */
+    template<size_t Size>
+    class StackAllocatorResource : public AllocatorResource {
+    public:
+        explicit StackAllocatorResource(StackAllocator<Size>& allocator,
+                                        std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : AllocatorResource(upstream), allocator_(allocator) {}
+
+        /**
+         * @brief Reset the stack; every block it handed out becomes invalid
+         */
+        void release() { allocator_.reset(); }
+
+        StackAllocator<Size>& allocator() noexcept { return allocator_; }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            bytes = std::max<size_t>(bytes, 1);
+            void* result = nullptr;
+            if (alignment <= alignof(std::max_align_t)) {
+                result = allocator_.try_allocate(bytes, alignment);
+            }
+            if (!result) {
+                result = allocate_upstream(bytes, alignment);
+            }
+            record_allocation(bytes);
+            return result;
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+            bytes = std::max<size_t>(bytes, 1);
+            if (allocator_.owns(ptr)) {
+                allocator_.deallocate(ptr, bytes);
+            } else {
+                deallocate_upstream(ptr, bytes, alignment);
+            }
+            record_deallocation(bytes);
+        }
+
+    private:
+        StackAllocator<Size>& allocator_;
+    };
+
+    /**
+     * @class PoolAllocatorResource
+     * @brief std::pmr::memory_resource over a PoolAllocator
+     * @details Requests of up to BlockSize bytes take a block while the pool
+     * has one left; larger or over-aligned requests and those made while the
+     * pool is empty go upstream.
+     */
+    template<size_t BlockSize, size_t BlockCount>
+    class PoolAllocatorResource : public AllocatorResource {
+    public:
+        explicit PoolAllocatorResource(PoolAllocator<BlockSize, BlockCount>& allocator,
+                                       std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : AllocatorResource(upstream), allocator_(allocator) {}
+
+        PoolAllocator<BlockSize, BlockCount>& allocator() noexcept { return allocator_; }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            void* result = (bytes <= BlockSize && alignment <= BlockAlignment &&
+                            allocator_.available_count() > 0)
+                ? allocator_.allocate()
+                : allocate_upstream(bytes, alignment);
+            record_allocation(bytes);
+            return result;
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+            if (allocator_.is_from_pool(ptr)) {
+                allocator_.deallocate(ptr);
+            } else {
+                deallocate_upstream(ptr, bytes, alignment);
+            }
+            record_deallocation(bytes);
+        }
+
+    private:
+        // Blocks sit at multiples of BlockSize from a max_align_t-aligned buffer
+        static constexpr size_t BlockAlignment =
+            std::min(alignof(std::max_align_t), BlockSize & (~BlockSize + 1));
+
+        PoolAllocator<BlockSize, BlockCount>& allocator_;
+    };
+
+    /**
+     * @class MonotonicAllocatorResource
+     * @brief std::pmr::memory_resource over a MonotonicAllocator
+     * @details Deallocation of arena memory is a no-op; release() drops the
+     * whole arena at once, so per-frame pmr::vector/unordered_map instances
+     * cost a pointer bump per allocation. Requests larger than ChunkSize or
+     * over-aligned ones are served and freed by the upstream resource.
+     */
+    template<size_t ChunkSize = 4096>
+    class MonotonicAllocatorResource : public AllocatorResource {
+    public:
+        explicit MonotonicAllocatorResource(MonotonicAllocator<ChunkSize>& allocator,
+                                            std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : AllocatorResource(upstream), allocator_(allocator) {}
+
+        /**
+         * @brief Reset the arena; every block it handed out becomes invalid
+         */
+        void release() { allocator_.reset(); }
+
+        MonotonicAllocator<ChunkSize>& allocator() noexcept { return allocator_; }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            void* result = from_arena(bytes, alignment)
+                ? allocator_.allocate(bytes, alignment)
+                : allocate_upstream(bytes, alignment);
+            record_allocation(bytes);
+            return result;
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+            if (!from_arena(bytes, alignment)) {
+                deallocate_upstream(ptr, bytes, alignment);
+            }
+            record_deallocation(bytes);
+        }
+
+    private:
+        MonotonicAllocator<ChunkSize>& allocator_;
+
+        static bool from_arena(size_t bytes, size_t alignment) noexcept {
+            return bytes <= ChunkSize && alignment <= alignof(std::max_align_t);
+        }
+    };
+
+    /**
+     * @class SmallObjectAllocatorResource
+     * @brief std::pmr::memory_resource over a SmallObjectAllocator
+     * @details Small requests take a block from their size-class pool; large
+     * or over-aligned requests, and small ones whose pool is exhausted, go
+     * upstream.
+     */
+    template<size_t MaxObjectSize = 256, size_t PoolSize = 4096>
+    class SmallObjectAllocatorResource : public AllocatorResource {
+    public:
+        explicit SmallObjectAllocatorResource(SmallObjectAllocator<MaxObjectSize, PoolSize>& allocator,
+                                              std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : AllocatorResource(upstream), allocator_(allocator) {}
+
+        SmallObjectAllocator<MaxObjectSize, PoolSize>& allocator() noexcept { return allocator_; }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            void* result = nullptr;
+            if (alignment <= block_alignment(bytes)) {
+                result = allocator_.try_allocate(bytes);
+            }
+            if (!result) {
+                result = allocate_upstream(bytes, alignment);
+            }
+            record_allocation(bytes);
+            return result;
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+            if (allocator_.owns(ptr, bytes)) {
+                allocator_.deallocate(ptr, bytes);
+            } else {
+                deallocate_upstream(ptr, bytes, alignment);
+            }
+            record_deallocation(bytes);
+        }
+
+    private:
+        SmallObjectAllocator<MaxObjectSize, PoolSize>& allocator_;
+
+        // Pool memory comes from new[]; blocks sit at multiples of their size
+        static constexpr size_t block_alignment(size_t bytes) {
+            size_t block = SmallObjectAllocator<MaxObjectSize, PoolSize>::block_size(bytes);
+            return std::min<size_t>(__STDCPP_DEFAULT_NEW_ALIGNMENT__, block & (~block + 1));
+        }
     };
 
 } // namespace CppVerseHub::Memory
@@ -25,31 +25,117 @@
 #include <chrono>
 #include <type_traits>
 #include <bitset>
+#include <cstdint>
+#include <new>
+#include <cstdlib>
+
+/**
+ * Per-operation tracing in the pools. On by default so the demonstrations show
+ * every allocation; production and benchmark builds define this to 0, which
+ * compiles the tracing out of the allocation paths entirely.
+ */
+#ifndef CPPVERSEHUB_MEMORY_POOL_LOGGING
+#define CPPVERSEHUB_MEMORY_POOL_LOGGING 1
+#endif
+
+#if CPPVERSEHUB_MEMORY_POOL_LOGGING
+#define MEMORY_POOL_LOG(stream_expr) do { std::cout << stream_expr; } while (0)
+#else
+#define MEMORY_POOL_LOG(stream_expr) do { } while (0)
+#endif
 
 namespace CppVerseHub::Memory {
 
+    /**
+     * @class ChunkPageMap
+     * @brief Constant-time map from any address inside a pool chunk to its chunk
+     *
+     * Chunk memory is allocated aligned to PageSize (see allocate()), so every
+     * page a chunk touches belongs to that chunk alone. Each page number is
+     * registered in a hash map; a lookup is one shift, one probe and a bounds
+     * check, independent of how many chunks the pool owns.
+     */
+    template<typename Chunk, size_t PageSize>
+    class ChunkPageMap {
+        static_assert((PageSize & (PageSize - 1)) == 0, "Page size must be a power of two");
+
+    public:
+        static char* allocate(size_t bytes) {
+            return static_cast<char*>(::operator new(bytes, std::align_val_t(PageSize)));
+        }
+
+        static void release(char* data) {
+            ::operator delete(data, std::align_val_t(PageSize));
+        }
+
+        void insert(const char* data, size_t bytes, Chunk* chunk) {
+            for (uintptr_t page = page_of(data); page <= page_of(data + bytes - 1); ++page) {
+                pages_[page] = chunk;
+            }
+        }
+
+        void erase(const char* data, size_t bytes) {
+            for (uintptr_t page = page_of(data); page <= page_of(data + bytes - 1); ++page) {
+                pages_.erase(page);
+            }
+        }
+
+        Chunk* find(const void* ptr) const {
+            auto it = pages_.find(page_of(ptr));
+            return it == pages_.end() ? nullptr : it->second;
+        }
+
+    private:
+        std::unordered_map<uintptr_t, Chunk*> pages_;
+
+        static uintptr_t page_of(const void* ptr) {
+            return reinterpret_cast<uintptr_t>(ptr) / PageSize;
+        }
+    };
+
+    /// Page granularity for a chunk of `bytes`: the smallest power of two that
+    /// covers it, capped at 4 KiB and never below max_align_t's alignment
+    constexpr size_t chunk_page_size(size_t bytes) {
+        size_t page = alignof(std::max_align_t);
+        while (page < bytes && page < 4096) {
+            page <<= 1;
+        }
+        return page;
+    }
+
     /**
      * @class FixedSizePool
      * @brief Memory pool for fixed-size allocations with O(1) allocation/deallocation
+     *
+     * The owning chunk of a freed block is found through a ChunkPageMap, so
+     * deallocation cost does not grow with the number of chunks. Chunks that
+     * become entirely free are handed back to the system once more than
+     * `free_chunk_high_water` of them are idle.
      */
     template<size_t BlockSize, size_t PoolSize = 4096>
     class FixedSizePool {
     private:
         static constexpr size_t BlocksPerChunk = PoolSize / BlockSize;
         static_assert(BlocksPerChunk > 0, "Block size too large for pool size");
+        static constexpr size_t NotAvailable = static_cast<size_t>(-1);
 
         struct FreeBlock {
             FreeBlock* next;
         };
 
+        struct MemoryChunk;
+        using PageMap = ChunkPageMap<MemoryChunk, chunk_page_size(PoolSize)>;
+
         struct MemoryChunk {
-            alignas(std::max_align_t) char data[PoolSize];
+            char* data;
             std::bitset<BlocksPerChunk> allocation_mask;
             size_t free_count;
             FreeBlock* free_list;
-            std::unique_ptr<MemoryChunk> next_chunk;
+            size_t index;            // position in chunks_
+            size_t available_index;  // position in available_chunks_
 
-            MemoryChunk() : free_count(BlocksPerChunk), free_list(nullptr) {
+            MemoryChunk() : data(PageMap::allocate(PoolSize)), free_count(BlocksPerChunk),
+                            free_list(nullptr), index(0), available_index(NotAvailable) {
                 // Initialize free list
                 for (size_t i = 0; i < BlocksPerChunk; ++i) {
                     FreeBlock* block = reinterpret_cast<FreeBlock*>(&data[i * BlockSize]);
@@ -59,39 +145,193 @@ namespace CppVerseHub::Memory {
                     if (i == 0) free_list = block;
                 }
             }
+
+            ~MemoryChunk() {
+                PageMap::release(data);
+            }
+
+            MemoryChunk(const MemoryChunk&) = delete;
+            MemoryChunk& operator=(const MemoryChunk&) = delete;
         };
 
     public:
-        FixedSizePool() : head_chunk_(std::make_unique<MemoryChunk>()), 
-                         total_allocated_(0), total_chunks_(1) {
-            std::cout << "FixedSizePool: Created pool with block size " << BlockSize 
-                      << ", blocks per chunk: " << BlocksPerChunk << "\n";
+        static constexpr size_t DefaultFreeChunkHighWater = 8;
+
+        explicit FixedSizePool(size_t free_chunk_high_water = DefaultFreeChunkHighWater)
+            : total_allocated_(0), free_chunks_(0), released_chunks_(0),
+              free_chunk_high_water_(free_chunk_high_water) {
+            add_chunk();
+            ++free_chunks_;
+            MEMORY_POOL_LOG("FixedSizePool: Created pool with block size " << BlockSize 
+                            << ", blocks per chunk: " << BlocksPerChunk << "\n");
         }
 
         ~FixedSizePool() {
-            std::cout << "FixedSizePool: Destroyed pool with " << total_chunks_ 
-                      << " chunks, " << total_allocated_ << " allocations\n";
+            MEMORY_POOL_LOG("FixedSizePool: Destroyed pool with " << chunks_.size() 
+                            << " chunks, " << total_allocated_ << " allocations\n");
         }
 
+        FixedSizePool(const FixedSizePool&) = delete;
+        FixedSizePool& operator=(const FixedSizePool&) = delete;
+
         void* allocate() {
             std::lock_guard<std::mutex> lock(mutex_);
-            
+            return allocate_locked();
+        }
+
+        void deallocate(void* ptr) {
+            if (!ptr) return;
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            deallocate_locked(ptr);
+        }
+
+        /**
+         * @brief Allocate up to `count` blocks under a single lock acquisition
+         * @return Number of blocks written to `out` (always `count`; the pool grows as needed)
+         */
+        size_t allocate_batch(void** out, size_t count) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = allocate_locked();
+            }
+            return count;
+        }
+
+        /**
+         * @brief Return `count` blocks under a single lock acquisition
+         */
+        void deallocate_batch(void* const* blocks, size_t count) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t i = 0; i < count; ++i) {
+                if (blocks[i]) {
+                    deallocate_locked(blocks[i]);
+                }
+            }
+        }
+
+        /**
+         * @brief Number of entirely free chunks kept for reuse before further
+         * free chunks are returned to the system
+         */
+        void set_free_chunk_high_water(size_t chunks) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_chunk_high_water_ = chunks;
+            while (free_chunks_ > free_chunk_high_water_ && release_one_free_chunk()) {
+            }
+        }
+
+        size_t block_size() const { return BlockSize; }
+        size_t total_allocated() const { 
+            std::lock_guard<std::mutex> lock(mutex_);
+            return total_allocated_; 
+        }
+        size_t total_chunks() const { 
+            std::lock_guard<std::mutex> lock(mutex_);
+            return chunks_.size(); 
+        }
+        size_t free_chunks() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return free_chunks_;
+        }
+        size_t released_chunks() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return released_chunks_;
+        }
+
+        bool is_from_pool(void* ptr) const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return find_chunk_for_ptr(ptr) != nullptr;
+        }
+
+        void print_statistics() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::cout << "\n=== FixedSizePool Statistics ===\n";
+            std::cout << "Block size: " << BlockSize << " bytes\n";
+            std::cout << "Blocks per chunk: " << BlocksPerChunk << "\n";
+            std::cout << "Total chunks: " << chunks_.size() << "\n";
+            std::cout << "Free chunks: " << free_chunks_ << " (high-water mark "
+                      << free_chunk_high_water_ << ", " << released_chunks_ << " released)\n";
+            std::cout << "Total allocated: " << total_allocated_ << "\n";
+            std::cout << "Memory overhead: " << (chunks_.size() * (sizeof(MemoryChunk) + PoolSize)) << " bytes\n";
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector<std::unique_ptr<MemoryChunk>> chunks_;
+        // Chunks with at least one free block; allocation always takes from
+        // the back, so a chunk that fills up is popped in O(1)
+        std::vector<MemoryChunk*> available_chunks_;
+        PageMap page_map_;
+        size_t total_allocated_;
+        size_t free_chunks_;
+        size_t released_chunks_;
+        size_t free_chunk_high_water_;
+
+        MemoryChunk* add_chunk() {
+            auto chunk = std::make_unique<MemoryChunk>();
+            MemoryChunk* raw = chunk.get();
+            raw->index = chunks_.size();
+            chunks_.push_back(std::move(chunk));
+            page_map_.insert(raw->data, PoolSize, raw);
+            push_available(raw);
+            return raw;
+        }
+
+        void push_available(MemoryChunk* chunk) {
+            chunk->available_index = available_chunks_.size();
+            available_chunks_.push_back(chunk);
+        }
+
+        void remove_available(MemoryChunk* chunk) {
+            MemoryChunk* last = available_chunks_.back();
+            available_chunks_[chunk->available_index] = last;
+            last->available_index = chunk->available_index;
+            available_chunks_.pop_back();
+            chunk->available_index = NotAvailable;
+        }
+
+        void release_chunk(MemoryChunk* chunk) {
+            remove_available(chunk);
+            page_map_.erase(chunk->data, PoolSize);
+
+            size_t index = chunk->index;
+            std::swap(chunks_[index], chunks_.back());
+            chunks_[index]->index = index;
+            chunks_.pop_back();
+
+            --free_chunks_;
+            ++released_chunks_;
+        }
+
+        // Releases the free chunk nearest the front of the allocation stack,
+        // which is the one least likely to be allocated from next
+        bool release_one_free_chunk() {
+            for (MemoryChunk* chunk : available_chunks_) {
+                if (chunk->free_count == BlocksPerChunk) {
+                    release_chunk(chunk);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void* allocate_locked() {
             // Find chunk with available blocks
             MemoryChunk* chunk = find_available_chunk();
             if (!chunk) {
-                // Create new chunk
-                auto new_chunk = std::make_unique<MemoryChunk>();
-                new_chunk->next_chunk = std::move(head_chunk_);
-                head_chunk_ = std::move(new_chunk);
-                chunk = head_chunk_.get();
-                ++total_chunks_;
+                chunk = add_chunk();
+            } else if (chunk->free_count == BlocksPerChunk) {
+                --free_chunks_;
             }
 
             // Allocate from chunk
             assert(chunk->free_list != nullptr);
             void* result = chunk->free_list;
             chunk->free_list = chunk->free_list->next;
-            --chunk->free_count;
+            if (--chunk->free_count == 0) {
+                remove_available(chunk);
+            }
             
             // Update allocation mask
             size_t block_index = (static_cast<char*>(result) - chunk->data) / BlockSize;
@@ -99,17 +339,13 @@ namespace CppVerseHub::Memory {
 
             ++total_allocated_;
             
-            std::cout << "FixedSizePool: Allocated block " << block_index 
-                      << " from chunk (free count: " << chunk->free_count << ")\n";
+            MEMORY_POOL_LOG("FixedSizePool: Allocated block " << block_index 
+                            << " from chunk (free count: " << chunk->free_count << ")\n");
             
             return result;
         }
 
-        void deallocate(void* ptr) {
-            if (!ptr) return;
-
-            std::lock_guard<std::mutex> lock(mutex_);
-            
+        void deallocate_locked(void* ptr) {
             MemoryChunk* chunk = find_chunk_for_ptr(ptr);
             if (!chunk) {
                 std::cout << "FixedSizePool: ERROR - Pointer not from this pool!\n";
@@ -120,7 +356,9 @@ namespace CppVerseHub::Memory {
             FreeBlock* block = static_cast<FreeBlock*>(ptr);
             block->next = chunk->free_list;
             chunk->free_list = block;
-            ++chunk->free_count;
+            if (chunk->free_count++ == 0) {
+                push_available(chunk);
+            }
 
             // Update allocation mask
             size_t block_index = (static_cast<char*>(ptr) - chunk->data) / BlockSize;
@@ -128,61 +366,24 @@ namespace CppVerseHub::Memory {
 
             --total_allocated_;
             
-            std::cout << "FixedSizePool: Deallocated block " << block_index 
-                      << " (free count: " << chunk->free_count << ")\n";
-        }
+            MEMORY_POOL_LOG("FixedSizePool: Deallocated block " << block_index 
+                            << " (free count: " << chunk->free_count << ")\n");
 
-        size_t block_size() const { return BlockSize; }
-        size_t total_allocated() const { 
-            std::lock_guard<std::mutex> lock(mutex_);
-            return total_allocated_; 
-        }
-        size_t total_chunks() const { 
-            std::lock_guard<std::mutex> lock(mutex_);
-            return total_chunks_; 
-        }
-
-        bool is_from_pool(void* ptr) const {
-            std::lock_guard<std::mutex> lock(mutex_);
-            return find_chunk_for_ptr(ptr) != nullptr;
-        }
-
-        void print_statistics() const {
-            std::lock_guard<std::mutex> lock(mutex_);
-            std::cout << "\n=== FixedSizePool Statistics ===\n";
-            std::cout << "Block size: " << BlockSize << " bytes\n";
-            std::cout << "Blocks per chunk: " << BlocksPerChunk << "\n";
-            std::cout << "Total chunks: " << total_chunks_ << "\n";
-            std::cout << "Total allocated: " << total_allocated_ << "\n";
-            std::cout << "Memory overhead: " << (total_chunks_ * sizeof(MemoryChunk)) << " bytes\n";
+            if (chunk->free_count == BlocksPerChunk && ++free_chunks_ > free_chunk_high_water_) {
+                MEMORY_POOL_LOG("FixedSizePool: Releasing free chunk (" << free_chunks_
+                                << " free, high-water mark " << free_chunk_high_water_ << ")\n");
+                release_chunk(chunk);
+            }
         }
 
-    private:
-        mutable std::mutex mutex_;
-        std::unique_ptr<MemoryChunk> head_chunk_;
-        size_t total_allocated_;
-        size_t total_chunks_;
-
         MemoryChunk* find_available_chunk() {
-            MemoryChunk* current = head_chunk_.get();
-            while (current) {
-                if (current->free_count > 0) {
-                    return current;
-                }
-                current = current->next_chunk.get();
-            }
-            return nullptr;
+            return available_chunks_.empty() ? nullptr : available_chunks_.back();
         }
 
         MemoryChunk* find_chunk_for_ptr(void* ptr) const {
-            MemoryChunk* current = head_chunk_.get();
-            while (current) {
-                char* chunk_start = current->data;
-                char* chunk_end = chunk_start + PoolSize;
-                if (ptr >= chunk_start && ptr < chunk_end) {
-                    return current;
-                }
-                current = current->next_chunk.get();
+            MemoryChunk* chunk = page_map_.find(ptr);
+            if (chunk && ptr >= chunk->data && ptr < chunk->data + BlocksPerChunk * BlockSize) {
+                return chunk;
             }
             return nullptr;
         }
@@ -191,12 +392,22 @@ namespace CppVerseHub::Memory {
     /**
      * @class VariableSizePool
      * @brief Memory pool for variable-size allocations using segregated free lists
+     *
+     * Requests are rounded up to their power-of-two size class, so any freed
+     * block can satisfy any later request of the same class. Each chunk keeps
+     * its own free list per size class and counts its live blocks; it is found
+     * from a block address through a ChunkPageMap in O(1). Chunks with free
+     * blocks of a class are linked into that class's partial list, which
+     * allocation takes from. When a chunk's last block is freed, it is
+     * unlinked from the partial lists in O(size classes) and either kept for
+     * reuse or, above `free_chunk_high_water` idle chunks, returned to the
+     * system.
      */
     class VariableSizePool {
     private:
         static constexpr size_t MinBlockSize = 16;
         static constexpr size_t MaxBlockSize = 4096;
-        static constexpr size_t NumSizeClasses = 32;
+        static constexpr size_t NumSizeClasses = 9;   // 16 B to 4 KB
         static constexpr size_t ChunkSize = 64 * 1024; // 64KB chunks
 
         struct FreeBlock {
@@ -204,69 +415,89 @@ namespace CppVerseHub::Memory {
             size_t size;
         };
 
+        struct MemoryChunk;
+        using PageMap = ChunkPageMap<MemoryChunk, chunk_page_size(ChunkSize)>;
+
         struct MemoryChunk {
             char* data;
             size_t size;
             size_t used;
-            std::unique_ptr<MemoryChunk> next;
-
-            MemoryChunk(size_t chunk_size) : size(chunk_size), used(0) {
-                data = new char[size];
-                std::cout << "VariableSizePool: Created chunk of " << size << " bytes\n";
+            size_t live_blocks;
+            size_t index;   // position in chunks_
+            FreeBlock* free_lists[NumSizeClasses] = {};
+            // Links in the per-class lists of chunks that have free blocks
+            MemoryChunk* next_partial[NumSizeClasses] = {};
+            MemoryChunk* prev_partial[NumSizeClasses] = {};
+
+            MemoryChunk(size_t chunk_size)
+                : data(PageMap::allocate(chunk_size)), size(chunk_size), used(0), live_blocks(0), index(0) {
+                MEMORY_POOL_LOG("VariableSizePool: Created chunk of " << size << " bytes\n");
             }
 
             ~MemoryChunk() {
-                delete[] data;
-                std::cout << "VariableSizePool: Destroyed chunk of " << size << " bytes\n";
+                PageMap::release(data);
+                MEMORY_POOL_LOG("VariableSizePool: Destroyed chunk of " << size << " bytes\n");
             }
+
+            MemoryChunk(const MemoryChunk&) = delete;
+            MemoryChunk& operator=(const MemoryChunk&) = delete;
         };
 
     public:
-        VariableSizePool() : total_allocated_(0), total_chunks_(0) {
-            // Initialize free lists
+        static constexpr size_t DefaultFreeChunkHighWater = 4;
+
+        explicit VariableSizePool(size_t free_chunk_high_water = DefaultFreeChunkHighWater)
+            : current_chunk_(nullptr), total_allocated_(0), released_chunks_(0),
+              free_chunk_high_water_(free_chunk_high_water) {
             for (size_t i = 0; i < NumSizeClasses; ++i) {
-                free_lists_[i] = nullptr;
+                partial_chunks_[i] = nullptr;
             }
-            std::cout << "VariableSizePool: Created with " << NumSizeClasses << " size classes\n";
+            MEMORY_POOL_LOG("VariableSizePool: Created with " << NumSizeClasses << " size classes\n");
         }
 
         ~VariableSizePool() {
-            std::cout << "VariableSizePool: Destroyed with " << total_chunks_ 
-                      << " chunks, " << total_allocated_ << " bytes allocated\n";
+            MEMORY_POOL_LOG("VariableSizePool: Destroyed with " << chunks_.size() 
+                            << " chunks, " << total_allocated_ << " bytes allocated\n");
         }
 
+        VariableSizePool(const VariableSizePool&) = delete;
+        VariableSizePool& operator=(const VariableSizePool&) = delete;
+
         void* allocate(size_t size) {
             if (size == 0) return nullptr;
             if (size > MaxBlockSize) {
                 // Fall back to standard allocation for large sizes
-                std::cout << "VariableSizePool: Large allocation " << size 
-                          << " bytes, using standard allocator\n";
+                MEMORY_POOL_LOG("VariableSizePool: Large allocation " << size 
+                                << " bytes, using standard allocator\n");
                 return std::malloc(size);
             }
 
             std::lock_guard<std::mutex> lock(mutex_);
             
-            size_t aligned_size = align_size(size);
-            size_t size_class = get_size_class(aligned_size);
-
-            // Try to allocate from free list
-            if (free_lists_[size_class]) {
-                FreeBlock* block = free_lists_[size_class];
-                free_lists_[size_class] = block->next;
+            size_t size_class = get_size_class(size);
+            size_t block_size = size_class_to_size(size_class);
+
+            // Try to allocate from a chunk's free list
+            if (MemoryChunk* chunk = partial_chunks_[size_class]) {
+                FreeBlock* block = chunk->free_lists[size_class];
+                chunk->free_lists[size_class] = block->next;
+                if (!block->next) {
+                    unlink_partial(chunk, size_class);
+                }
+                ++chunk->live_blocks;
+                total_allocated_ += block_size;
                 
-                std::cout << "VariableSizePool: Allocated " << aligned_size 
-                          << " bytes from free list (class " << size_class << ")\n";
+                MEMORY_POOL_LOG("VariableSizePool: Allocated " << block_size 
+                                << " bytes from free list (class " << size_class << ")\n");
                 
                 return block;
             }
 
             // Allocate from chunk
-            void* result = allocate_from_chunk(aligned_size);
-            if (result) {
-                total_allocated_ += aligned_size;
-                std::cout << "VariableSizePool: Allocated " << aligned_size 
-                          << " bytes from chunk\n";
-            }
+            void* result = allocate_from_chunk(block_size);
+            total_allocated_ += block_size;
+            MEMORY_POOL_LOG("VariableSizePool: Allocated " << block_size 
+                            << " bytes from chunk\n");
 
             return result;
         }
@@ -275,26 +506,53 @@ namespace CppVerseHub::Memory {
             if (!ptr) return;
             
             if (size > MaxBlockSize) {
-                std::cout << "VariableSizePool: Large deallocation, using standard deallocator\n";
+                MEMORY_POOL_LOG("VariableSizePool: Large deallocation, using standard deallocator\n");
                 std::free(ptr);
                 return;
             }
 
             std::lock_guard<std::mutex> lock(mutex_);
             
-            size_t aligned_size = align_size(size);
-            size_t size_class = get_size_class(aligned_size);
+            MemoryChunk* chunk = find_chunk_for_ptr(ptr);
+            if (!chunk) {
+                std::cout << "VariableSizePool: ERROR - Pointer not from this pool!\n";
+                return;
+            }
+
+            size_t size_class = get_size_class(size);
+            size_t block_size = size_class_to_size(size_class);
 
-            // Add to free list
+            // Add to the chunk's free list
             FreeBlock* block = static_cast<FreeBlock*>(ptr);
-            block->next = free_lists_[size_class];
-            block->size = aligned_size;
-            free_lists_[size_class] = block;
+            block->next = chunk->free_lists[size_class];
+            block->size = block_size;
+            if (!block->next) {
+                link_partial(chunk, size_class);
+            }
+            chunk->free_lists[size_class] = block;
 
-            total_allocated_ -= aligned_size;
+            total_allocated_ -= block_size;
             
-            std::cout << "VariableSizePool: Deallocated " << aligned_size 
-                      << " bytes to free list (class " << size_class << ")\n";
+            MEMORY_POOL_LOG("VariableSizePool: Deallocated " << block_size 
+                            << " bytes to free list (class " << size_class << ")\n");
+
+            if (--chunk->live_blocks == 0) {
+                retire_chunk(chunk);
+            }
+        }
+
+        /**
+         * @brief Number of entirely free chunks kept for reuse before further
+         * free chunks are returned to the system
+         */
+        void set_free_chunk_high_water(size_t chunks) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_chunk_high_water_ = chunks;
+            while (empty_chunks_.size() > free_chunk_high_water_) {
+                MemoryChunk* chunk = empty_chunks_.back();
+                empty_chunks_.pop_back();
+                release_chunk(chunk);
+            }
         }
 
         size_t total_allocated() const {
@@ -304,22 +562,34 @@ namespace CppVerseHub::Memory {
 
         size_t total_chunks() const {
             std::lock_guard<std::mutex> lock(mutex_);
-            return total_chunks_;
+            return chunks_.size();
+        }
+
+        size_t free_chunks() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return empty_chunks_.size();
+        }
+
+        size_t released_chunks() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return released_chunks_;
         }
 
         void print_statistics() const {
             std::lock_guard<std::mutex> lock(mutex_);
             std::cout << "\n=== VariableSizePool Statistics ===\n";
-            std::cout << "Total chunks: " << total_chunks_ << "\n";
+            std::cout << "Total chunks: " << chunks_.size() << "\n";
+            std::cout << "Free chunks: " << empty_chunks_.size() << " (high-water mark "
+                      << free_chunk_high_water_ << ", " << released_chunks_ << " released)\n";
             std::cout << "Total allocated: " << total_allocated_ << " bytes\n";
             
             std::cout << "Free lists:\n";
             for (size_t i = 0; i < NumSizeClasses; ++i) {
                 size_t count = 0;
-                FreeBlock* current = free_lists_[i];
-                while (current) {
-                    ++count;
-                    current = current->next;
+                for (MemoryChunk* chunk = partial_chunks_[i]; chunk; chunk = chunk->next_partial[i]) {
+                    for (FreeBlock* current = chunk->free_lists[i]; current; current = current->next) {
+                        ++count;
+                    }
                 }
                 if (count > 0) {
                     std::cout << "  Size class " << i << " (" << size_class_to_size(i) 
@@ -330,16 +600,16 @@ namespace CppVerseHub::Memory {
 
     private:
         mutable std::mutex mutex_;
-        FreeBlock* free_lists_[NumSizeClasses];
-        std::unique_ptr<MemoryChunk> head_chunk_;
+        MemoryChunk* partial_chunks_[NumSizeClasses];   // chunks with free blocks, per class
+        std::vector<std::unique_ptr<MemoryChunk>> chunks_;
+        std::vector<MemoryChunk*> empty_chunks_;   // fully free, kept for reuse
+        MemoryChunk* current_chunk_;               // chunk new blocks are carved from
+        PageMap page_map_;
         size_t total_allocated_;
-        size_t total_chunks_;
-
-        size_t align_size(size_t size) {
-            return (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
-        }
+        size_t released_chunks_;
+        size_t free_chunk_high_water_;
 
-        size_t get_size_class(size_t size) {
+        size_t get_size_class(size_t size) const {
             // Simple power-of-2 size classes
             size_t class_size = MinBlockSize;
             for (size_t i = 0; i < NumSizeClasses; ++i) {
@@ -354,34 +624,93 @@ namespace CppVerseHub::Memory {
             return NumSizeClasses - 1;
         }
 
-        size_t size_class_to_size(size_t size_class) {
+        size_t size_class_to_size(size_t size_class) const {
             return MinBlockSize << size_class;
         }
 
         void* allocate_from_chunk(size_t size) {
-            // Find chunk with enough space
-            MemoryChunk* chunk = find_chunk_with_space(size);
-            if (!chunk) {
-                // Create new chunk
-                auto new_chunk = std::make_unique<MemoryChunk>(ChunkSize);
-                new_chunk->next = std::move(head_chunk_);
-                head_chunk_ = std::move(new_chunk);
-                chunk = head_chunk_.get();
-                ++total_chunks_;
+            if (!current_chunk_ || current_chunk_->size - current_chunk_->used < size) {
+                // Reuse an idle chunk before asking the system for a new one
+                if (!empty_chunks_.empty()) {
+                    current_chunk_ = empty_chunks_.back();
+                    empty_chunks_.pop_back();
+                } else {
+                    auto new_chunk = std::make_unique<MemoryChunk>(ChunkSize);
+                    current_chunk_ = new_chunk.get();
+                    current_chunk_->index = chunks_.size();
+                    page_map_.insert(current_chunk_->data, current_chunk_->size, current_chunk_);
+                    chunks_.push_back(std::move(new_chunk));
+                }
             }
 
-            void* result = chunk->data + chunk->used;
-            chunk->used += size;
+            void* result = current_chunk_->data + current_chunk_->used;
+            current_chunk_->used += size;
+            ++current_chunk_->live_blocks;
             return result;
         }
 
-        MemoryChunk* find_chunk_with_space(size_t size) {
-            MemoryChunk* current = head_chunk_.get();
-            while (current) {
-                if (current->size - current->used >= size) {
-                    return current;
+        void link_partial(MemoryChunk* chunk, size_t size_class) {
+            MemoryChunk* head = partial_chunks_[size_class];
+            chunk->prev_partial[size_class] = nullptr;
+            chunk->next_partial[size_class] = head;
+            if (head) {
+                head->prev_partial[size_class] = chunk;
+            }
+            partial_chunks_[size_class] = chunk;
+        }
+
+        void unlink_partial(MemoryChunk* chunk, size_t size_class) {
+            MemoryChunk* prev = chunk->prev_partial[size_class];
+            MemoryChunk* next = chunk->next_partial[size_class];
+            if (prev) {
+                prev->next_partial[size_class] = next;
+            } else {
+                partial_chunks_[size_class] = next;
+            }
+            if (next) {
+                next->prev_partial[size_class] = prev;
+            }
+            chunk->prev_partial[size_class] = nullptr;
+            chunk->next_partial[size_class] = nullptr;
+        }
+
+        // The chunk's last live block was freed: drop its free lists (they
+        // only hold its own blocks) and recycle or release the chunk
+        void retire_chunk(MemoryChunk* chunk) {
+            for (size_t i = 0; i < NumSizeClasses; ++i) {
+                if (chunk->free_lists[i]) {
+                    unlink_partial(chunk, i);
+                    chunk->free_lists[i] = nullptr;
                 }
-                current = current->next.get();
+            }
+            chunk->used = 0;
+
+            if (chunk == current_chunk_) {
+                return;
+            }
+            if (empty_chunks_.size() < free_chunk_high_water_) {
+                empty_chunks_.push_back(chunk);
+            } else {
+                release_chunk(chunk);
+            }
+        }
+
+        void release_chunk(MemoryChunk* chunk) {
+            MEMORY_POOL_LOG("VariableSizePool: Releasing free chunk (high-water mark "
+                            << free_chunk_high_water_ << ")\n");
+            page_map_.erase(chunk->data, chunk->size);
+
+            size_t index = chunk->index;
+            std::swap(chunks_[index], chunks_.back());
+            chunks_[index]->index = index;
+            chunks_.pop_back();
+            ++released_chunks_;
+        }
+
+        MemoryChunk* find_chunk_for_ptr(const void* ptr) const {
+            MemoryChunk* chunk = page_map_.find(ptr);
+            if (chunk && ptr >= chunk->data && ptr < chunk->data + chunk->size) {
+                return chunk;
             }
             return nullptr;
         }
@@ -403,8 +732,8 @@ namespace CppVerseHub::Memory {
 
     public:
         ObjectPool() : next_free_(0), objects_in_use_(0) {
-            std::cout << "ObjectPool<" << typeid(T).name() << ">: Created pool with " 
-                      << PoolSize << " slots\n";
+            MEMORY_POOL_LOG("ObjectPool<" << typeid(T).name() << ">: Created pool with " 
+                          << PoolSize << " slots\n");
         }
 
         ~ObjectPool() {
@@ -414,7 +743,7 @@ namespace CppVerseHub::Memory {
                     reinterpret_cast<T*>(slots_[i].storage)->~T();
                 }
             }
-            std::cout << "ObjectPool<" << typeid(T).name() << ">: Destroyed pool\n";
+            MEMORY_POOL_LOG("ObjectPool<" << typeid(T).name() << ">: Destroyed pool\n");
         }
 
         template<typename... Args>
@@ -432,14 +761,14 @@ namespace CppVerseHub::Memory {
                     // Construct object in place
                     T* object = new (slots_[index].storage) T(std::forward<Args>(args)...);
                     
-                    std::cout << "ObjectPool: Acquired object at slot " << index 
-                              << " (" << objects_in_use_ << "/" << PoolSize << " in use)\n";
+                    MEMORY_POOL_LOG("ObjectPool: Acquired object at slot " << index 
+                                  << " (" << objects_in_use_ << "/" << PoolSize << " in use)\n");
                     
                     return object;
                 }
             }
             
-            std::cout << "ObjectPool: Pool exhausted, returning nullptr\n";
+            MEMORY_POOL_LOG("ObjectPool: Pool exhausted, returning nullptr\n");
             return nullptr;
         }
 
@@ -456,8 +785,8 @@ namespace CppVerseHub::Memory {
                         slots_[i].in_use = false;
                         --objects_in_use_;
                         
-                        std::cout << "ObjectPool: Released object at slot " << i 
-                                  << " (" << objects_in_use_ << "/" << PoolSize << " in use)\n";
+                        MEMORY_POOL_LOG("ObjectPool: Released object at slot " << i 
+                                      << " (" << objects_in_use_ << "/" << PoolSize << " in use)\n");
                     } else {
                         std::cout << "ObjectPool: ERROR - Double release detected!\n";
                     }
@@ -497,144 +826,350 @@ namespace CppVerseHub::Memory {
 
     /**
      * @class ThreadSafeMemoryPool
-     * @brief Thread-safe memory pool with per-thread caches
+     * @brief Thread-safe memory pool with per-thread magazine caches
+     *
+     * Each thread keeps two bounded magazines (stacks of free blocks) per pool
+     * in true thread_local storage, so allocate/deallocate touch no shared
+     * state in the common case. When both magazines are exhausted (or full),
+     * a whole magazine is exchanged with a lock-free global depot; only when
+     * the depot has nothing to offer is the mutex-protected FixedSizePool
+     * touched, and then for a whole magazine's worth of blocks at once.
      */
     template<size_t BlockSize>
     class ThreadSafeMemoryPool {
     private:
-        static constexpr size_t CacheSize = 32;
-        
-        struct ThreadCache {
-            void* blocks[CacheSize];
-            size_t count;
-            
-            ThreadCache() : count(0) {
-                for (size_t i = 0; i < CacheSize; ++i) {
-                    blocks[i] = nullptr;
+        static constexpr size_t MagazineSize = 32;
+        static constexpr uint32_t MaxMagazines = 1024;
+        static constexpr uint32_t NoMagazine = 0xFFFFFFFFu;
+
+        struct Magazine {
+            std::atomic<uint32_t> next{NoMagazine};
+            size_t count = 0;
+            void* blocks[MagazineSize];
+        };
+
+        /**
+         * Treiber stack of magazine indices. The head packs a modification tag
+         * next to the index, so a pop that races with pop/push of the same
+         * magazine fails its CAS instead of corrupting the stack (ABA).
+         */
+        class MagazineStack {
+        public:
+            void push(Magazine* magazines, uint32_t index) {
+                uint64_t head = head_.load(std::memory_order_relaxed);
+                do {
+                    magazines[index].next.store(index_of(head), std::memory_order_relaxed);
+                } while (!head_.compare_exchange_weak(head, pack(tag_of(head) + 1, index),
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed));
+                size_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            uint32_t pop(Magazine* magazines) {
+                uint64_t head = head_.load(std::memory_order_acquire);
+                for (;;) {
+                    uint32_t index = index_of(head);
+                    if (index == NoMagazine) {
+                        return NoMagazine;
+                    }
+                    uint32_t next = magazines[index].next.load(std::memory_order_relaxed);
+                    if (head_.compare_exchange_weak(head, pack(tag_of(head) + 1, next),
+                                                    std::memory_order_acquire,
+                                                    std::memory_order_acquire)) {
+                        size_.fetch_sub(1, std::memory_order_relaxed);
+                        return index;
+                    }
                 }
             }
+
+            size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+        private:
+            std::atomic<uint64_t> head_{pack(0, NoMagazine)};
+            std::atomic<size_t> size_{0};
+
+            static constexpr uint64_t pack(uint32_t tag, uint32_t index) {
+                return (static_cast<uint64_t>(tag) << 32) | index;
+            }
+            static uint32_t tag_of(uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+            static uint32_t index_of(uint64_t head) { return static_cast<uint32_t>(head); }
+        };
+
+        /**
+         * State shared by the pool and every thread cache that refers to it.
+         * Thread caches hold a reference, so magazines can still be handed back
+         * by threads that exit after the pool object itself was destroyed.
+         */
+        struct Depot {
+            FixedSizePool<BlockSize> global_pool;
+            std::unique_ptr<Magazine[]> magazines;
+            MagazineStack full;
+            MagazineStack empty;
+            std::atomic<size_t> thread_caches{0};
+            std::atomic<bool> retired{false};
+
+            Depot() : magazines(std::make_unique<Magazine[]>(MaxMagazines)) {
+                for (uint32_t i = MaxMagazines; i-- > 0;) {
+                    empty.push(magazines.get(), i);
+                }
+            }
+        };
+
+        struct ThreadCache {
+            uint64_t pool_id;
+            std::shared_ptr<Depot> depot;
+            uint32_t loaded = NoMagazine;
+            uint32_t previous = NoMagazine;   // always either full or empty
+            size_t allocations = 0;
+            size_t deallocations = 0;
+        };
+
+        struct ThreadCacheList {
+            std::vector<ThreadCache> caches;
+
+            ~ThreadCacheList();
         };
 
     public:
-        ThreadSafeMemoryPool() : global_pool_(std::make_unique<FixedSizePool<BlockSize>>()) {
-            std::cout << "ThreadSafeMemoryPool: Created with block size " << BlockSize << "\n";
+        ThreadSafeMemoryPool()
+            : depot_(std::make_shared<Depot>())
+            , pool_id_(next_pool_id_.fetch_add(1, std::memory_order_relaxed)) {
+            MEMORY_POOL_LOG("ThreadSafeMemoryPool: Created with block size " << BlockSize << "\n");
         }
 
         ~ThreadSafeMemoryPool() {
-            // Clean up thread caches
-            std::lock_guard<std::mutex> lock(cache_mutex_);
-            for (auto& [thread_id, cache] : thread_caches_) {
-                for (size_t i = 0; i < cache->count; ++i) {
-                    global_pool_->deallocate(cache->blocks[i]);
+            depot_->retired.store(true, std::memory_order_release);
+
+            // Hand back this thread's magazines now; other threads do so when
+            // they exit or next look up a cache for this block size
+            if (ThreadCacheList* list = thread_cache_list()) {
+                auto& caches = list->caches;
+                for (auto it = caches.begin(); it != caches.end(); ++it) {
+                    if (it->pool_id == pool_id_) {
+                        release_cache(*it);
+                        caches.erase(it);
+                        break;
+                    }
                 }
             }
-            std::cout << "ThreadSafeMemoryPool: Destroyed\n";
+            MEMORY_POOL_LOG("ThreadSafeMemoryPool: Destroyed\n");
         }
 
+        ThreadSafeMemoryPool(const ThreadSafeMemoryPool&) = delete;
+        ThreadSafeMemoryPool& operator=(const ThreadSafeMemoryPool&) = delete;
+
         void* allocate() {
             ThreadCache* cache = get_thread_cache();
-            
-            // Try to allocate from thread cache
-            if (cache->count > 0) {
-                --cache->count;
-                void* result = cache->blocks[cache->count];
-                cache->blocks[cache->count] = nullptr;
-                
-                thread_local_allocations_.fetch_add(1);
-                return result;
+            if (!cache) {
+                return depot_->global_pool.allocate();
             }
+            ++cache->allocations;
 
-            // Refill cache from global pool
-            refill_cache(cache);
-            
-            if (cache->count > 0) {
-                --cache->count;
-                void* result = cache->blocks[cache->count];
-                cache->blocks[cache->count] = nullptr;
-                
-                thread_local_allocations_.fetch_add(1);
-                return result;
-            }
+            Magazine* magazines = depot_->magazines.get();
+            for (;;) {
+                if (cache->loaded != NoMagazine && magazines[cache->loaded].count > 0) {
+                    Magazine& magazine = magazines[cache->loaded];
+                    return magazine.blocks[--magazine.count];
+                }
 
-            // Global pool allocation failed
-            return nullptr;
+                // Previous magazine is full: swap it in
+                if (cache->previous != NoMagazine && magazines[cache->previous].count > 0) {
+                    std::swap(cache->loaded, cache->previous);
+                    continue;
+                }
+
+                // Both empty: trade the empty previous magazine for a full one
+                uint32_t full = depot_->full.pop(magazines);
+                if (full != NoMagazine) {
+                    if (cache->previous != NoMagazine) {
+                        depot_->empty.push(magazines, cache->previous);
+                    }
+                    cache->previous = cache->loaded;
+                    cache->loaded = full;
+                    continue;
+                }
+
+                // Depot is dry: fill the loaded magazine from the global pool in one batch
+                if (cache->loaded == NoMagazine) {
+                    cache->loaded = depot_->empty.pop(magazines);
+                    if (cache->loaded == NoMagazine) {
+                        return depot_->global_pool.allocate();
+                    }
+                }
+                Magazine& magazine = magazines[cache->loaded];
+                magazine.count = depot_->global_pool.allocate_batch(magazine.blocks, MagazineSize);
+            }
         }
 
         void deallocate(void* ptr) {
             if (!ptr) return;
 
             ThreadCache* cache = get_thread_cache();
-            
-            // Add to thread cache if there's space
-            if (cache->count < CacheSize) {
-                cache->blocks[cache->count] = ptr;
-                ++cache->count;
-                
-                thread_local_deallocations_.fetch_add(1);
+            if (!cache) {
+                depot_->global_pool.deallocate(ptr);
                 return;
             }
+            ++cache->deallocations;
+
+            Magazine* magazines = depot_->magazines.get();
+            for (;;) {
+                if (cache->loaded != NoMagazine && magazines[cache->loaded].count < MagazineSize) {
+                    Magazine& magazine = magazines[cache->loaded];
+                    magazine.blocks[magazine.count++] = ptr;
+                    return;
+                }
+
+                // Previous magazine is empty: swap it in
+                if (cache->previous != NoMagazine && magazines[cache->previous].count == 0) {
+                    std::swap(cache->loaded, cache->previous);
+                    continue;
+                }
 
-            // Cache is full, return to global pool
-            global_pool_->deallocate(ptr);
-            thread_local_deallocations_.fetch_add(1);
+                // Both full: hand the full previous magazine to the depot
+                uint32_t empty = depot_->empty.pop(magazines);
+                if (empty != NoMagazine) {
+                    if (cache->previous != NoMagazine) {
+                        depot_->full.push(magazines, cache->previous);
+                    }
+                    cache->previous = cache->loaded;
+                    cache->loaded = empty;
+                    continue;
+                }
+
+                // No spare magazines anywhere: return a full one to the global pool in one batch
+                if (cache->loaded == NoMagazine) {
+                    depot_->global_pool.deallocate(ptr);
+                    return;
+                }
+                Magazine& magazine = magazines[cache->loaded];
+                depot_->global_pool.deallocate_batch(magazine.blocks, magazine.count);
+                magazine.count = 0;
+            }
         }
 
+        /// Allocations made by the calling thread through this pool
         size_t get_thread_allocations() const {
-            return thread_local_allocations_.load();
+            const ThreadCache* cache = find_thread_cache();
+            return cache ? cache->allocations : 0;
         }
 
+        /// Deallocations made by the calling thread through this pool
         size_t get_thread_deallocations() const {
-            return thread_local_deallocations_.load();
+            const ThreadCache* cache = find_thread_cache();
+            return cache ? cache->deallocations : 0;
         }
 
+        /// Blocks taken from the global pool: those in use plus those cached in magazines
+        size_t blocks_outstanding() const { return depot_->global_pool.total_allocated(); }
+
+        /// Threads currently holding magazines of this pool
+        size_t thread_cache_count() const { return depot_->thread_caches.load(std::memory_order_relaxed); }
+
+        /// Magazines parked in the depot, full ones holding magazine_size() blocks each
+        size_t depot_full_magazines() const { return depot_->full.size(); }
+        size_t depot_empty_magazines() const { return depot_->empty.size(); }
+
+        static constexpr size_t magazine_size() { return MagazineSize; }
+
         void print_statistics() const {
-            global_pool_->print_statistics();
+            depot_->global_pool.print_statistics();
             
-            std::lock_guard<std::mutex> lock(cache_mutex_);
-            std::cout << "Thread caches: " << thread_caches_.size() << "\n";
-            std::cout << "Total thread allocations: " << thread_local_allocations_.load() << "\n";
-            std::cout << "Total thread deallocations: " << thread_local_deallocations_.load() << "\n";
+            std::cout << "Thread caches: " << depot_->thread_caches.load() << "\n";
+            std::cout << "Depot magazines: " << depot_->full.size() << " full, "
+                      << depot_->empty.size() << " empty (" << MagazineSize << " blocks each)\n";
+            std::cout << "Calling thread allocations: " << get_thread_allocations() << "\n";
+            std::cout << "Calling thread deallocations: " << get_thread_deallocations() << "\n";
         }
 
     private:
-        std::unique_ptr<FixedSizePool<BlockSize>> global_pool_;
-        mutable std::mutex cache_mutex_;
-        std::unordered_map<std::thread::id, std::unique_ptr<ThreadCache>> thread_caches_;
-        
-        // Thread-local statistics
-        thread_local std::atomic<size_t> thread_local_allocations_{0};
-        thread_local std::atomic<size_t> thread_local_deallocations_{0};
+        std::shared_ptr<Depot> depot_;
+        uint64_t pool_id_;
 
-        ThreadCache* get_thread_cache() {
-            std::thread::id current_id = std::this_thread::get_id();
-            
-            std::lock_guard<std::mutex> lock(cache_mutex_);
-            auto it = thread_caches_.find(current_id);
-            if (it == thread_caches_.end()) {
-                auto cache = std::make_unique<ThreadCache>();
-                ThreadCache* cache_ptr = cache.get();
-                thread_caches_[current_id] = std::move(cache);
-                return cache_ptr;
+        static inline std::atomic<uint64_t> next_pool_id_{1};
+
+        static bool& thread_cache_list_destroyed() {
+            thread_local bool destroyed = false;
+            return destroyed;
+        }
+
+        // Null once the calling thread's thread_local storage is being torn down
+        static ThreadCacheList* thread_cache_list() {
+            if (thread_cache_list_destroyed()) {
+                return nullptr;
             }
-            return it->second.get();
+            thread_local ThreadCacheList list;
+            return &list;
         }
 
-        void refill_cache(ThreadCache* cache) {
-            // Allocate multiple blocks from global pool
-            size_t blocks_to_allocate = std::min(CacheSize - cache->count, CacheSize / 2);
-            
-            for (size_t i = 0; i < blocks_to_allocate; ++i) {
-                void* block = global_pool_->allocate();
-                if (block) {
-                    cache->blocks[cache->count] = block;
-                    ++cache->count;
+        static void release_cache(ThreadCache& cache) {
+            Depot& depot = *cache.depot;
+            for (uint32_t index : {cache.loaded, cache.previous}) {
+                if (index == NoMagazine) continue;
+
+                Magazine& magazine = depot.magazines[index];
+                if (magazine.count == MagazineSize) {
+                    depot.full.push(depot.magazines.get(), index);
                 } else {
-                    break;
+                    depot.global_pool.deallocate_batch(magazine.blocks, magazine.count);
+                    magazine.count = 0;
+                    depot.empty.push(depot.magazines.get(), index);
                 }
             }
+            cache.loaded = cache.previous = NoMagazine;
+            depot.thread_caches.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        const ThreadCache* find_thread_cache() const {
+            ThreadCacheList* list = thread_cache_list();
+            if (!list) return nullptr;
+            for (const auto& cache : list->caches) {
+                if (cache.pool_id == pool_id_) {
+                    return &cache;
+                }
+            }
+            return nullptr;
+        }
+
+        ThreadCache* get_thread_cache() {
+            ThreadCacheList* list = thread_cache_list();
+            if (!list) return nullptr;
+
+            auto& caches = list->caches;
+            if (!caches.empty() && caches.back().pool_id == pool_id_) {
+                return &caches.back();
+            }
+            for (auto it = caches.begin(); it != caches.end(); ++it) {
+                if (it->pool_id == pool_id_) {
+                    // Keep the most recently used pool at the back for the fast path
+                    std::iter_swap(it, caches.end() - 1);
+                    return &caches.back();
+                }
+            }
+
+            // First use from this thread: drop caches of destroyed pools, then register
+            caches.erase(std::remove_if(caches.begin(), caches.end(), [](ThreadCache& cache) {
+                if (!cache.depot->retired.load(std::memory_order_acquire)) return false;
+                release_cache(cache);
+                return true;
+            }), caches.end());
+
+            ThreadCache cache{pool_id_, depot_};
+            cache.loaded = depot_->empty.pop(depot_->magazines.get());
+            cache.previous = depot_->empty.pop(depot_->magazines.get());
+            depot_->thread_caches.fetch_add(1, std::memory_order_relaxed);
+            caches.push_back(std::move(cache));
+            return &caches.back();
         }
     };
 
+    template<size_t BlockSize>
+    ThreadSafeMemoryPool<BlockSize>::ThreadCacheList::~ThreadCacheList() {
+        thread_cache_list_destroyed() = true;
+        for (auto& cache : caches) {
+            ThreadSafeMemoryPool::release_cache(cache);
+        }
+    }
+
     /**
      * @class MemoryPoolDemo
      * @brief Comprehensive demonstration of memory pool implementations
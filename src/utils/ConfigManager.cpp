@@ -7,15 +7,190 @@
 #include <cstdlib>
 #include <algorithm>
 #include <sstream>
+#include <iomanip>
+#include <ctime>
+
+extern char** environ;
 
 namespace CppVerseHub::Utils {
 
-// Static member definitions
-std::unique_ptr<ConfigManager> ConfigManager::instance_ = nullptr;
-std::mutex ConfigManager::instance_mutex_;
+// ===== CONFIG SNAPSHOT DIFF =====
+
+ConfigDiff ConfigDiff::between(const ConfigSnapshot& before, const ConfigSnapshot& after) {
+    ConfigDiff diff;
+    diff.from_version = before.version();
+    diff.to_version = after.version();
+    
+    for (const auto& [section_name, values] : after.sections()) {
+        auto before_it = before.sections().find(section_name);
+        if (before_it != before.sections().end() && before_it->second == values) {
+            continue;  // Shared, so unchanged
+        }
+        for (const auto& [key, value] : *values) {
+            const ConfigValue* old_value = before.find(section_name, key);
+            if (!old_value) {
+                diff.changes.push_back({ConfigChange::Kind::Added, section_name, key, std::nullopt, value});
+            } else if (!old_value->hasSameValue(value)) {
+                diff.changes.push_back({ConfigChange::Kind::Modified, section_name, key, *old_value, value});
+            }
+        }
+    }
+    
+    for (const auto& [section_name, values] : before.sections()) {
+        auto after_it = after.sections().find(section_name);
+        if (after_it != after.sections().end() && after_it->second == values) {
+            continue;
+        }
+        for (const auto& [key, value] : *values) {
+            if (!after.has(section_name, key)) {
+                diff.changes.push_back({ConfigChange::Kind::Removed, section_name, key, value, std::nullopt});
+            }
+        }
+    }
+    
+    return diff;
+}
 
 // ===== CONFIG MANAGER IMPLEMENTATION =====
 
+ConfigSection& ConfigManager::sectionLocked(const std::string& section_name) {
+    auto& section = sections_[section_name];
+    if (!section) {
+        section = std::make_unique<ConfigSection>(section_name);
+        section->on_change_ = [this, section_name]() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            publishSectionLocked(section_name);
+        };
+    }
+    return *section;
+}
+
+void ConfigManager::publishLocked() {
+    ConfigSnapshot::SharedSections sections;
+    for (const auto& [section_name, section] : sections_) {
+        std::lock_guard<std::mutex> section_lock(section->mutex_);
+        sections.emplace(section_name, std::make_shared<const ConfigSnapshot::SectionValues>(section->values_));
+    }
+    installLocked(std::move(sections));
+}
+
+void ConfigManager::publishSectionLocked(const std::string& section_name) {
+    ConfigSnapshot::SharedSections sections = snapshot_.load(std::memory_order_acquire)->sections();
+    auto it = sections_.find(section_name);
+    if (it == sections_.end()) {
+        sections.erase(section_name);
+    } else {
+        std::lock_guard<std::mutex> section_lock(it->second->mutex_);
+        sections[section_name] = std::make_shared<const ConfigSnapshot::SectionValues>(it->second->values_);
+    }
+    installLocked(std::move(sections));
+}
+
+void ConfigManager::installLocked(ConfigSnapshot::SharedSections sections) {
+    uint64_t version = snapshot_version_.load(std::memory_order_relaxed) + 1;
+    auto snapshot = std::make_shared<ConfigSnapshot>(std::move(sections), version);
+    std::apply([&](const auto&... keys) { (resolveKeys(keys, *snapshot), ...); }, key_registry_);
+    
+    // Version first: a thread that has seen this snapshot then also sees the
+    // new version, so its cached snapshot never lags behind it
+    snapshot_version_.store(version, std::memory_order_release);
+    snapshot_.store(std::move(snapshot), std::memory_order_release);
+}
+
+template<typename T>
+void ConfigManager::resolveKeys(const std::vector<ConfigKey<T>>& keys, ConfigSnapshot& snapshot) {
+    auto& resolved = std::get<ConfigSnapshot::ResolvedKeys<T>>(snapshot.resolved_);
+    resolved.values = std::make_unique<T[]>(keys.size());
+    resolved.count = keys.size();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        resolved.values[i] = snapshot.get<T>(keys[i].section(), keys[i].key(), keys[i].defaultValue());
+    }
+}
+
+void ConfigManager::applyReload(ConfigSnapshot::Sections staged, bool from_file) {
+    std::shared_ptr<const ConfigSnapshot> before;
+    std::shared_ptr<const ConfigSnapshot> after;
+    std::vector<std::function<void(const ConfigDiff&)>> reload_listeners;
+    
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        before = snapshot_.load(std::memory_order_acquire);
+        std::unordered_set<std::string> touched;
+        
+        if (from_file) {
+            for (const auto& [section_name, keys] : file_keys_) {
+                auto section_it = sections_.find(section_name);
+                if (section_it == sections_.end()) continue;
+                auto staged_it = staged.find(section_name);
+                for (const auto& key : keys) {
+                    if ((staged_it == staged.end() || staged_it->second.count(key) == 0) &&
+                        section_it->second->erase(key)) {
+                        touched.insert(section_name);
+                    }
+                }
+            }
+            
+            file_keys_.clear();
+            for (const auto& [section_name, values] : staged) {
+                auto& keys = file_keys_[section_name];
+                for (const auto& entry : values) keys.insert(entry.first);
+            }
+        }
+        
+        for (auto& [section_name, values] : staged) {
+            auto& section = sectionLocked(section_name);
+            touched.insert(section_name);
+            for (auto& [key, value] : values) {
+                auto validator_it = validators_.find(section_name + "." + key);
+                bool valid = true;
+                if (validator_it != validators_.end()) {
+                    try {
+                        valid = validator_it->second(value);
+                    } catch (const std::exception&) {
+                        valid = false;
+                    }
+                }
+                if (!valid) {
+                    std::cerr << "Rejected config value [" << section_name << "]." << key
+                              << ": validation failed" << std::endl;
+                    continue;
+                }
+                section.store(key, std::move(value));
+            }
+        }
+        
+        // One snapshot for the whole reload; untouched sections stay shared
+        ConfigSnapshot::SharedSections sections = before->sections();
+        for (const auto& section_name : touched) {
+            const auto& section = *sections_.at(section_name);
+            std::lock_guard<std::mutex> section_lock(section.mutex_);
+            sections[section_name] = std::make_shared<const ConfigSnapshot::SectionValues>(section.values_);
+        }
+        installLocked(std::move(sections));
+        after = snapshot_.load(std::memory_order_acquire);
+        reload_listeners = reload_listeners_;
+    }
+    
+    ConfigDiff diff = ConfigDiff::between(*before, *after);
+    if (diff.empty()) {
+        return;
+    }
+    
+    for (const auto& change : diff.changes) {
+        if (change.new_value) {
+            notifyChange(change.section + "." + change.key, *change.new_value);
+        }
+    }
+    
+    for (const auto& listener : reload_listeners) {
+        try {
+            listener(diff);
+        } catch (const std::exception& e) {
+            std::cerr << "Error in config reload listener: " << e.what() << std::endl;
+        }
+    }
+}
+
 void ConfigManager::initializeDefaults() {
     // Application settings
     auto& app_section = getSection("Application");
@@ -67,19 +242,35 @@ void ConfigManager::initializeDefaults() {
 }
 
 void ConfigManager::notifyChange(const std::string& section_key, const ConfigValue& value) {
-    auto it = change_listeners_.find(section_key);
-    if (it != change_listeners_.end()) {
-        for (const auto& listener : it->second) {
-            try {
-                listener(section_key, value);
-            } catch (const std::exception& e) {
-                std::cerr << "Error in config change listener: " << e.what() << std::endl;
-            }
+    std::vector<std::function<void(const std::string&, const ConfigValue&)>> listeners;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = change_listeners_.find(section_key);
+        if (it == change_listeners_.end()) {
+            return;
+        }
+        listeners = it->second;
+    }
+    
+    for (const auto& listener : listeners) {
+        try {
+            listener(section_key, value);
+        } catch (const std::exception& e) {
+            std::cerr << "Error in config change listener: " << e.what() << std::endl;
         }
     }
 }
 
 bool ConfigManager::loadFromFile(const std::string& filename) {
+    ConfigSnapshot::Sections staged;
+    if (!parseFile(filename, staged)) {
+        return false;
+    }
+    applyReload(std::move(staged), true);
+    return true;
+}
+
+bool ConfigManager::parseFile(const std::string& filename, ConfigSnapshot::Sections& staged) {
     try {
         if (!std::filesystem::exists(filename)) {
             return false;
@@ -91,16 +282,16 @@ bool ConfigManager::loadFromFile(const std::string& filename) {
         
         if (extension == "json") {
             JsonValue root = JsonParser::parseFromFile(filename);
-            return loadFromJsonValue(root);
+            return parseJsonValue(root, staged);
         } else if (extension == "ini" || extension == "cfg" || extension == "conf") {
-            return loadFromIniFile(filename);
+            return parseIniFile(filename, staged);
         } else {
             // Try JSON first, then INI
             try {
                 JsonValue root = JsonParser::parseFromFile(filename);
-                return loadFromJsonValue(root);
+                return parseJsonValue(root, staged);
             } catch (const JsonParseException&) {
-                return loadFromIniFile(filename);
+                return parseIniFile(filename, staged);
             }
         }
     } catch (const std::exception& e) {
@@ -109,7 +300,7 @@ bool ConfigManager::loadFromFile(const std::string& filename) {
     }
 }
 
-bool ConfigManager::loadFromJsonValue(const JsonValue& root) {
+bool ConfigManager::parseJsonValue(const JsonValue& root, ConfigSnapshot::Sections& staged) {
     if (!root.isObject()) {
         return false;
     }
@@ -121,7 +312,7 @@ bool ConfigManager::loadFromJsonValue(const JsonValue& root) {
         
         if (!section_value.isObject()) continue;
         
-        auto& section = getSection(section_name);
+        auto& section = staged[section_name];
         const auto& section_obj = section_value.asObject();
         
         for (const auto& value_pair : section_obj) {
@@ -130,16 +321,16 @@ bool ConfigManager::loadFromJsonValue(const JsonValue& root) {
             
             try {
                 if (value.isBool()) {
-                    section.set(key, value.asBool());
+                    section[key] = ConfigValue(value.asBool());
                 } else if (value.isNumber()) {
                     double num = value.asNumber();
                     if (num == static_cast<int>(num)) {
-                        section.set(key, static_cast<int>(num));
+                        section[key] = ConfigValue(static_cast<int>(num));
                     } else {
-                        section.set(key, num);
+                        section[key] = ConfigValue(num);
                     }
                 } else if (value.isString()) {
-                    section.set(key, value.asString());
+                    section[key] = ConfigValue(value.asString());
                 } else if (value.isArray()) {
                     std::vector<std::string> string_array;
                     for (size_t i = 0; i < value.size(); ++i) {
@@ -148,7 +339,7 @@ bool ConfigManager::loadFromJsonValue(const JsonValue& root) {
                         }
                     }
                     if (!string_array.empty()) {
-                        section.set(key, string_array);
+                        section[key] = ConfigValue(std::move(string_array));
                     }
                 }
             } catch (const std::exception& e) {
@@ -160,7 +351,7 @@ bool ConfigManager::loadFromJsonValue(const JsonValue& root) {
     return true;
 }
 
-bool ConfigManager::loadFromIniFile(const std::string& filename) {
+bool ConfigManager::parseIniFile(const std::string& filename, ConfigSnapshot::Sections& staged) {
     std::ifstream file(filename);
     if (!file.is_open()) {
         return false;
@@ -206,26 +397,26 @@ bool ConfigManager::loadFromIniFile(const std::string& filename) {
             }
             
             try {
-                auto& section = getSection(current_section);
+                auto& section = staged[current_section];
                 
                 // Try to parse as different types
                 if (value == "true" || value == "false") {
-                    section.set(key, value == "true");
+                    section[key] = ConfigValue(value == "true");
                 } else if (value.find('.') != std::string::npos) {
                     // Try as double
                     try {
                         double d = std::stod(value);
-                        section.set(key, d);
+                        section[key] = ConfigValue(d);
                     } catch (const std::exception&) {
-                        section.set(key, value); // Store as string
+                        section[key] = ConfigValue(value); // Store as string
                     }
                 } else {
                     // Try as int
                     try {
                         int i = std::stoi(value);
-                        section.set(key, i);
+                        section[key] = ConfigValue(i);
                     } catch (const std::exception&) {
-                        section.set(key, value); // Store as string
+                        section[key] = ConfigValue(value); // Store as string
                     }
                 }
             } catch (const std::exception& e) {
@@ -308,7 +499,8 @@ bool ConfigManager::saveToIniFile(const std::string& filename) const {
     }
     
     file << "# CppVerseHub Configuration File" << std::endl;
-    file << "# Generated on " << std::chrono::system_clock::now() << std::endl;
+    std::time_t now = std::time(nullptr);
+    file << "# Generated on " << std::put_time(std::localtime(&now), "%Y-%m-%d %H:%M:%S") << std::endl;
     file << std::endl;
     
     std::lock_guard<std::mutex> lock(mutex_);
@@ -358,7 +550,12 @@ bool ConfigManager::saveToIniFile(const std::string& filename) const {
 bool ConfigManager::loadFromJson(const std::string& json_content) {
     try {
         JsonValue root = JsonParser::parseFromString(json_content);
-        return loadFromJsonValue(root);
+        ConfigSnapshot::Sections staged;
+        if (!parseJsonValue(root, staged)) {
+            return false;
+        }
+        applyReload(std::move(staged));
+        return true;
     } catch (const std::exception& e) {
         std::cerr << "Error loading JSON config: " << e.what() << std::endl;
         return false;
@@ -366,6 +563,8 @@ bool ConfigManager::loadFromJson(const std::string& json_content) {
 }
 
 void ConfigManager::loadFromEnvironment(const std::string& prefix) {
+    ConfigSnapshot::Sections staged;
+    
     // Get all environment variables with the given prefix
     for (char** env = environ; *env != nullptr; ++env) {
         std::string env_var(*env);
@@ -389,15 +588,18 @@ void ConfigManager::loadFromEnvironment(const std::string& prefix) {
                     // Replace remaining underscores with dots in key name
                     std::replace(key_name.begin(), key_name.end(), '_', '.');
                     
-                    auto& section = getSection(section_name);
-                    section.set(key_name, value, "From environment variable: " + name);
+                    staged[section_name][key_name] = ConfigValue(value, "From environment variable: " + name);
                 }
             }
         }
     }
+    
+    applyReload(std::move(staged));
 }
 
 void ConfigManager::loadFromCommandLine(int argc, char* argv[], const std::string& prefix) {
+    ConfigSnapshot::Sections staged;
+    
     for (int i = 1; i < argc; ++i) {
         std::string arg(argv[i]);
         
@@ -415,12 +617,13 @@ void ConfigManager::loadFromCommandLine(int argc, char* argv[], const std::strin
                     std::string section_name = key.substr(0, dot_pos);
                     std::string key_name = key.substr(dot_pos + 1);
                     
-                    auto& section = getSection(section_name);
-                    section.set(key_name, value, "From command line: " + arg);
+                    staged[section_name][key_name] = ConfigValue(value, "From command line: " + arg);
                 }
             }
         }
     }
+    
+    applyReload(std::move(staged));
 }
 
 void ConfigManager::printConfiguration(std::ostream& os) const {
@@ -468,16 +671,21 @@ std::string ConfigManager::getConfigurationReport() const {
 }
 
 void ConfigManager::mergeFrom(const ConfigManager& other, bool overwrite) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::lock_guard<std::mutex> other_lock(other.mutex_);
+    ConfigSnapshot::Sections staged;
+    for (const auto& [section_name, values] : other.snapshot()->sections()) {
+        staged.emplace(section_name, *values);
+    }
     
-    for (const auto& section_pair : other.sections_) {
-        const std::string& section_name = section_pair.first;
-        const auto& other_section = section_pair.second;
-        
-        auto& our_section = getSection(section_name);
-        our_section.merge(*other_section, overwrite);
+    if (!overwrite) {
+        auto current = snapshot();
+        for (auto& [section_name, values] : staged) {
+            for (auto it = values.begin(); it != values.end();) {
+                it = current->has(section_name, it->first) ? values.erase(it) : std::next(it);
+            }
+        }
     }
+    
+    applyReload(std::move(staged));
 }
 
 void ConfigManager::setupSpaceGameDefaults() {
@@ -683,7 +891,7 @@ void demonstrateConfigManager() {
     
     // Demonstrate change listeners
     config.addChangeListener("Audio", "master_volume", 
-        [](const std::string& key, const ConfigValue& value) {
+        [](const std::string&, const ConfigValue& value) {
             std::cout << "Volume changed to: " << value.toString() << std::endl;
         });
     
@@ -710,8 +918,41 @@ void demonstrateConfigManager() {
     config.saveToFile("demo_config.json");
     std::cout << "Configuration saved to demo_config.json" << std::endl;
     
+    // Demonstrate typed key handles
+    auto max_fps = config.registerKey<int>("Graphics", "max_fps", 60,
+                                           [](const int& fps) { return fps >= 30 && fps <= 360; });
+    auto volume = config.registerKey<double>("Audio", "master_volume", 0.8);
+    std::cout << "Typed keys: max_fps = " << config.get(max_fps)
+              << ", master_volume = " << config.get(volume) << std::endl;
+    
+    try {
+        config.set(max_fps, 10); // Rejected by the registered validator
+    } catch (const std::exception& e) {
+        std::cout << "Typed key validation: " << e.what() << std::endl;
+    }
+    
+    // Demonstrate snapshot reads and a background reload
+    auto before_reload = config.snapshot();
+    config.addReloadListener([](const ConfigDiff& diff) {
+        std::cout << "Reload v" << diff.from_version << " -> v" << diff.to_version
+                  << ": " << diff.size() << " change(s)" << std::endl;
+        for (const auto& change : diff.changes) {
+            std::cout << "  [" << change.section << "]." << change.key << " = "
+                      << (change.new_value ? change.new_value->toString() : std::string("<removed>")) << std::endl;
+        }
+    });
+    
+    {
+        std::ofstream reload_file("demo_reload.json");
+        reload_file << R"({"Graphics": {"max_fps": 144}, "Audio": {"master_volume": 0.5}})";
+    }
+    std::future<bool> reloaded = config.reloadAsync("demo_reload.json");
+    std::cout << "Reload " << (reloaded.get() ? "applied" : "failed") << "; pinned snapshot still sees max_fps = "
+              << before_reload->get<int>("Graphics", "max_fps", 0) << std::endl;
+    
     // Clean up
     std::remove("demo_config.json");
+    std::remove("demo_reload.json");
 }
 
 } // namespace CppVerseHub::Utils
\ No newline at end of file
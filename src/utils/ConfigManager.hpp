@@ -6,11 +6,17 @@
 #include <string>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <optional>
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <atomic>
+#include <future>
+#include <cstdint>
+#include <algorithm>
+#include <tuple>
 #include <fstream>
 #include <iostream>
 #include <type_traits>
@@ -18,8 +24,9 @@
 
 namespace CppVerseHub::Utils {
 
-// Forward declaration
+// Forward declarations
 class JsonValue;
+class ConfigManager;
 
 // ===== CONFIGURATION VALUE TYPE =====
 
@@ -36,7 +43,7 @@ public:
     // Constructors
     ConfigValue() : value_(std::string("")), is_readonly_(false) {}
     
-    template<typename T>
+    template<typename T, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, ConfigValue>>>
     ConfigValue(T&& value, const std::string& desc = "", bool readonly = false)
         : value_(std::forward<T>(value)), description_(desc), is_readonly_(readonly) {}
     
@@ -105,6 +112,9 @@ public:
     const std::string& getDescription() const { return description_; }
     void setDescription(const std::string& desc) { description_ = desc; }
     
+    // Compares the stored values only, not descriptions or flags
+    bool hasSameValue(const ConfigValue& other) const { return value_ == other.value_; }
+    
     bool isReadOnly() const { return is_readonly_; }
     void setReadOnly(bool readonly) { is_readonly_ = readonly; }
     
@@ -153,6 +163,26 @@ private:
     std::string description_;
     mutable std::mutex mutex_;
     
+    // Set by the owning ConfigManager so direct edits republish this section
+    std::function<void()> on_change_;
+    
+    friend class ConfigManager;
+    
+    void changed() const {
+        if (on_change_) on_change_();
+    }
+    
+    // Store without firing the change hook; the manager publishes itself
+    void store(const std::string& key, ConfigValue value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        values_[key] = std::move(value);
+    }
+    
+    bool erase(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return values_.erase(key) > 0;
+    }
+    
 public:
     explicit ConfigSection(const std::string& section_name = "", const std::string& desc = "")
         : name_(section_name), description_(desc) {}
@@ -173,8 +203,8 @@ public:
     
     template<typename T>
     void set(const std::string& key, T&& value, const std::string& description = "", bool readonly = false) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        values_[key] = ConfigValue(std::forward<T>(value), description, readonly);
+        store(key, ConfigValue(std::forward<T>(value), description, readonly));
+        changed();
     }
     
     // Check if key exists
@@ -185,8 +215,13 @@ public:
     
     // Remove key
     bool remove(const std::string& key) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return values_.erase(key) > 0;
+        bool removed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            removed = values_.erase(key) > 0;
+        }
+        if (removed) changed();
+        return removed;
     }
     
     // Get all keys
@@ -227,20 +262,26 @@ public:
     
     // Clear all values
     void clear() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        values_.clear();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            values_.clear();
+        }
+        changed();
     }
     
     // Merge another section
     void merge(const ConfigSection& other, bool overwrite = true) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        std::lock_guard<std::mutex> other_lock(other.mutex_);
-        
-        for (const auto& pair : other.values_) {
-            if (overwrite || values_.find(pair.first) == values_.end()) {
-                values_[pair.first] = pair.second;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::lock_guard<std::mutex> other_lock(other.mutex_);
+            
+            for (const auto& pair : other.values_) {
+                if (overwrite || values_.find(pair.first) == values_.end()) {
+                    values_[pair.first] = pair.second;
+                }
             }
         }
+        changed();
     }
     
     // Iterator support
@@ -255,6 +296,136 @@ public:
     }
 };
 
+// ===== TYPED CONFIGURATION KEYS =====
+
+template<typename T>
+inline constexpr bool is_config_type_v =
+    std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, double> ||
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::vector<std::string>>;
+
+// Handle to one section/key pair, obtained from ConfigManager::registerKey.
+// Every published snapshot stores registered keys already converted to T in
+// a dense array, so a read through the handle is an indexed load.
+template<typename T>
+class ConfigKey {
+    static_assert(is_config_type_v<T>, "ConfigKey supports the ConfigValue types");
+    
+private:
+    size_t index_;
+    std::string section_;
+    std::string key_;
+    T default_value_;
+    
+    friend class ConfigManager;
+    
+    ConfigKey(size_t index, std::string section_name, std::string key, T default_value)
+        : index_(index), section_(std::move(section_name)), key_(std::move(key)),
+          default_value_(std::move(default_value)) {}
+    
+public:
+    size_t index() const { return index_; }
+    const std::string& section() const { return section_; }
+    const std::string& key() const { return key_; }
+    const T& defaultValue() const { return default_value_; }
+};
+
+// ===== CONFIGURATION SNAPSHOT =====
+
+// Immutable, versioned copy of every configuration value. ConfigManager
+// publishes a new snapshot after each change; readers never take a lock.
+// Sections are shared between snapshots, so an edit only copies the
+// section it touched.
+class ConfigSnapshot {
+public:
+    using SectionValues = std::unordered_map<std::string, ConfigValue>;
+    using Sections = std::unordered_map<std::string, SectionValues>;
+    using SharedSections = std::unordered_map<std::string, std::shared_ptr<const SectionValues>>;
+    
+private:
+    // Values of registered ConfigKeys, indexed by ConfigKey::index()
+    template<typename T>
+    struct ResolvedKeys {
+        std::unique_ptr<T[]> values;
+        size_t count = 0;
+    };
+    
+    SharedSections sections_;
+    uint64_t version_;
+    std::tuple<ResolvedKeys<bool>, ResolvedKeys<int>, ResolvedKeys<double>,
+               ResolvedKeys<std::string>, ResolvedKeys<std::vector<std::string>>> resolved_;
+    
+    friend class ConfigManager;
+    
+public:
+    explicit ConfigSnapshot(SharedSections sections = {}, uint64_t version = 0)
+        : sections_(std::move(sections)), version_(version) {}
+    
+    uint64_t version() const { return version_; }
+    const SharedSections& sections() const { return sections_; }
+    
+    const ConfigValue* find(const std::string& section_name, const std::string& key) const {
+        auto section_it = sections_.find(section_name);
+        if (section_it == sections_.end()) return nullptr;
+        auto value_it = section_it->second->find(key);
+        return value_it != section_it->second->end() ? &value_it->second : nullptr;
+    }
+    
+    template<typename T>
+    T get(const std::string& section_name, const std::string& key, const T& default_value = T{}) const {
+        if (const ConfigValue* value = find(section_name, key)) {
+            auto opt_val = value->template tryGet<T>();
+            if (opt_val.has_value()) {
+                return opt_val.value();
+            }
+        }
+        return default_value;
+    }
+    
+    bool has(const std::string& section_name, const std::string& key) const {
+        return find(section_name, key) != nullptr;
+    }
+    
+    // Keys registered after this snapshot was published read as their default
+    template<typename T>
+    const T& get(const ConfigKey<T>& key) const {
+        const auto& resolved = std::get<ResolvedKeys<T>>(resolved_);
+        return key.index() < resolved.count ? resolved.values[key.index()] : key.defaultValue();
+    }
+    
+    size_t valueCount() const {
+        size_t count = 0;
+        for (const auto& section : sections_) count += section.second->size();
+        return count;
+    }
+};
+
+// One value that differs between two snapshots
+struct ConfigChange {
+    enum class Kind {
+        Added,
+        Removed,
+        Modified
+    };
+    
+    Kind kind;
+    std::string section;
+    std::string key;
+    std::optional<ConfigValue> old_value;
+    std::optional<ConfigValue> new_value;
+};
+
+// Everything a reload changed, delivered to reload listeners in one call
+struct ConfigDiff {
+    uint64_t from_version = 0;
+    uint64_t to_version = 0;
+    std::vector<ConfigChange> changes;
+    
+    bool empty() const { return changes.empty(); }
+    size_t size() const { return changes.size(); }
+    
+    static ConfigDiff between(const ConfigSnapshot& before, const ConfigSnapshot& after);
+};
+
 // ===== CONFIGURATION MANAGER =====
 
 class ConfigManager {
@@ -265,31 +436,84 @@ private:
     bool auto_save_;
     std::string current_config_file_;
     
+    // Keys the last file load supplied, per section; the next file load
+    // removes the ones its file no longer has
+    std::unordered_map<std::string, std::unordered_set<std::string>> file_keys_;
+    
+    // Published view of sections_. snapshot_version_ is bumped with each
+    // store so readers can keep a thread-local copy and skip the shared_ptr
+    // load until something changes.
+    std::atomic<std::shared_ptr<const ConfigSnapshot>> snapshot_;
+    std::atomic<uint64_t> snapshot_version_{0};
+    
     // Validation callbacks
     std::unordered_map<std::string, std::function<bool(const ConfigValue&)>> validators_;
     
     // Change notifications
     std::unordered_map<std::string, std::vector<std::function<void(const std::string&, const ConfigValue&)>>> change_listeners_;
+    std::vector<std::function<void(const ConfigDiff&)>> reload_listeners_;
     
-    // Singleton instance
-    static std::unique_ptr<ConfigManager> instance_;
-    static std::mutex instance_mutex_;
+    // Registered typed keys; index in each vector is the key's index()
+    std::tuple<std::vector<ConfigKey<bool>>, std::vector<ConfigKey<int>>, std::vector<ConfigKey<double>>,
+               std::vector<ConfigKey<std::string>>, std::vector<ConfigKey<std::vector<std::string>>>> key_registry_;
     
-    ConfigManager() : auto_save_(false) {
+    ConfigManager() : auto_save_(false), snapshot_(std::make_shared<ConfigSnapshot>()) {
         initializeDefaults();
+        publishSnapshot();
     }
     
     void initializeDefaults();
     void notifyChange(const std::string& section_key, const ConfigValue& value);
     
+    // Require mutex_. publishLocked() copies every section; publishSectionLocked()
+    // copies one and shares the rest with the current snapshot.
+    ConfigSection& sectionLocked(const std::string& section_name);
+    void publishLocked();
+    void publishSectionLocked(const std::string& section_name);
+    void installLocked(ConfigSnapshot::SharedSections sections);
+    
+    template<typename T>
+    static void resolveKeys(const std::vector<ConfigKey<T>>& keys, ConfigSnapshot& snapshot);
+    void publishSnapshot() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        publishLocked();
+    }
+    
+    // Parse into a detached value set without touching the live configuration
+    static bool parseFile(const std::string& filename, ConfigSnapshot::Sections& staged);
+    static bool parseJsonValue(const JsonValue& root, ConfigSnapshot::Sections& staged);
+    static bool parseIniFile(const std::string& filename, ConfigSnapshot::Sections& staged);
+    
+    // Validate and store staged values, publish one snapshot, then notify
+    // listeners once with the resulting diff. A file load also removes the
+    // keys the previous file load supplied and this one does not.
+    void applyReload(ConfigSnapshot::Sections staged, bool from_file = false);
+    
+    bool saveToIniFile(const std::string& filename) const;
+    
+    // Snapshot cached per thread; valid until this thread's next read
+    const ConfigSnapshot& currentSnapshot() const {
+        struct Cache {
+            const ConfigManager* owner = nullptr;
+            uint64_t version = 0;
+            std::shared_ptr<const ConfigSnapshot> snapshot;
+        };
+        thread_local Cache cache;
+        
+        uint64_t version = snapshot_version_.load(std::memory_order_acquire);
+        if (cache.owner != this || cache.version != version) {
+            cache.snapshot = snapshot_.load(std::memory_order_acquire);
+            cache.owner = this;
+            cache.version = cache.snapshot->version();
+        }
+        return *cache.snapshot;
+    }
+    
 public:
     // Singleton access
     static ConfigManager& getInstance() {
-        std::lock_guard<std::mutex> lock(instance_mutex_);
-        if (!instance_) {
-            instance_ = std::unique_ptr<ConfigManager>(new ConfigManager());
-        }
-        return *instance_;
+        static ConfigManager instance;
+        return instance;
     }
     
     // Delete copy constructor and assignment
@@ -299,11 +523,7 @@ public:
     // Section management
     ConfigSection& getSection(const std::string& section_name) {
         std::lock_guard<std::mutex> lock(mutex_);
-        auto it = sections_.find(section_name);
-        if (it == sections_.end()) {
-            sections_[section_name] = std::make_unique<ConfigSection>(section_name);
-        }
-        return *sections_[section_name];
+        return sectionLocked(section_name);
     }
     
     bool hasSection(const std::string& section_name) const {
@@ -313,7 +533,9 @@ public:
     
     bool removeSection(const std::string& section_name) {
         std::lock_guard<std::mutex> lock(mutex_);
-        return sections_.erase(section_name) > 0;
+        bool removed = sections_.erase(section_name) > 0;
+        if (removed) publishSectionLocked(section_name);
+        return removed;
     }
     
     std::vector<std::string> getSectionNames() const {
@@ -326,44 +548,105 @@ public:
         return names;
     }
     
-    // Convenience methods for direct value access
+    // Consistent view of all values; holding it pins that version
+    std::shared_ptr<const ConfigSnapshot> snapshot() const {
+        return snapshot_.load(std::memory_order_acquire);
+    }
+    
+    uint64_t getVersion() const { return snapshot_version_.load(std::memory_order_acquire); }
+    
+    // Convenience methods for direct value access; reads the current
+    // snapshot without locking
+    template<typename T>
+    T get(const std::string& section_name, const std::string& key, const T& default_value = T{}) const {
+        return currentSnapshot().template get<T>(section_name, key, default_value);
+    }
+    
+    // Typed handle access: an indexed load from the current snapshot. The
+    // value is copied out because this thread's cached snapshot is replaced
+    // by its next read after a change; to read strings or lists without a
+    // copy, pin snapshot() and read through it.
     template<typename T>
-    T get(const std::string& section_name, const std::string& key, const T& default_value = T{}) {
-        return getSection(section_name).template get<T>(key, default_value);
+    T get(const ConfigKey<T>& key) const {
+        return currentSnapshot().get(key);
+    }
+    
+    // Register (or look up) a typed handle. The optional validator runs when
+    // a value is set or loaded, never on reads; rejected values are not stored.
+    template<typename T>
+    ConfigKey<T> registerKey(const std::string& section_name, const std::string& key, T default_value = T{},
+                             std::function<bool(const T&)> validator = {}) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& keys = std::get<std::vector<ConfigKey<T>>>(key_registry_);
+        
+        if (validator) {
+            validators_[section_name + "." + key] = [validator = std::move(validator)](const ConfigValue& value) {
+                auto typed = value.template tryGet<T>();
+                return typed.has_value() && validator(*typed);
+            };
+        }
+        
+        for (const auto& existing : keys) {
+            if (existing.section() == section_name && existing.key() == key) {
+                return existing;
+            }
+        }
+        
+        keys.push_back(ConfigKey<T>(keys.size(), section_name, key, std::move(default_value)));
+        publishLocked();
+        return keys.back();
+    }
+    
+    template<typename T>
+    void set(const ConfigKey<T>& key, T value) {
+        set(key.section(), key.key(), std::move(value));
     }
     
     template<typename T>
     void set(const std::string& section_name, const std::string& key, T&& value, 
              const std::string& description = "", bool readonly = false) {
-        getSection(section_name).set(key, std::forward<T>(value), description, readonly);
-        
-        // Validate if validator exists
+        ConfigValue config_val(std::forward<T>(value), description, readonly);
         std::string full_key = section_name + "." + key;
-        auto validator_it = validators_.find(full_key);
-        if (validator_it != validators_.end()) {
-            auto config_val = getSection(section_name).getConfigValue(key);
-            if (config_val && !validator_it->second(*config_val)) {
+        std::string save_path;
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            
+            // Validate before the value becomes visible
+            auto validator_it = validators_.find(full_key);
+            if (validator_it != validators_.end() && !validator_it->second(config_val)) {
                 throw std::runtime_error("Configuration value validation failed for: " + full_key);
             }
+            
+            sectionLocked(section_name).store(key, config_val);
+            publishSectionLocked(section_name);
+            if (auto_save_) save_path = current_config_file_;
         }
         
         // Notify change
-        if (auto config_val = getSection(section_name).getConfigValue(key)) {
-            notifyChange(full_key, *config_val);
-        }
+        notifyChange(full_key, config_val);
         
         // Auto-save if enabled
-        if (auto_save_ && !current_config_file_.empty()) {
-            saveToFile(current_config_file_);
+        if (!save_path.empty()) {
+            saveToFile(save_path);
         }
     }
     
-    // File operations
+    // File operations. Loads parse without holding any lock and then swap in
+    // a new snapshot, so readers are never blocked by a reload.
     bool loadFromFile(const std::string& filename);
     bool saveToFile(const std::string& filename) const;
     bool loadFromJson(const std::string& json_content);
     std::string saveToJson() const;
     
+    // Reload on a background thread; keep the future, as discarding it waits
+    [[nodiscard]] std::future<bool> reloadAsync(const std::string& filename = "") {
+        std::string path = filename.empty() ? getCurrentConfigFile() : filename;
+        return std::async(std::launch::async, [this, path]() { return loadFromFile(path); });
+    }
+    
+    bool reload() { return loadFromFile(getCurrentConfigFile()); }
+    
     // Environment variable loading
     void loadFromEnvironment(const std::string& prefix = "CPPVERSEHUB_");
     
@@ -372,19 +655,28 @@ public:
     
     // Auto-save functionality
     void setAutoSave(bool enabled, const std::string& filename = "") {
+        std::lock_guard<std::mutex> lock(mutex_);
         auto_save_ = enabled;
         if (!filename.empty()) {
             current_config_file_ = filename;
         }
     }
     
-    bool isAutoSaveEnabled() const { return auto_save_; }
-    const std::string& getCurrentConfigFile() const { return current_config_file_; }
+    bool isAutoSaveEnabled() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return auto_save_;
+    }
+    
+    std::string getCurrentConfigFile() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return current_config_file_;
+    }
     
     // Validation
     void addValidator(const std::string& section_name, const std::string& key,
                      std::function<bool(const ConfigValue&)> validator) {
         std::string full_key = section_name + "." + key;
+        std::lock_guard<std::mutex> lock(mutex_);
         validators_[full_key] = std::move(validator);
     }
     
@@ -392,9 +684,16 @@ public:
     void addChangeListener(const std::string& section_name, const std::string& key,
                           std::function<void(const std::string&, const ConfigValue&)> listener) {
         std::string full_key = section_name + "." + key;
+        std::lock_guard<std::mutex> lock(mutex_);
         change_listeners_[full_key].push_back(std::move(listener));
     }
     
+    // Called once per load/reload that changed anything, with the full diff
+    void addReloadListener(std::function<void(const ConfigDiff&)> listener) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reload_listeners_.push_back(std::move(listener));
+    }
+    
     // Configuration paths
     void addConfigPath(const std::string& path) {
         config_file_paths_.push_back(path);
@@ -403,6 +702,7 @@ public:
     bool loadFromPaths() {
         for (const auto& path : config_file_paths_) {
             if (loadFromFile(path)) {
+                std::lock_guard<std::mutex> lock(mutex_);
                 current_config_file_ = path;
                 return true;
             }
@@ -414,8 +714,11 @@ public:
     void clear() {
         std::lock_guard<std::mutex> lock(mutex_);
         sections_.clear();
+        file_keys_.clear();
         validators_.clear();
         change_listeners_.clear();
+        reload_listeners_.clear();
+        publishLocked();
     }
     
     size_t getSectionCount() const {
@@ -2,8 +2,20 @@
 // JSON, CSV, XML Parsing Implementation
 
 #include "FileParser.hpp"
+#include "ParallelTasks.hpp"
 #include <iostream>
 #include <iomanip>
+#include <numeric>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CPPVERSEHUB_HAS_MMAP 1
+#else
+#define CPPVERSEHUB_HAS_MMAP 0
+#endif
 
 namespace CppVerseHub::Utils {
 
@@ -255,6 +267,977 @@ JsonValue JsonParser::parseObject() {
     return JsonValue(object);
 }
 
+// ===== MEMORY-MAPPED INPUT =====
+
+MappedFile::MappedFile(const std::string& filename) : filename_(filename) {
+#if CPPVERSEHUB_HAS_MMAP
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw FileNotFoundException(filename);
+    }
+    
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw ParseException("Cannot stat file: " + filename);
+    }
+    
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ > 0) {
+        void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            throw ParseException("Cannot map file: " + filename);
+        }
+        // Parsers read front to back; let the kernel read ahead and drop pages behind
+        ::madvise(mapping, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(mapping);
+        mapped_ = true;
+    }
+    ::close(fd);
+#else
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw FileNotFoundException(filename);
+    }
+    buffer_.assign((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_), size_(other.size_), released_(other.released_), mapped_(other.mapped_),
+      filename_(std::move(other.filename_)), buffer_(std::move(other.buffer_)) {
+    if (!mapped_) {
+        data_ = buffer_.data();
+    }
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.mapped_ = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = other.data_;
+        size_ = other.size_;
+        released_ = other.released_;
+        mapped_ = other.mapped_;
+        filename_ = std::move(other.filename_);
+        buffer_ = std::move(other.buffer_);
+        if (!mapped_) {
+            data_ = buffer_.data();
+        }
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.mapped_ = false;
+    }
+    return *this;
+}
+
+void MappedFile::release() noexcept {
+#if CPPVERSEHUB_HAS_MMAP
+    if (mapped_) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    released_ = 0;
+    mapped_ = false;
+}
+
+void MappedFile::releaseBefore(size_t offset) {
+#if CPPVERSEHUB_HAS_MMAP
+    if (!mapped_) return;
+    
+    size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    size_t end = std::min(offset, size_) / page_size * page_size;
+    if (end > released_) {
+        ::madvise(const_cast<char*>(data_) + released_, end - released_, MADV_DONTNEED);
+        released_ = end;
+    }
+#else
+    (void)offset;
+#endif
+}
+
+// ===== ZERO-COPY JSON LEXER =====
+
+namespace {
+
+size_t encodeUtf8(uint32_t codepoint, char* out) {
+    if (codepoint < 0x80) {
+        out[0] = static_cast<char>(codepoint);
+        return 1;
+    }
+    if (codepoint < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (codepoint >> 6));
+        out[1] = static_cast<char>(0x80 | (codepoint & 0x3F));
+        return 2;
+    }
+    if (codepoint < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | (codepoint >> 12));
+        out[1] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (codepoint & 0x3F));
+        return 3;
+    }
+    out[0] = static_cast<char>(0xF0 | (codepoint >> 18));
+    out[1] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (codepoint & 0x3F));
+    return 4;
+}
+
+uint32_t readHex4(const char* p) {
+    return static_cast<uint32_t>((JsonScan::hexValue(p[0]) << 12) | (JsonScan::hexValue(p[1]) << 8) |
+                                 (JsonScan::hexValue(p[2]) << 4) | JsonScan::hexValue(p[3]));
+}
+
+} // namespace
+
+size_t JsonLexer::unescape(std::string_view raw, char* out) {
+    const char* p = raw.data();
+    const char* end = p + raw.size();
+    char* written = out;
+    
+    while (p < end) {
+        // Copy the run up to the next escape in one go
+        const char* escape = static_cast<const char*>(std::memchr(p, '\\', static_cast<size_t>(end - p)));
+        const char* run_end = escape ? escape : end;
+        std::memcpy(written, p, static_cast<size_t>(run_end - p));
+        written += run_end - p;
+        if (!escape) break;
+        
+        p = escape + 1;
+        switch (*p++) {
+            case '"': *written++ = '"'; break;
+            case '\\': *written++ = '\\'; break;
+            case '/': *written++ = '/'; break;
+            case 'b': *written++ = '\b'; break;
+            case 'f': *written++ = '\f'; break;
+            case 'n': *written++ = '\n'; break;
+            case 'r': *written++ = '\r'; break;
+            case 't': *written++ = '\t'; break;
+            case 'u': {
+                uint32_t codepoint = readHex4(p);
+                p += 4;
+                if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                    // High surrogate: combine with a following low surrogate
+                    if (end - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+                        uint32_t low = readHex4(p + 2);
+                        if (low >= 0xDC00 && low <= 0xDFFF) {
+                            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                            p += 6;
+                        } else {
+                            codepoint = 0xFFFD;
+                        }
+                    } else {
+                        codepoint = 0xFFFD;
+                    }
+                } else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+                    codepoint = 0xFFFD;
+                }
+                written += encodeUtf8(codepoint, written);
+                break;
+            }
+            default:
+                // The lexer has already rejected any other escape
+                break;
+        }
+    }
+    
+    return static_cast<size_t>(written - out);
+}
+
+std::pair<size_t, size_t> JsonLexer::lineColumn(size_t offset) const {
+    size_t line = 1;
+    size_t line_start = 0;
+    const char* p = begin_;
+    const char* target = begin_ + std::min(offset, static_cast<size_t>(end_ - begin_));
+    
+    while (p < target) {
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(target - p)));
+        if (!newline) break;
+        ++line;
+        line_start = static_cast<size_t>(newline - begin_) + 1;
+        p = newline + 1;
+    }
+    
+    return {line, offset - line_start + 1};
+}
+
+// ===== ARENA-BACKED JSON DOCUMENT =====
+
+JsonDocument JsonDocument::parse(std::string_view json) {
+    JsonDocument document;
+    document.source_ = json;
+    document.build();
+    return document;
+}
+
+JsonDocument JsonDocument::parseFromFile(const std::string& filename) {
+    JsonDocument document;
+    document.file_ = std::make_unique<MappedFile>(filename);
+    document.source_ = document.file_->view();
+    document.build();
+    return document;
+}
+
+char* JsonDocument::allocateChars(size_t count) {
+    if (count > block_remaining_) {
+        size_t block_size = std::max(StringBlockSize, count);
+        string_blocks_.push_back(std::make_unique<char[]>(block_size));
+        block_cursor_ = string_blocks_.back().get();
+        block_remaining_ = block_size;
+    }
+    char* result = block_cursor_;
+    block_cursor_ += count;
+    block_remaining_ -= count;
+    return result;
+}
+
+void JsonDocument::build() {
+    JsonLexer lexer(source_);
+    
+    // Roughly one node per 16 bytes of typical (indented) JSON
+    nodes_.reserve(source_.size() / 16 + 1);
+    parseValue(lexer);
+    
+    lexer.skipWhitespace();
+    if (!lexer.atEnd()) {
+        lexer.fail("Unexpected characters after JSON");
+    }
+}
+
+void JsonDocument::clear() {
+    nodes_.clear();
+    if (!string_blocks_.empty()) {
+        // Keep one block for the next document
+        string_blocks_.resize(1);
+        block_cursor_ = string_blocks_.front().get();
+        block_remaining_ = StringBlockSize;
+    }
+}
+
+void JsonDocument::parseValue(JsonLexer& lexer) {
+    struct OpenContainer {
+        size_t node;
+        bool object;
+    };
+    std::vector<OpenContainer> open;
+    
+    auto pushNode = [&](JsonValue::Type type) -> Node& {
+        if (nodes_.size() >= UINT32_MAX) {
+            lexer.fail("JSON document too large");
+        }
+        Node node;
+        node.number = 0.0;
+        node.size = 0;
+        node.span = 1;
+        node.type = type;
+        nodes_.push_back(node);
+        return nodes_.back();
+    };
+    
+    auto pushString = [&]() {
+        bool escaped = false;
+        std::string_view raw = lexer.scanString(escaped);
+        if (raw.size() > UINT32_MAX) {
+            lexer.fail("JSON string too large");
+        }
+        Node& node = pushNode(JsonValue::Type::String);
+        if (escaped) {
+            char* decoded = allocateChars(raw.size());
+            node.chars = decoded;
+            node.size = static_cast<uint32_t>(JsonLexer::unescape(raw, decoded));
+        } else {
+            node.chars = raw.data();
+            node.size = static_cast<uint32_t>(raw.size());
+        }
+    };
+    
+    auto parseKey = [&]() {
+        lexer.skipWhitespace();
+        if (lexer.peek() != '"') {
+            lexer.fail("Expected string key in object");
+        }
+        pushString();
+        lexer.skipWhitespace();
+        if (lexer.peek() != ':') {
+            lexer.fail("Expected ':' after key in object");
+        }
+        lexer.advance();
+    };
+    
+    while (true) {
+        // Parse one value; containers are entered rather than recursed into
+        lexer.skipWhitespace();
+        char c = lexer.peek();
+        switch (c) {
+            case '{':
+            case '[': {
+                lexer.advance();
+                bool object = c == '{';
+                open.push_back({nodes_.size(), object});
+                pushNode(object ? JsonValue::Type::Object : JsonValue::Type::Array);
+                
+                lexer.skipWhitespace();
+                if (lexer.peek() != (object ? '}' : ']')) {
+                    if (object) parseKey();
+                    continue;
+                }
+                lexer.advance();
+                open.pop_back();
+                break;
+            }
+            case '"':
+                pushString();
+                break;
+            case 't':
+                lexer.expectLiteral("true");
+                pushNode(JsonValue::Type::Boolean).boolean = true;
+                break;
+            case 'f':
+                lexer.expectLiteral("false");
+                pushNode(JsonValue::Type::Boolean).boolean = false;
+                break;
+            case 'n':
+                lexer.expectLiteral("null");
+                pushNode(JsonValue::Type::Null);
+                break;
+            case '-':
+            case '0': case '1': case '2': case '3': case '4':
+            case '5': case '6': case '7': case '8': case '9': {
+                double number = lexer.scanNumber();
+                pushNode(JsonValue::Type::Number).number = number;
+                break;
+            }
+            default:
+                if (lexer.atEnd()) {
+                    lexer.fail("Unexpected end of input");
+                }
+                lexer.fail("Unexpected character: " + std::string(1, c));
+        }
+        
+        // A value is complete: count it, then either move on to the next
+        // element or close every container that ends here
+        while (!open.empty()) {
+            OpenContainer& top = open.back();
+            Node& container = nodes_[top.node];
+            ++container.size;
+            
+            lexer.skipWhitespace();
+            char next = lexer.peek();
+            if (next == ',') {
+                lexer.advance();
+                if (top.object) parseKey();
+                break;
+            }
+            if (next != (top.object ? '}' : ']')) {
+                lexer.fail(top.object ? "Expected ',' or '}' in object" : "Expected ',' or ']' in array");
+            }
+            lexer.advance();
+            container.span = static_cast<uint32_t>(nodes_.size() - top.node);
+            open.pop_back();
+        }
+        
+        if (open.empty()) break;
+    }
+}
+
+JsonValue JsonElement::toValue() const {
+    switch (getType()) {
+        case JsonValue::Type::Null:
+            return JsonValue(nullptr);
+        case JsonValue::Type::Boolean:
+            return JsonValue(node_->boolean);
+        case JsonValue::Type::Number:
+            return JsonValue(node_->number);
+        case JsonValue::Type::String:
+            return JsonValue(std::string(asString()));
+        case JsonValue::Type::Array: {
+            JsonValue::JsonArray array;
+            array.reserve(node_->size);
+            for (JsonElement element : elements()) {
+                array.push_back(element.toValue());
+            }
+            return JsonValue(array);
+        }
+        case JsonValue::Type::Object: {
+            JsonValue::JsonObject object;
+            object.reserve(node_->size);
+            for (const auto& [key, value] : members()) {
+                object[std::string(key)] = value.toValue();
+            }
+            return JsonValue(object);
+        }
+        default:
+            break;
+    }
+    return JsonValue();
+}
+
+// ===== STREAMING JSON READER =====
+
+JsonReader::JsonReader(std::unique_ptr<MappedFile> file)
+    : file_(std::move(file)), lexer_(file_->view()) {}
+
+JsonReader JsonReader::fromFile(const std::string& filename) {
+    return JsonReader(std::make_unique<MappedFile>(filename));
+}
+
+JsonReader::Event JsonReader::next() {
+    switch (state_) {
+        case State::ExpectValue:
+            return readValue();
+            
+        case State::FirstOrEnd: {
+            lexer_.skipWhitespace();
+            bool object = containers_.back();
+            if (lexer_.peek() == (object ? '}' : ']')) {
+                return closeContainer();
+            }
+            return object ? readKey() : readValue();
+        }
+        
+        case State::AfterValue: {
+            lexer_.skipWhitespace();
+            if (containers_.empty()) {
+                if (!lexer_.atEnd()) {
+                    lexer_.fail("Unexpected characters after JSON");
+                }
+                state_ = State::Done;
+                return event_ = Event::EndOfDocument;
+            }
+            
+            bool object = containers_.back();
+            char c = lexer_.peek();
+            if (c == ',') {
+                lexer_.advance();
+                return object ? readKey() : readValue();
+            }
+            if (c == (object ? '}' : ']')) {
+                return closeContainer();
+            }
+            lexer_.fail(object ? "Expected ',' or '}' in object" : "Expected ',' or ']' in array");
+        }
+        
+        case State::Done:
+        default:
+            break;
+    }
+    return event_ = Event::EndOfDocument;
+}
+
+JsonReader::Event JsonReader::readValue() {
+    lexer_.skipWhitespace();
+    char c = lexer_.peek();
+    state_ = State::AfterValue;
+    
+    switch (c) {
+        case '{':
+            lexer_.advance();
+            containers_.push_back(true);
+            state_ = State::FirstOrEnd;
+            return event_ = Event::StartObject;
+        case '[':
+            lexer_.advance();
+            containers_.push_back(false);
+            state_ = State::FirstOrEnd;
+            return event_ = Event::StartArray;
+        case '"':
+            raw_string_ = lexer_.scanString(escaped_);
+            decoded_valid_ = false;
+            return event_ = Event::String;
+        case 't':
+            lexer_.expectLiteral("true");
+            boolean_ = true;
+            return event_ = Event::Boolean;
+        case 'f':
+            lexer_.expectLiteral("false");
+            boolean_ = false;
+            return event_ = Event::Boolean;
+        case 'n':
+            lexer_.expectLiteral("null");
+            return event_ = Event::Null;
+        case '-':
+        case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9':
+            number_ = lexer_.scanNumber();
+            return event_ = Event::Number;
+        default:
+            if (lexer_.atEnd()) {
+                lexer_.fail("Unexpected end of input");
+            }
+            lexer_.fail("Unexpected character: " + std::string(1, c));
+    }
+}
+
+JsonReader::Event JsonReader::readKey() {
+    lexer_.skipWhitespace();
+    if (lexer_.peek() != '"') {
+        lexer_.fail("Expected string key in object");
+    }
+    raw_string_ = lexer_.scanString(escaped_);
+    decoded_valid_ = false;
+    
+    lexer_.skipWhitespace();
+    if (lexer_.peek() != ':') {
+        lexer_.fail("Expected ':' after key in object");
+    }
+    lexer_.advance();
+    
+    state_ = State::ExpectValue;
+    return event_ = Event::Key;
+}
+
+JsonReader::Event JsonReader::closeContainer() {
+    lexer_.advance();
+    bool object = containers_.back();
+    containers_.pop_back();
+    state_ = State::AfterValue;
+    return event_ = object ? Event::EndObject : Event::EndArray;
+}
+
+std::string_view JsonReader::stringValue() const {
+    if (event_ != Event::Key && event_ != Event::String) {
+        throw std::logic_error("JsonReader: current event is not a string or key");
+    }
+    if (!escaped_) {
+        return raw_string_;
+    }
+    if (!decoded_valid_) {
+        decoded_.resize(raw_string_.size());
+        decoded_.resize(JsonLexer::unescape(raw_string_, decoded_.data()));
+        decoded_valid_ = true;
+    }
+    return decoded_;
+}
+
+bool JsonReader::nextElement() {
+    if (containers_.empty() || containers_.back() ||
+        (state_ != State::FirstOrEnd && state_ != State::AfterValue)) {
+        throw std::logic_error("JsonReader::nextElement: cursor is not between array elements");
+    }
+    
+    if (file_ && lexer_.offset() - released_offset_ >= ReleaseInterval) {
+        file_->releaseBefore(lexer_.offset());
+        released_offset_ = lexer_.offset();
+    }
+    
+    lexer_.skipWhitespace();
+    if (lexer_.peek() == ']') {
+        closeContainer();
+        return false;
+    }
+    if (state_ == State::AfterValue) {
+        if (lexer_.peek() != ',') {
+            lexer_.fail("Expected ',' or ']' in array");
+        }
+        lexer_.advance();
+    }
+    state_ = State::ExpectValue;
+    return true;
+}
+
+void JsonReader::skipValue() {
+    size_t start_depth = depth();
+    Event event = next();
+    if (event == Event::StartObject || event == Event::StartArray) {
+        while (depth() > start_depth) {
+            next();
+        }
+    }
+}
+
+JsonDocument JsonReader::readDocument() {
+    JsonDocument document;
+    readDocument(document);
+    return document;
+}
+
+void JsonReader::readDocument(JsonDocument& document) {
+    if (state_ != State::ExpectValue) {
+        throw std::logic_error("JsonReader::readDocument: cursor is not in front of a value");
+    }
+    
+    document.clear();
+    document.file_.reset();
+    document.source_ = lexer_.input();
+    document.parseValue(lexer_);
+    state_ = State::AfterValue;
+}
+
+// ===== COLUMNAR CSV READER =====
+
+namespace {
+
+struct CsvFieldSpan {
+    const char* begin;
+    const char* end;
+    bool quoted;
+    bool escaped;   // Quoted field containing doubled quotes
+};
+
+// Split one record into fields and return the start of the next record.
+// Quoted fields may contain delimiters and newlines; unquoted fields are
+// trimmed of surrounding blanks and a trailing '\r'.
+const char* readCsvRecord(const char* p, const char* end, char delimiter, char quote,
+                          std::vector<CsvFieldSpan>& fields) {
+    fields.clear();
+    
+    while (true) {
+        while (p < end && (*p == ' ' || *p == '\t') && *p != delimiter) ++p;
+        
+        CsvFieldSpan field{p, p, false, false};
+        if (p < end && *p == quote) {
+            field.quoted = true;
+            field.begin = ++p;
+            while (true) {
+                const void* found = std::memchr(p, quote, static_cast<size_t>(end - p));
+                p = found ? static_cast<const char*>(found) : end;
+                if (p + 1 < end && p[1] == quote) {
+                    field.escaped = true;
+                    p += 2;
+                    continue;
+                }
+                break;
+            }
+            field.end = p;
+            if (p < end) ++p;
+            while (p < end && *p != delimiter && *p != '\n') ++p;
+        } else {
+            while (p < end && *p != delimiter && *p != '\n') ++p;
+            field.end = p;
+            while (field.end > field.begin &&
+                   (field.end[-1] == ' ' || field.end[-1] == '\t' || field.end[-1] == '\r')) {
+                --field.end;
+            }
+        }
+        fields.push_back(field);
+        
+        if (p < end && *p == delimiter) {
+            ++p;
+            continue;
+        }
+        return p < end ? p + 1 : p;
+    }
+}
+
+bool isBlankRecord(const std::vector<CsvFieldSpan>& fields) {
+    return fields.size() == 1 && fields[0].begin == fields[0].end && !fields[0].quoted;
+}
+
+std::string decodeCsvField(const CsvFieldSpan& field, char quote) {
+    std::string value;
+    value.reserve(static_cast<size_t>(field.end - field.begin));
+    for (const char* p = field.begin; p < field.end; ++p) {
+        value += *p;
+        if (*p == quote && field.escaped && p + 1 < field.end && p[1] == quote) ++p;
+    }
+    return value;
+}
+
+// from_chars rejects the leading '+' that std::stoi/std::stod accept
+const char* skipCsvPlus(const CsvFieldSpan& field) {
+    if (field.end - field.begin > 1 && field.begin[0] == '+' && field.begin[1] != '-') return field.begin + 1;
+    return field.begin;
+}
+
+bool parseCsvInteger(const CsvFieldSpan& field, int64_t& value) {
+    auto result = std::from_chars(skipCsvPlus(field), field.end, value);
+    return result.ec == std::errc() && result.ptr == field.end;
+}
+
+bool parseCsvDouble(const CsvFieldSpan& field, double& value) {
+    auto result = std::from_chars(skipCsvPlus(field), field.end, value);
+    return result.ec == std::errc() && result.ptr == field.end;
+}
+
+// Rows of one chunk, parsed into columns of the table's types
+struct CsvChunkColumn {
+    CsvColumn::Type type;
+    std::vector<int64_t> integers;
+    std::vector<double> doubles;
+    std::vector<char> chars;
+    std::vector<uint64_t> ends;   // End offset of each string row within chars
+    std::vector<uint8_t> nulls;
+};
+
+struct CsvChunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    size_t rows = 0;
+    size_t row_offset = 0;
+    size_t conversion_errors = 0;
+    std::vector<CsvChunkColumn> columns;
+};
+
+void appendCsvValue(CsvChunkColumn& column, const CsvFieldSpan* field, char quote, size_t& errors) {
+    // A quoted empty field is an empty string, but a null number
+    const bool empty = field == nullptr || field->begin == field->end;
+    
+    if (column.type == CsvColumn::Type::String) {
+        const bool null = empty && (field == nullptr || !field->quoted);
+        if (!empty) {
+            if (field->escaped) {
+                std::string decoded = decodeCsvField(*field, quote);
+                column.chars.insert(column.chars.end(), decoded.begin(), decoded.end());
+            } else {
+                column.chars.insert(column.chars.end(), field->begin, field->end);
+            }
+        }
+        column.ends.push_back(column.chars.size());
+        column.nulls.push_back(null ? 1 : 0);
+        return;
+    }
+    
+    if (column.type == CsvColumn::Type::Integer) {
+        int64_t value = 0;
+        if (empty || parseCsvInteger(*field, value)) {
+            column.integers.push_back(value);
+            column.nulls.push_back(empty ? 1 : 0);
+            return;
+        }
+        double real = 0.0;
+        if (!parseCsvDouble(*field, real)) {
+            ++errors;
+            column.integers.push_back(0);
+            column.nulls.push_back(1);
+            return;
+        }
+        // A fractional value: widen what this chunk has read so far
+        column.type = CsvColumn::Type::Double;
+        column.doubles.assign(column.integers.begin(), column.integers.end());
+        column.integers.clear();
+        column.integers.shrink_to_fit();
+    }
+    
+    double value = 0.0;
+    bool parsed = empty || parseCsvDouble(*field, value);
+    if (!parsed) ++errors;
+    column.doubles.push_back(parsed ? value : 0.0);
+    column.nulls.push_back(parsed && !empty ? 0 : 1);
+}
+
+void parseCsvChunk(CsvChunk& chunk, const std::vector<CsvColumn::Type>& types, const CsvReadOptions& options) {
+    chunk.columns.resize(types.size());
+    for (size_t i = 0; i < types.size(); ++i) chunk.columns[i].type = types[i];
+    
+    std::vector<CsvFieldSpan> fields;
+    const char* p = chunk.begin;
+    while (p < chunk.end) {
+        p = readCsvRecord(p, chunk.end, options.delimiter, options.quote_char, fields);
+        if (isBlankRecord(fields)) continue;
+        
+        for (size_t i = 0; i < chunk.columns.size(); ++i) {
+            appendCsvValue(chunk.columns[i], i < fields.size() ? &fields[i] : nullptr,
+                           options.quote_char, chunk.conversion_errors);
+        }
+        ++chunk.rows;
+    }
+}
+
+CsvColumn::Type inferCsvType(const std::vector<std::vector<CsvFieldSpan>>& sample, size_t column) {
+    bool any = false;
+    bool integers = true;
+    bool doubles = true;
+    for (const auto& record : sample) {
+        if (column >= record.size()) continue;
+        const CsvFieldSpan& field = record[column];
+        if (field.begin == field.end) continue;
+        any = true;
+        int64_t integer = 0;
+        double real = 0.0;
+        if (integers && !parseCsvInteger(field, integer)) integers = false;
+        if (!integers && !parseCsvDouble(field, real)) doubles = false;
+        if (!doubles) break;
+    }
+    if (!any) return CsvColumn::Type::String;
+    if (integers) return CsvColumn::Type::Integer;
+    return doubles ? CsvColumn::Type::Double : CsvColumn::Type::String;
+}
+
+} // namespace
+
+CsvTable CsvTable::parseFromFile(const std::string& filename, const CsvReadOptions& options) {
+    MappedFile file(filename);
+    CsvTable table;
+    table.build(file.view(), options);
+    return table;
+}
+
+CsvTable CsvTable::parseFromString(std::string_view csv, const CsvReadOptions& options) {
+    CsvTable table;
+    table.build(csv, options);
+    return table;
+}
+
+void CsvTable::build(std::string_view csv, const CsvReadOptions& options) {
+    constexpr size_t MinChunkSize = 1 << 20;
+    
+    const char quote = options.quote_char;
+    const char* p = csv.data();
+    const char* const end = csv.data() + csv.size();
+    std::vector<CsvFieldSpan> fields;
+    
+    // Header, then a sample of leading records to size and type the columns
+    std::vector<std::string> names;
+    if (options.has_header) {
+        do {
+            p = readCsvRecord(p, end, options.delimiter, quote, fields);
+        } while (p < end && isBlankRecord(fields));
+        if (!isBlankRecord(fields)) {
+            for (const auto& field : fields) names.push_back(decodeCsvField(field, quote));
+        }
+    }
+    
+    std::vector<std::vector<CsvFieldSpan>> sample;
+    for (const char* s = p; s < end && sample.size() < options.sample_rows;) {
+        s = readCsvRecord(s, end, options.delimiter, quote, fields);
+        if (!isBlankRecord(fields)) sample.push_back(fields);
+    }
+    
+    size_t column_count = names.size();
+    if (!options.has_header) {
+        for (const auto& record : sample) column_count = std::max(column_count, record.size());
+        for (size_t i = 0; i < column_count; ++i) names.push_back("column_" + std::to_string(i));
+    }
+    
+    std::vector<CsvColumn::Type> types(column_count);
+    for (size_t i = 0; i < column_count; ++i) {
+        auto forced = options.column_types.find(names[i]);
+        types[i] = forced != options.column_types.end() ? forced->second : inferCsvType(sample, i);
+    }
+    
+    // Cut the body into chunks that start on record boundaries. Doubled quotes
+    // toggle the quote state twice, so the quote count parity before a cut
+    // says whether the cut lands inside a quoted field.
+    const size_t thread_count = options.threads ? options.threads : parallelTaskThreads();
+    const size_t body_size = static_cast<size_t>(end - p);
+    const size_t chunk_size = std::max(MinChunkSize, body_size / (thread_count * 4) + 1);
+    const size_t cut_count = body_size / chunk_size + 1;
+    
+    std::vector<size_t> quotes(cut_count);
+    runParallelTasks(cut_count, thread_count, [&](size_t i) {
+        const char* begin = p + i * chunk_size;
+        const char* stop = std::min(end, begin + chunk_size);
+        quotes[i] = static_cast<size_t>(std::count(begin, stop, quote));
+    });
+    
+    std::vector<CsvChunk> chunks;
+    const char* chunk_begin = p;
+    bool in_quotes = false;
+    for (size_t i = 1; i < cut_count; ++i) {
+        in_quotes ^= (quotes[i - 1] & 1) != 0;
+        const char* cut = p + i * chunk_size;
+        bool quoted = in_quotes;
+        while (cut < end && (quoted || *cut != '\n')) {
+            if (*cut == quote) quoted = !quoted;
+            ++cut;
+        }
+        if (cut < end) ++cut;
+        if (cut > chunk_begin) {
+            chunks.emplace_back();
+            chunks.back().begin = chunk_begin;
+            chunks.back().end = cut;
+            chunk_begin = cut;
+        }
+    }
+    if (chunk_begin < end || chunks.empty()) {
+        chunks.emplace_back();
+        chunks.back().begin = chunk_begin;
+        chunks.back().end = end;
+    }
+    
+    runParallelTasks(chunks.size(), thread_count, [&](size_t i) { parseCsvChunk(chunks[i], types, options); });
+    
+    // Any chunk that widened a column to double widens it everywhere
+    for (size_t c = 0; c < column_count; ++c) {
+        for (const auto& chunk : chunks) {
+            if (chunk.columns[c].type == CsvColumn::Type::Double) types[c] = CsvColumn::Type::Double;
+        }
+    }
+    
+    rows_ = 0;
+    conversion_errors_ = 0;
+    for (auto& chunk : chunks) {
+        chunk.row_offset = rows_;
+        rows_ += chunk.rows;
+        conversion_errors_ += chunk.conversion_errors;
+    }
+    
+    columns_.assign(column_count, CsvColumn());
+    std::vector<std::vector<size_t>> char_offsets(column_count, std::vector<size_t>(chunks.size(), 0));
+    for (size_t c = 0; c < column_count; ++c) {
+        CsvColumn& column = columns_[c];
+        column.name_ = names[c];
+        column.type_ = types[c];
+        column.nulls_.resize(rows_);
+        switch (column.type_) {
+            case CsvColumn::Type::Integer:
+                column.integers_.resize(rows_);
+                break;
+            case CsvColumn::Type::Double:
+                column.doubles_.resize(rows_);
+                break;
+            case CsvColumn::Type::String: {
+                size_t total = 0;
+                for (size_t i = 0; i < chunks.size(); ++i) {
+                    char_offsets[c][i] = total;
+                    total += chunks[i].columns[c].chars.size();
+                }
+                column.chars_.resize(total);
+                column.offsets_.assign(rows_ + 1, 0);
+                column.offsets_[rows_] = total;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    
+    // Each chunk copies its rows into its own slice of the final columns
+    runParallelTasks(chunks.size(), thread_count, [&](size_t i) {
+        CsvChunk& chunk = chunks[i];
+        for (size_t c = 0; c < column_count; ++c) {
+            CsvChunkColumn& part = chunk.columns[c];
+            CsvColumn& column = columns_[c];
+            std::copy(part.nulls.begin(), part.nulls.end(), column.nulls_.begin() + static_cast<std::ptrdiff_t>(chunk.row_offset));
+            
+            switch (column.type_) {
+                case CsvColumn::Type::Integer:
+                    std::copy(part.integers.begin(), part.integers.end(),
+                              column.integers_.begin() + static_cast<std::ptrdiff_t>(chunk.row_offset));
+                    break;
+                case CsvColumn::Type::Double:
+                    if (part.type == CsvColumn::Type::Integer) {
+                        std::transform(part.integers.begin(), part.integers.end(),
+                                       column.doubles_.begin() + static_cast<std::ptrdiff_t>(chunk.row_offset),
+                                       [](int64_t value) { return static_cast<double>(value); });
+                    } else {
+                        std::copy(part.doubles.begin(), part.doubles.end(),
+                                  column.doubles_.begin() + static_cast<std::ptrdiff_t>(chunk.row_offset));
+                    }
+                    break;
+                case CsvColumn::Type::String: {
+                    const size_t base = char_offsets[c][i];
+                    std::copy(part.chars.begin(), part.chars.end(), column.chars_.begin() + static_cast<std::ptrdiff_t>(base));
+                    for (size_t r = 0; r < part.ends.size(); ++r) {
+                        column.offsets_[chunk.row_offset + r + 1] = base + part.ends[r];
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+            part = CsvChunkColumn{part.type, {}, {}, {}, {}, {}};
+        }
+    });
+}
+
 // ===== DEMONSTRATION FUNCTIONS =====
 
 void demonstrateJsonParser() {
@@ -390,6 +1373,17 @@ void demonstrateCsvParser() {
         std::cout << "\nConverted to JSON:" << std::endl;
         std::cout << FileParserUtils::csvToJson(csv) << std::endl;
         
+        // Same data as typed columns
+        CsvTable table = CsvTable::parseFromString(csv_data);
+        const auto& fuel = table.column("fuel_level").doubles();
+        std::cout << "\nColumnar view: " << table.rowCount() << " rows, fuel column is "
+                  << (table.column("fuel_level").type() == CsvColumn::Type::Double ? "double" : "not double")
+                  << ", max fuel " << *std::max_element(fuel.begin(), fuel.end()) << "%" << std::endl;
+        for (const auto& row : table) {
+            std::cout << "  " << row.get<std::string>("commander").value_or("?")
+                      << ": " << row.get<int>("ship_count").value_or(0) << " ships" << std::endl;
+        }
+        
     } catch (const CsvParseException& e) {
         std::cerr << "CSV Parse Error: " << e.what() << std::endl;
     }
@@ -564,6 +1558,30 @@ void demonstrateSpaceGameParsers() {
     } catch (const std::exception& e) {
         std::cerr << "Planet config parse error: " << e.what() << std::endl;
     }
+    
+    // Demonstrate streaming fleet records one element at a time
+    try {
+        std::ofstream temp_file("temp_fleets.json");
+        temp_file << R"({"fleets": [
+            {"fleet_id": 101, "commander": "Admiral Zhang", "ship_count": 25, "fuel_level": 85.5,
+             "mission_type": "Exploration", "current_location": "Alpha Centauri"},
+            {"fleet_id": 102, "commander": "Commander Rodriguez", "ship_count": 12, "fuel_level": 92.0,
+             "mission_type": "Combat", "current_location": "Sol System"}
+        ]})";
+        temp_file.close();
+        
+        size_t fleet_count = SpaceGameParsers::FleetDataParser::forEachFleetInJson("temp_fleets.json",
+            [](const SpaceGameParsers::FleetData& fleet) {
+                std::cout << "  Fleet " << fleet.fleet_id << ": " << fleet.commander
+                          << " (" << fleet.ship_count << " ships) at " << fleet.current_location << std::endl;
+            });
+        std::cout << "Streamed " << fleet_count << " fleets" << std::endl;
+        
+        std::remove("temp_fleets.json");
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Fleet stream parse error: " << e.what() << std::endl;
+    }
 }
 
 void demonstrateFileUtilities() {
@@ -654,6 +1672,55 @@ void performanceTest() {
         std::cout << "JSON string size: " << json_str.length() << " characters" << std::endl;
         std::cout << "Performance: " << (parsed.size() * 1000 / duration.count()) << " objects/second" << std::endl;
         
+        // Same input through the zero-copy document parser
+        auto tree_start = std::chrono::high_resolution_clock::now();
+        JsonValue tree = JsonParser::parseFromString(json_str);
+        auto tree_time = std::chrono::high_resolution_clock::now() - tree_start;
+        
+        auto document_start = std::chrono::high_resolution_clock::now();
+        JsonDocument document = JsonDocument::parse(json_str);
+        auto document_time = std::chrono::high_resolution_clock::now() - document_start;
+        
+        auto tree_us = std::chrono::duration_cast<std::chrono::microseconds>(tree_time).count();
+        auto document_us = std::chrono::duration_cast<std::chrono::microseconds>(document_time).count();
+        std::cout << "JsonValue tree: " << tree_us << " us, JsonDocument: " << document_us
+                  << " us (" << document.nodeCount() << " nodes, "
+                  << document.root().size() << " objects)" << std::endl;
+        if (document_us > 0) {
+            std::cout << "JsonDocument speedup: " << std::fixed << std::setprecision(1)
+                      << (static_cast<double>(tree_us) / static_cast<double>(document_us)) << "x" << std::endl;
+        }
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Performance test error: " << e.what() << std::endl;
+    }
+    
+    // Row-wise CsvParser against the parallel columnar reader
+    std::ostringstream large_csv;
+    large_csv << "id,name,active,value\n";
+    for (int i = 0; i < num_objects * 100; ++i) {
+        large_csv << i << ",\"Object_" << i << "\"," << (i % 2) << "," << (i * 1.5) << "\n";
+    }
+    std::string csv_str = large_csv.str();
+    
+    try {
+        auto rows_start = std::chrono::high_resolution_clock::now();
+        CsvData rows = CsvParser::parseFromString(csv_str);
+        double value_sum = 0.0;
+        for (size_t i = 0; i < rows.rowCount(); ++i) value_sum += rows[i].getFieldAs<double>(3);
+        auto rows_time = std::chrono::high_resolution_clock::now() - rows_start;
+        
+        auto table_start = std::chrono::high_resolution_clock::now();
+        CsvTable table = CsvTable::parseFromString(csv_str);
+        const auto& values = table.column("value").doubles();
+        double table_sum = std::accumulate(values.begin(), values.end(), 0.0);
+        auto table_time = std::chrono::high_resolution_clock::now() - table_start;
+        
+        auto rows_us = std::chrono::duration_cast<std::chrono::microseconds>(rows_time).count();
+        auto table_us = std::chrono::duration_cast<std::chrono::microseconds>(table_time).count();
+        std::cout << "CsvParser: " << rows_us << " us, CsvTable: " << table_us << " us ("
+                  << table.rowCount() << " rows, sums " << (value_sum == table_sum ? "match" : "differ") << ")" << std::endl;
+        
     } catch (const std::exception& e) {
         std::cerr << "Performance test error: " << e.what() << std::endl;
     }
@@ -15,6 +15,20 @@
 #include <stdexcept>
 #include <algorithm>
 #include <regex>
+#include <chrono>
+#include <string_view>
+#include <charconv>
+#include <cstring>
+#include <cstdint>
+#include <functional>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CPPVERSEHUB_JSON_SSE2 1
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace CppVerseHub::Utils {
 
@@ -79,9 +93,10 @@ public:
         Object
     };
     
-private:
     using JsonObject = std::unordered_map<std::string, JsonValue>;
     using JsonArray = std::vector<JsonValue>;
+    
+private:
     using ValueType = std::variant<std::nullptr_t, bool, double, std::string, JsonArray, JsonObject>;
     
     ValueType value_;
@@ -408,6 +423,573 @@ public:
     }
 };
 
+// ===== MEMORY-MAPPED INPUT =====
+
+// Read-only view of a whole file. On POSIX systems the file is mapped, so
+// parsing touches pages on demand instead of copying the file into a string;
+// elsewhere the contents are read into an owned buffer.
+class MappedFile {
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    size_t released_ = 0;
+    bool mapped_ = false;
+    std::string filename_;
+    std::string buffer_;   // Fallback storage when the file is not mapped
+    
+    void release() noexcept;
+    
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile() { release(); }
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::string_view view() const { return std::string_view(data_, size_); }
+    const std::string& filename() const { return filename_; }
+    bool isMapped() const { return mapped_; }
+    
+    // Drop resident pages before offset; a streaming reader calls this as it
+    // moves on so a file larger than RAM does not fill the page cache. The
+    // data stays readable and is paged back in if touched again.
+    void releaseBefore(size_t offset);
+};
+
+// ===== ZERO-COPY JSON LEXER =====
+
+// Structural scanning helpers. With SSE2 they test 16 bytes per step; the
+// scalar loops are the fallback and handle the tail of the input.
+namespace JsonScan {
+
+inline bool isWhitespace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+#ifdef CPPVERSEHUB_JSON_SSE2
+inline unsigned firstSetBit(unsigned mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+// First non-whitespace byte at or after p, or end
+inline const char* skipWhitespace(const char* p, const char* end) {
+    // Compact JSON has at most one separator byte; avoid the vector setup for it
+    if (p == end || !isWhitespace(*p)) return p;
+    ++p;
+#ifdef CPPVERSEHUB_JSON_SSE2
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriage = _mm_set1_epi8('\r');
+    const __m128i tab = _mm_set1_epi8('\t');
+    while (end - p >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, newline)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(chunk, carriage), _mm_cmpeq_epi8(chunk, tab)));
+        unsigned other = ~static_cast<unsigned>(_mm_movemask_epi8(ws)) & 0xFFFFu;
+        if (other != 0) return p + firstSetBit(other);
+        p += 16;
+    }
+#endif
+    while (p < end && isWhitespace(*p)) ++p;
+    return p;
+}
+
+// First '"' or '\\' at or after p, or end
+inline const char* findQuoteOrEscape(const char* p, const char* end) {
+#ifdef CPPVERSEHUB_JSON_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    while (end - p >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        unsigned special = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash))));
+        if (special != 0) return p + firstSetBit(special);
+        p += 16;
+    }
+#endif
+    while (p < end && *p != '"' && *p != '\\') ++p;
+    return p;
+}
+
+inline bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+} // namespace JsonScan
+
+// Tokenizer over a borrowed buffer. Strings come back as views into the
+// input; positions are plain offsets, turned into line/column only when an
+// error is reported.
+class JsonLexer {
+private:
+    const char* begin_;
+    const char* p_;
+    const char* end_;
+    
+public:
+    explicit JsonLexer(std::string_view input)
+        : begin_(input.data()), p_(input.data()), end_(input.data() + input.size()) {}
+    
+    void skipWhitespace() { p_ = JsonScan::skipWhitespace(p_, end_); }
+    bool atEnd() const { return p_ == end_; }
+    char peek() const { return p_ < end_ ? *p_ : '\0'; }
+    void advance() { ++p_; }
+    size_t offset() const { return static_cast<size_t>(p_ - begin_); }
+    std::string_view input() const { return std::string_view(begin_, static_cast<size_t>(end_ - begin_)); }
+    
+    // Scan the string starting at the current '"' and return the raw bytes
+    // between the quotes. Escape sequences are validated but left in place;
+    // escaped reports whether unescape() is needed.
+    std::string_view scanString(bool& escaped) {
+        const char* start = ++p_;
+        escaped = false;
+        
+        while (true) {
+            p_ = JsonScan::findQuoteOrEscape(p_, end_);
+            if (p_ == end_) {
+                failAt("Unterminated string", static_cast<size_t>(start - 1 - begin_));
+            }
+            if (*p_ == '"') {
+                std::string_view raw(start, static_cast<size_t>(p_ - start));
+                ++p_;
+                return raw;
+            }
+            
+            escaped = true;
+            if (end_ - p_ < 2) {
+                failAt("Unterminated string", static_cast<size_t>(start - 1 - begin_));
+            }
+            switch (p_[1]) {
+                case '"': case '\\': case '/': case 'b':
+                case 'f': case 'n': case 'r': case 't':
+                    p_ += 2;
+                    break;
+                case 'u':
+                    if (end_ - p_ < 6 || JsonScan::hexValue(p_[2]) < 0 || JsonScan::hexValue(p_[3]) < 0 ||
+                        JsonScan::hexValue(p_[4]) < 0 || JsonScan::hexValue(p_[5]) < 0) {
+                        fail("Invalid unicode escape");
+                    }
+                    p_ += 6;
+                    break;
+                default:
+                    fail("Invalid escape sequence");
+            }
+        }
+    }
+    
+    // Decode a raw string validated by scanString() into out, which needs
+    // raw.size() bytes; returns the decoded length. \u escapes are written as
+    // UTF-8, with unpaired surrogates replaced by U+FFFD.
+    static size_t unescape(std::string_view raw, char* out);
+    
+    double scanNumber() {
+        const char* start = p_;
+        bool negative = false;
+        if (p_ < end_ && *p_ == '-') {
+            negative = true;
+            ++p_;
+        }
+        
+        // Integer part
+        const char* digits = p_;
+        uint64_t mantissa = 0;
+        if (p_ < end_ && *p_ == '0') {
+            ++p_;
+        } else if (p_ < end_ && JsonScan::isDigit(*p_)) {
+            while (p_ < end_ && JsonScan::isDigit(*p_)) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p_ - '0');
+                ++p_;
+            }
+        } else {
+            fail("Invalid number format");
+        }
+        bool integral = true;
+        size_t integer_digits = static_cast<size_t>(p_ - digits);
+        
+        // Decimal part
+        if (p_ < end_ && *p_ == '.') {
+            integral = false;
+            ++p_;
+            if (p_ == end_ || !JsonScan::isDigit(*p_)) fail("Invalid number format");
+            while (p_ < end_ && JsonScan::isDigit(*p_)) ++p_;
+        }
+        
+        // Exponent part
+        if (p_ < end_ && (*p_ == 'e' || *p_ == 'E')) {
+            integral = false;
+            ++p_;
+            if (p_ < end_ && (*p_ == '+' || *p_ == '-')) ++p_;
+            if (p_ == end_ || !JsonScan::isDigit(*p_)) fail("Invalid number format");
+            while (p_ < end_ && JsonScan::isDigit(*p_)) ++p_;
+        }
+        
+        // Up to 15 digits convert exactly without a library call
+        if (integral && integer_digits <= 15) {
+            double value = static_cast<double>(mantissa);
+            return negative ? -value : value;
+        }
+        
+        double value = 0.0;
+        auto [ptr, ec] = std::from_chars(start, p_, value);
+        if (ec != std::errc() || ptr != p_) {
+            failAt("Invalid number: " + std::string(start, p_), static_cast<size_t>(start - begin_));
+        }
+        return value;
+    }
+    
+    // Consume a literal such as "true"; the first character has been peeked
+    void expectLiteral(std::string_view literal) {
+        if (static_cast<size_t>(end_ - p_) < literal.size() ||
+            std::memcmp(p_, literal.data(), literal.size()) != 0) {
+            fail("Invalid literal");
+        }
+        p_ += literal.size();
+    }
+    
+    // 1-based line and column of a byte offset, computed on demand
+    std::pair<size_t, size_t> lineColumn(size_t offset) const;
+    
+    [[noreturn]] void fail(const std::string& message) const {
+        failAt(message, offset());
+    }
+    
+    [[noreturn]] void failAt(const std::string& message, size_t offset) const {
+        auto [line, column] = lineColumn(offset);
+        throw JsonParseException(message, line, column);
+    }
+};
+
+// ===== ARENA-BACKED JSON DOCUMENT =====
+
+class JsonElement;
+
+// Read-only DOM built by one pass of JsonLexer. All nodes live in a single
+// array in document order: a container is followed by its children and
+// records how many nodes its subtree spans, so siblings are reached by
+// skipping ahead rather than through per-node allocations. Object members
+// are stored as a key node followed by the value's subtree. Strings without
+// escapes point into the source; escaped ones are decoded into the
+// document's own string arena.
+class JsonDocument {
+public:
+    struct Node {
+        union {
+            double number;
+            const char* chars;   // String and key bytes (not null-terminated)
+            bool boolean;
+        };
+        uint32_t size;    // String length, or number of elements/members
+        uint32_t span;    // Nodes in this subtree, including this one
+        JsonValue::Type type;
+    };
+    
+private:
+    static constexpr size_t StringBlockSize = 64 * 1024;
+    
+    std::vector<Node> nodes_;
+    std::vector<std::unique_ptr<char[]>> string_blocks_;
+    char* block_cursor_ = nullptr;
+    size_t block_remaining_ = 0;
+    std::unique_ptr<MappedFile> file_;
+    std::string_view source_;
+    
+    void build();
+    void parseValue(JsonLexer& lexer);
+    void clear();
+    char* allocateChars(size_t count);
+    
+    friend class JsonReader;
+    
+public:
+    JsonDocument() = default;
+    JsonDocument(JsonDocument&&) noexcept = default;
+    JsonDocument& operator=(JsonDocument&&) noexcept = default;
+    
+    // Parse without copying; json must outlive the document
+    static JsonDocument parse(std::string_view json);
+    
+    // Map the file and parse it in place; the document keeps the mapping alive
+    static JsonDocument parseFromFile(const std::string& filename);
+    
+    // Element handles stay valid for the document's lifetime, including
+    // across moves of the document
+    JsonElement root() const;
+    
+    size_t nodeCount() const { return nodes_.size(); }
+    std::string_view source() const { return source_; }
+};
+
+// Lightweight handle to a node of a JsonDocument, with the same accessors
+// as JsonValue. Strings are returned as views.
+class JsonElement {
+private:
+    using Node = JsonDocument::Node;
+    
+    const Node* node_ = nullptr;
+    
+    const Node& checked(JsonValue::Type type, const char* what) const {
+        if (!node_ || node_->type != type) {
+            throw std::runtime_error(std::string("JsonElement is not ") + what);
+        }
+        return *node_;
+    }
+    
+public:
+    class ElementIterator {
+    private:
+        const Node* node_;
+        
+    public:
+        explicit ElementIterator(const Node* node) : node_(node) {}
+        
+        JsonElement operator*() const { return JsonElement(node_); }
+        ElementIterator& operator++() {
+            node_ += node_->span;
+            return *this;
+        }
+        bool operator==(const ElementIterator& other) const { return node_ == other.node_; }
+        bool operator!=(const ElementIterator& other) const { return node_ != other.node_; }
+    };
+    
+    class MemberIterator {
+    private:
+        const Node* key_;
+        
+    public:
+        explicit MemberIterator(const Node* key) : key_(key) {}
+        
+        std::pair<std::string_view, JsonElement> operator*() const {
+            return {std::string_view(key_->chars, key_->size), JsonElement(key_ + 1)};
+        }
+        MemberIterator& operator++() {
+            key_ += 1 + key_[1].span;
+            return *this;
+        }
+        bool operator==(const MemberIterator& other) const { return key_ == other.key_; }
+        bool operator!=(const MemberIterator& other) const { return key_ != other.key_; }
+    };
+    
+    template<typename Iterator>
+    class Range {
+    private:
+        Iterator begin_;
+        Iterator end_;
+        
+    public:
+        Range(Iterator begin, Iterator end) : begin_(begin), end_(end) {}
+        Iterator begin() const { return begin_; }
+        Iterator end() const { return end_; }
+    };
+    
+    JsonElement() = default;
+    explicit JsonElement(const Node* node) : node_(node) {}
+    
+    // Type checking
+    bool valid() const { return node_ != nullptr; }
+    JsonValue::Type getType() const { return node_ ? node_->type : JsonValue::Type::Null; }
+    bool isNull() const { return getType() == JsonValue::Type::Null; }
+    bool isBool() const { return getType() == JsonValue::Type::Boolean; }
+    bool isNumber() const { return getType() == JsonValue::Type::Number; }
+    bool isString() const { return getType() == JsonValue::Type::String; }
+    bool isArray() const { return getType() == JsonValue::Type::Array; }
+    bool isObject() const { return getType() == JsonValue::Type::Object; }
+    
+    // Value access
+    bool asBool() const { return checked(JsonValue::Type::Boolean, "a boolean").boolean; }
+    double asNumber() const { return checked(JsonValue::Type::Number, "a number").number; }
+    int asInt() const { return static_cast<int>(asNumber()); }
+    
+    std::string_view asString() const {
+        const Node& node = checked(JsonValue::Type::String, "a string");
+        return std::string_view(node.chars, node.size);
+    }
+    
+    Range<ElementIterator> elements() const {
+        const Node& node = checked(JsonValue::Type::Array, "an array");
+        return Range<ElementIterator>(ElementIterator(&node + 1), ElementIterator(&node + node.span));
+    }
+    
+    Range<MemberIterator> members() const {
+        const Node& node = checked(JsonValue::Type::Object, "an object");
+        return Range<MemberIterator>(MemberIterator(&node + 1), MemberIterator(&node + node.span));
+    }
+    
+    // Array/Object access; both walk the children, O(n) in the index or
+    // member count
+    JsonElement operator[](size_t index) const {
+        const Node& node = checked(JsonValue::Type::Array, "an array");
+        if (index >= node.size) {
+            throw std::out_of_range("Array index out of range");
+        }
+        const Node* child = &node + 1;
+        for (size_t i = 0; i < index; ++i) {
+            child += child->span;
+        }
+        return JsonElement(child);
+    }
+    
+    std::optional<JsonElement> find(std::string_view key) const {
+        for (const auto& member : members()) {
+            if (member.first == key) return member.second;
+        }
+        return std::nullopt;
+    }
+    
+    JsonElement operator[](std::string_view key) const {
+        auto member = find(key);
+        if (!member) {
+            throw std::out_of_range("Object key not found: " + std::string(key));
+        }
+        return *member;
+    }
+    
+    bool contains(std::string_view key) const {
+        return isObject() && find(key).has_value();
+    }
+    
+    size_t size() const {
+        switch (getType()) {
+            case JsonValue::Type::Array:
+            case JsonValue::Type::Object:
+            case JsonValue::Type::String:
+                return node_->size;
+            default:
+                return 0;
+        }
+    }
+    
+    bool empty() const {
+        return size() == 0;
+    }
+    
+    // Deep copy into the owning JsonValue representation
+    JsonValue toValue() const;
+    
+    // Optional value access
+    template<typename T>
+    std::optional<T> get() const {
+        if constexpr (std::is_same_v<T, bool>) {
+            if (isBool()) return node_->boolean;
+        } else if constexpr (std::is_same_v<T, int>) {
+            if (isNumber()) return static_cast<int>(node_->number);
+        } else if constexpr (std::is_same_v<T, double>) {
+            if (isNumber()) return node_->number;
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            if (isString()) return asString();
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            if (isString()) return std::string(asString());
+        }
+        return std::nullopt;
+    }
+};
+
+inline JsonElement JsonDocument::root() const {
+    return nodes_.empty() ? JsonElement() : JsonElement(nodes_.data());
+}
+
+// ===== STREAMING JSON READER =====
+
+// Pull cursor over the same lexer as JsonDocument: each next() call reads
+// one event, holding only the stack of open containers, so memory does not
+// grow with the input. Strings are decoded lazily by stringValue().
+// nextElement() and readDocument() combine the two styles, materialising one
+// array element at a time as a small JsonDocument.
+class JsonReader {
+public:
+    enum class Event {
+        StartObject,
+        EndObject,
+        StartArray,
+        EndArray,
+        Key,
+        String,
+        Number,
+        Boolean,
+        Null,
+        EndOfDocument
+    };
+    
+private:
+    enum class State {
+        ExpectValue,      // Before a value: at the start, after a key or after ','
+        FirstOrEnd,       // Just inside '[' or '{'
+        AfterValue,       // After a complete value
+        Done
+    };
+    
+    // Resident pages behind the cursor are dropped in steps of this size
+    static constexpr size_t ReleaseInterval = 64 * 1024 * 1024;
+    
+    std::unique_ptr<MappedFile> file_;
+    JsonLexer lexer_;
+    std::vector<bool> containers_;   // true for objects
+    State state_ = State::ExpectValue;
+    Event event_ = Event::Null;
+    std::string_view raw_string_;
+    bool escaped_ = false;
+    double number_ = 0.0;
+    bool boolean_ = false;
+    mutable std::string decoded_;
+    mutable bool decoded_valid_ = false;
+    size_t released_offset_ = 0;
+    
+    explicit JsonReader(std::unique_ptr<MappedFile> file);
+    
+    Event readValue();
+    Event readKey();
+    Event closeContainer();
+    
+public:
+    // Read without copying; json must outlive the reader
+    explicit JsonReader(std::string_view json) : lexer_(json) {}
+    
+    // Map the file and read it front to back
+    static JsonReader fromFile(const std::string& filename);
+    
+    Event next();
+    Event event() const { return event_; }
+    
+    // Current Key or String; valid until the next call that moves the cursor
+    std::string_view stringValue() const;
+    double numberValue() const { return number_; }
+    bool boolValue() const { return boolean_; }
+    
+    // Number of open containers
+    size_t depth() const { return containers_.size(); }
+    size_t offset() const { return lexer_.offset(); }
+    
+    // Inside an array: move to its next element and return true, or consume
+    // the closing ']' and return false
+    bool nextElement();
+    
+    // Skip the value the cursor is in front of (after Key or nextElement())
+    void skipValue();
+    
+    // Parse the value the cursor is in front of into a document. Its strings
+    // may point into the reader's input, so use it while the reader lives.
+    // The overload taking a document reuses that document's storage.
+    JsonDocument readDocument();
+    void readDocument(JsonDocument& document);
+};
+
 // ===== CSV DATA STRUCTURES =====
 
 struct CsvRow {
@@ -698,9 +1280,189 @@ public:
     }
 };
 
+// ===== COLUMNAR CSV READER =====
+
+// One typed column of a CsvTable. Empty fields, and fields that do not
+// parse as the column's type, are stored as nulls.
+class CsvColumn {
+public:
+    enum class Type {
+        Integer,
+        Double,
+        String
+    };
+    
+private:
+    std::string name_;
+    Type type_ = Type::String;
+    std::vector<int64_t> integers_;
+    std::vector<double> doubles_;
+    std::vector<char> chars_;          // String column bytes
+    std::vector<uint64_t> offsets_;    // Row i spans [offsets_[i], offsets_[i + 1])
+    std::vector<uint8_t> nulls_;
+    
+    friend class CsvTable;
+    
+public:
+    const std::string& name() const { return name_; }
+    Type type() const { return type_; }
+    size_t size() const { return nulls_.size(); }
+    bool isNull(size_t row) const { return nulls_.at(row) != 0; }
+    size_t nullCount() const { return static_cast<size_t>(std::count(nulls_.begin(), nulls_.end(), uint8_t{1})); }
+    
+    // Whole-column access; null rows hold 0
+    const std::vector<int64_t>& integers() const {
+        if (type_ != Type::Integer) throw std::runtime_error("CsvColumn is not an integer column: " + name_);
+        return integers_;
+    }
+    
+    const std::vector<double>& doubles() const {
+        if (type_ != Type::Double) throw std::runtime_error("CsvColumn is not a double column: " + name_);
+        return doubles_;
+    }
+    
+    std::string_view stringAt(size_t row) const {
+        if (type_ != Type::String) throw std::runtime_error("CsvColumn is not a string column: " + name_);
+        return std::string_view(chars_.data() + offsets_.at(row), offsets_[row + 1] - offsets_[row]);
+    }
+    
+    // Typed access to one row: nullopt for nulls. Numeric columns convert
+    // between integer and floating-point types; strings need a String column.
+    template<typename T>
+    std::optional<T> get(size_t row) const {
+        if (isNull(row)) return std::nullopt;
+        
+        if constexpr (std::is_arithmetic_v<T>) {
+            switch (type_) {
+                case Type::Integer: return static_cast<T>(integers_[row]);
+                case Type::Double: return static_cast<T>(doubles_[row]);
+                case Type::String:
+                default:
+                    break;
+            }
+            throw std::runtime_error("CsvColumn is not numeric: " + name_);
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            return stringAt(row);
+        } else {
+            static_assert(std::is_same_v<T, std::string>, "CsvColumn::get supports arithmetic types and strings");
+            return std::string(stringAt(row));
+        }
+    }
+};
+
+struct CsvReadOptions {
+    char delimiter = ',';
+    char quote_char = '"';
+    bool has_header = true;
+    size_t threads = 0;          // 0 uses every thread of the shared utility pool
+    size_t sample_rows = 1000;   // Leading rows used to infer column types
+    std::map<std::string, CsvColumn::Type> column_types;   // Overrides inference by header name
+};
+
+// Column-oriented CSV data. The input is split at row boundaries (quote-aware,
+// so quoted fields may contain newlines) and the pieces are parsed in parallel
+// straight into typed columns with std::from_chars. Column types are inferred
+// from the first sample_rows rows; an integer column that later meets a
+// fractional value becomes a double column.
+class CsvTable {
+private:
+    std::vector<CsvColumn> columns_;
+    size_t rows_ = 0;
+    size_t conversion_errors_ = 0;
+    
+    void build(std::string_view csv, const CsvReadOptions& options);
+    
+public:
+    class RowView {
+    private:
+        const CsvTable* table_;
+        size_t row_;
+        
+    public:
+        RowView(const CsvTable* table, size_t row) : table_(table), row_(row) {}
+        
+        size_t index() const { return row_; }
+        size_t size() const { return table_->columnCount(); }
+        
+        template<typename T>
+        std::optional<T> get(size_t column) const {
+            return table_->column(column).get<T>(row_);
+        }
+        
+        template<typename T>
+        std::optional<T> get(const std::string& column) const {
+            return table_->column(column).get<T>(row_);
+        }
+    };
+    
+    class RowIterator {
+    private:
+        const CsvTable* table_;
+        size_t row_;
+        
+    public:
+        RowIterator(const CsvTable* table, size_t row) : table_(table), row_(row) {}
+        
+        RowView operator*() const { return RowView(table_, row_); }
+        RowIterator& operator++() {
+            ++row_;
+            return *this;
+        }
+        bool operator==(const RowIterator& other) const { return row_ == other.row_; }
+        bool operator!=(const RowIterator& other) const { return row_ != other.row_; }
+    };
+    
+    // Map the file and parse it
+    static CsvTable parseFromFile(const std::string& filename, const CsvReadOptions& options = {});
+    static CsvTable parseFromString(std::string_view csv, const CsvReadOptions& options = {});
+    
+    size_t rowCount() const { return rows_; }
+    size_t columnCount() const { return columns_.size(); }
+    bool empty() const { return rows_ == 0; }
+    
+    // Fields that were not empty but did not parse as their column's type
+    size_t conversionErrors() const { return conversion_errors_; }
+    
+    const CsvColumn& column(size_t index) const {
+        if (index >= columns_.size()) {
+            throw std::out_of_range("CSV column index out of range");
+        }
+        return columns_[index];
+    }
+    
+    const CsvColumn& column(const std::string& name) const {
+        for (const auto& column : columns_) {
+            if (column.name() == name) return column;
+        }
+        throw std::out_of_range("CSV column not found: " + name);
+    }
+    
+    bool hasColumn(const std::string& name) const {
+        return std::any_of(columns_.begin(), columns_.end(),
+                           [&](const CsvColumn& column) { return column.name() == name; });
+    }
+    
+    std::vector<std::string> getHeaders() const {
+        std::vector<std::string> headers;
+        headers.reserve(columns_.size());
+        for (const auto& column : columns_) headers.push_back(column.name());
+        return headers;
+    }
+    
+    RowView row(size_t index) const {
+        if (index >= rows_) {
+            throw std::out_of_range("CSV row index out of range");
+        }
+        return RowView(this, index);
+    }
+    
+    RowIterator begin() const { return RowIterator(this, 0); }
+    RowIterator end() const { return RowIterator(this, rows_); }
+};
+
 // ===== XML NODE STRUCTURE =====
 
-class XmlNode {
+class XmlNode : public std::enable_shared_from_this<XmlNode> {
 public:
     std::string name;
     std::string content;
@@ -794,11 +1556,6 @@ public:
     }
 };
 
-// Enable shared_from_this for XmlNode
-class XmlNode : public std::enable_shared_from_this<XmlNode> {
-    // Previous XmlNode implementation remains the same
-};
-
 // ===== XML PARSER =====
 
 class XmlParser {
@@ -1015,6 +1772,27 @@ public:
 
 namespace SpaceGameParsers {
     
+    // Position a reader inside the array of records in a JSON file: either
+    // the top-level array, or the named member of a top-level object
+    inline void enterRecordArray(JsonReader& reader, const std::string& member) {
+        JsonReader::Event event = reader.next();
+        if (event == JsonReader::Event::StartArray) {
+            return;
+        }
+        if (event == JsonReader::Event::StartObject) {
+            while (reader.next() == JsonReader::Event::Key) {
+                if (reader.stringValue() == member) {
+                    if (reader.next() != JsonReader::Event::StartArray) {
+                        throw ParseException("Expected '" + member + "' to be an array");
+                    }
+                    return;
+                }
+                reader.skipValue();
+            }
+        }
+        throw ParseException("Expected an array or an object with a '" + member + "' array");
+    }
+    
     // Planet configuration parser
     struct PlanetConfig {
         int id;
@@ -1029,41 +1807,41 @@ namespace SpaceGameParsers {
     class PlanetConfigParser {
     public:
         static std::vector<PlanetConfig> parseFromJson(const std::string& filename) {
-            JsonValue json = JsonParser::parseFromFile(filename);
+            JsonDocument document = JsonDocument::parseFromFile(filename);
+            JsonElement json = document.root();
             std::vector<PlanetConfig> planets;
             
             if (!json.isArray()) {
                 throw ParseException("Expected array of planets in JSON");
             }
             
-            for (size_t i = 0; i < json.size(); ++i) {
-                const JsonValue& planet_json = json[i];
+            planets.reserve(json.size());
+            for (JsonElement planet_json : json.elements()) {
                 PlanetConfig config;
                 
                 config.id = planet_json["id"].asInt();
-                config.name = planet_json["name"].asString();
+                config.name = std::string(planet_json["name"].asString());
                 config.distance_from_star = planet_json["distance_from_star"].asNumber();
                 config.population = static_cast<long long>(planet_json["population"].asNumber());
                 config.habitable = planet_json["habitable"].asBool();
                 
                 // Parse resources array
-                if (planet_json.contains("resources") && planet_json["resources"].isArray()) {
-                    const auto& resources_json = planet_json["resources"];
-                    for (size_t j = 0; j < resources_json.size(); ++j) {
-                        config.resources.push_back(resources_json[j].asString());
+                auto resources_json = planet_json.find("resources");
+                if (resources_json && resources_json->isArray()) {
+                    for (JsonElement resource : resources_json->elements()) {
+                        config.resources.emplace_back(resource.asString());
                     }
                 }
                 
                 // Parse orbital parameters
-                if (planet_json.contains("orbital_parameters") && planet_json["orbital_parameters"].isObject()) {
-                    const auto& orbital_json = planet_json["orbital_parameters"];
-                    const auto& obj = orbital_json.asObject();
-                    for (const auto& pair : obj) {
-                        config.orbital_parameters[pair.first] = pair.second.asNumber();
+                auto orbital_json = planet_json.find("orbital_parameters");
+                if (orbital_json && orbital_json->isObject()) {
+                    for (const auto& [key, value] : orbital_json->members()) {
+                        config.orbital_parameters[std::string(key)] = value.asNumber();
                     }
                 }
                 
-                planets.push_back(config);
+                planets.push_back(std::move(config));
             }
             
             return planets;
@@ -1119,36 +1897,90 @@ namespace SpaceGameParsers {
     class FleetDataParser {
     public:
         static std::vector<FleetData> parseFromCsv(const std::string& filename) {
-            CsvData csv = CsvParser::parseFromFile(filename);
+            CsvReadOptions options;
+            options.column_types = {
+                {"commander", CsvColumn::Type::String},
+                {"mission_type", CsvColumn::Type::String},
+                {"current_location", CsvColumn::Type::String}
+            };
+            CsvTable table = CsvTable::parseFromFile(filename, options);
             std::vector<FleetData> fleets;
             
-            const auto& headers = csv.getHeaders();
-            
             // Validate required headers
             std::vector<std::string> required_headers = {
                 "fleet_id", "commander", "ship_count", "fuel_level", "mission_type", "current_location"
             };
             
             for (const auto& required : required_headers) {
-                if (std::find(headers.begin(), headers.end(), required) == headers.end()) {
+                if (!table.hasColumn(required)) {
                     throw ParseException("Missing required header: " + required);
                 }
             }
             
-            for (const auto& row : csv.getRows()) {
+            auto required = [](const auto& value, const CsvTable::RowView& row, const char* column) {
+                if (!value) {
+                    throw ParseException("Missing or invalid " + std::string(column) +
+                                         " in fleet row " + std::to_string(row.index()));
+                }
+                return *value;
+            };
+            
+            fleets.reserve(table.rowCount());
+            for (const auto& row : table) {
                 FleetData fleet;
-                fleet.fleet_id = row.getFieldAs<int>(0);
-                fleet.commander = row.getField(headers, "commander");
-                fleet.ship_count = std::stoi(row.getField(headers, "ship_count"));
-                fleet.fuel_level = std::stod(row.getField(headers, "fuel_level"));
-                fleet.mission_type = row.getField(headers, "mission_type");
-                fleet.current_location = row.getField(headers, "current_location");
+                fleet.fleet_id = required(row.get<int>("fleet_id"), row, "fleet_id");
+                fleet.commander = row.get<std::string>("commander").value_or("");
+                fleet.ship_count = required(row.get<int>("ship_count"), row, "ship_count");
+                fleet.fuel_level = required(row.get<double>("fuel_level"), row, "fuel_level");
+                fleet.mission_type = row.get<std::string>("mission_type").value_or("");
+                fleet.current_location = row.get<std::string>("current_location").value_or("");
                 
                 fleets.push_back(fleet);
             }
             
             return fleets;
         }
+        
+        // Stream fleets from a JSON array (top-level, or the "fleets" member of
+        // the top-level object) one at a time; memory use does not depend on
+        // the file size. Returns the number of fleets read.
+        static size_t forEachFleetInJson(const std::string& filename,
+                                         const std::function<void(const FleetData&)>& callback) {
+            JsonReader reader = JsonReader::fromFile(filename);
+            enterRecordArray(reader, "fleets");
+            
+            JsonDocument element;
+            size_t count = 0;
+            while (reader.nextElement()) {
+                reader.readDocument(element);
+                FleetData fleet;
+                try {
+                    fleet = fromJson(element.root());
+                } catch (const std::exception& e) {
+                    throw ParseException("Invalid fleet at index " + std::to_string(count) + ": " + e.what());
+                }
+                callback(fleet);
+                ++count;
+            }
+            return count;
+        }
+        
+        static std::vector<FleetData> parseFromJson(const std::string& filename) {
+            std::vector<FleetData> fleets;
+            forEachFleetInJson(filename, [&](const FleetData& fleet) { fleets.push_back(fleet); });
+            return fleets;
+        }
+        
+        static FleetData fromJson(const JsonElement& json) {
+            FleetData fleet;
+            fleet.fleet_id = json["fleet_id"].asInt();
+            fleet.commander = std::string(json["commander"].asString());
+            fleet.ship_count = json["ship_count"].asInt();
+            fleet.fuel_level = json["fuel_level"].asNumber();
+            fleet.mission_type = std::string(json["mission_type"].asString());
+            fleet.current_location = std::string(json["current_location"].asString());
+            return fleet;
+        }
     };
     
     // Mission XML parser
@@ -1206,6 +2038,65 @@ namespace SpaceGameParsers {
             
             return missions;
         }
+        
+        // Stream missions from a JSON array (top-level, or the "missions"
+        // member of the top-level object) one at a time; memory use does not
+        // depend on the file size. Returns the number of missions read.
+        static size_t forEachMissionInJson(const std::string& filename,
+                                           const std::function<void(const MissionConfig&)>& callback) {
+            JsonReader reader = JsonReader::fromFile(filename);
+            enterRecordArray(reader, "missions");
+            
+            JsonDocument element;
+            size_t count = 0;
+            while (reader.nextElement()) {
+                reader.readDocument(element);
+                MissionConfig config;
+                try {
+                    config = fromJson(element.root());
+                } catch (const std::exception& e) {
+                    throw ParseException("Invalid mission at index " + std::to_string(count) + ": " + e.what());
+                }
+                callback(config);
+                ++count;
+            }
+            return count;
+        }
+        
+        static std::vector<MissionConfig> parseFromJson(const std::string& filename) {
+            std::vector<MissionConfig> missions;
+            forEachMissionInJson(filename, [&](const MissionConfig& mission) { missions.push_back(mission); });
+            return missions;
+        }
+        
+        // Same fields and defaults as the XML form
+        static MissionConfig fromJson(const JsonElement& json) {
+            MissionConfig config;
+            config.mission_id = json["mission_id"].asInt();
+            auto type = json.find("type");
+            config.type = type ? std::string(type->asString()) : "Unknown";
+            auto priority = json.find("priority");
+            config.priority = priority ? priority->asInt() : 1;
+            
+            if (auto title = json.find("title")) {
+                config.title = std::string(title->asString());
+            }
+            if (auto description = json.find("description")) {
+                config.description = std::string(description->asString());
+            }
+            if (auto objectives = json.find("objectives")) {
+                for (JsonElement objective : objectives->elements()) {
+                    config.objectives.emplace_back(objective.asString());
+                }
+            }
+            if (auto parameters = json.find("parameters")) {
+                for (const auto& [key, value] : parameters->members()) {
+                    config.parameters[std::string(key)] =
+                        value.isString() ? std::string(value.asString()) : value.toValue().toString();
+                }
+            }
+            return config;
+        }
     };
     
 } // namespace SpaceGameParsers
@@ -1222,7 +2113,7 @@ namespace FileParserUtils {
         Unknown
     };
     
-    FileFormat detectFormat(const std::string& filename) {
+    inline FileFormat detectFormat(const std::string& filename) {
         // Check extension first
         std::string extension = filename.substr(filename.find_last_of('.') + 1);
         std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
@@ -1257,7 +2148,7 @@ namespace FileParserUtils {
         std::chrono::system_clock::time_point last_modified;
     };
     
-    FileInfo getFileInfo(const std::string& filename) {
+    inline FileInfo getFileInfo(const std::string& filename) {
         FileInfo info;
         info.filename = filename;
         info.format = detectFormat(filename);
@@ -1276,7 +2167,7 @@ namespace FileParserUtils {
     }
     
     // Validation functions
-    bool isValidJson(const std::string& content) {
+    inline bool isValidJson(const std::string& content) {
         try {
             JsonParser::parseFromString(content);
             return true;
@@ -1285,7 +2176,7 @@ namespace FileParserUtils {
         }
     }
     
-    bool isValidXml(const std::string& content) {
+    inline bool isValidXml(const std::string& content) {
         try {
             XmlParser::parseFromString(content);
             return true;
@@ -1295,7 +2186,7 @@ namespace FileParserUtils {
     }
     
     // Conversion utilities
-    std::string csvToJson(const CsvData& csv_data) {
+    inline std::string csvToJson(const CsvData& csv_data) {
         JsonValue json_array(JsonValue::JsonArray{});
         
         const auto& headers = csv_data.getHeaders();
@@ -410,6 +410,21 @@ namespace LoggerUtils {
         std::cout << "Logged " << num_messages << " messages in " << duration.count() << " ms" << std::endl;
         std::cout << "Average: " << (static_cast<double>(duration.count()) / num_messages) << " ms per message" << std::endl;
         std::cout << "Throughput: " << (num_messages * 1000 / duration.count()) << " messages/second" << std::endl;
+        
+        // Deferred formatting: arguments are captured in binary form and the
+        // message is only rendered on the logger's worker thread
+        start_time = std::chrono::high_resolution_clock::now();
+        
+        for (int i = 0; i < num_messages; ++i) {
+            LOGF_INFO(benchmark_logger, "Benchmark message #{} with some additional data", i);
+        }
+        
+        benchmark_logger->flush();
+        
+        end_time = std::chrono::high_resolution_clock::now();
+        duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+        
+        std::cout << "Deferred-format: logged " << num_messages << " messages in " << duration.count() << " ms" << std::endl;
     }
     
     void testErrorRecovery() {
@@ -16,6 +16,14 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <charconv>
+#include <string_view>
+#include <type_traits>
 
 namespace CppVerseHub::Utils {
 
@@ -61,6 +69,243 @@ inline LogLevel stringToLogLevel(const std::string& levelStr) {
     return LogLevel::INFO; // Default
 }
 
+// ===== DEFERRED FORMAT ARGUMENTS =====
+
+enum class LogArgType : uint8_t {
+    INT64 = 0,
+    UINT64 = 1,
+    DOUBLE = 2,
+    BOOL = 3,
+    CHAR = 4,
+    STRING = 5,
+    POINTER = 6
+};
+
+// Fixed-size binary capture of format arguments. The hot path only copies
+// raw values (and string bytes) into this buffer; turning them into text is
+// left to render(), which runs on the logger's worker thread.
+// Encoding per argument: one LogArgType byte followed by its payload in
+// native byte order (8 bytes for numbers/pointers, 1 byte for bool/char,
+// a uint16_t length plus the bytes for strings).
+class LogArgBuffer {
+public:
+    static constexpr size_t capacity = 256;
+
+private:
+    unsigned char data_[capacity];
+    uint16_t size_ = 0;
+    uint8_t count_ = 0;
+    bool truncated_ = false;
+
+    template<typename> static constexpr bool always_false = false;
+
+    bool reserve(size_t bytes) {
+        if (truncated_ || size_ + bytes > capacity) {
+            truncated_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    template<typename T>
+    void putScalar(LogArgType type, T value) {
+        if (!reserve(1 + sizeof(T))) return;
+        data_[size_++] = static_cast<unsigned char>(type);
+        std::memcpy(data_ + size_, &value, sizeof(T));
+        size_ += sizeof(T);
+        ++count_;
+    }
+
+    void putString(std::string_view value) {
+        if (!reserve(1 + sizeof(uint16_t))) return;
+        size_t room = capacity - size_ - 1 - sizeof(uint16_t);
+        if (value.size() > room) {
+            value = value.substr(0, room);
+            truncated_ = true;
+        }
+        auto length = static_cast<uint16_t>(value.size());
+        data_[size_++] = static_cast<unsigned char>(LogArgType::STRING);
+        std::memcpy(data_ + size_, &length, sizeof(length));
+        size_ += sizeof(length);
+        std::memcpy(data_ + size_, value.data(), length);
+        size_ += length;
+        ++count_;
+    }
+
+public:
+    void clear() {
+        size_ = 0;
+        count_ = 0;
+        truncated_ = false;
+    }
+
+    template<typename T>
+    void append(const T& value) {
+        using D = std::decay_t<T>;
+        if constexpr (std::is_same_v<D, bool>) {
+            putScalar(LogArgType::BOOL, static_cast<uint8_t>(value));
+        } else if constexpr (std::is_same_v<D, char>) {
+            putScalar(LogArgType::CHAR, value);
+        } else if constexpr (std::is_enum_v<D>) {
+            append(static_cast<std::underlying_type_t<D>>(value));
+        } else if constexpr (std::is_integral_v<D> && std::is_signed_v<D>) {
+            putScalar(LogArgType::INT64, static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<D>) {
+            putScalar(LogArgType::UINT64, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_floating_point_v<D>) {
+            putScalar(LogArgType::DOUBLE, static_cast<double>(value));
+        } else if constexpr (std::is_array_v<T> && std::is_convertible_v<const T&, std::string_view>) {
+            putString(std::string_view(value));
+        } else if constexpr (std::is_same_v<D, const char*> || std::is_same_v<D, char*>) {
+            putString(value ? std::string_view(value) : std::string_view("(null)"));
+        } else if constexpr (std::is_convertible_v<const D&, std::string_view>) {
+            putString(std::string_view(value));
+        } else if constexpr (std::is_pointer_v<D> || std::is_null_pointer_v<D>) {
+            putScalar(LogArgType::POINTER, reinterpret_cast<uintptr_t>(static_cast<const void*>(value)));
+        } else {
+            static_assert(always_false<D>, "Unsupported deferred log argument type");
+        }
+    }
+
+    // Restores a buffer previously produced by append() (used by the binary log reader).
+    // Returns false, leaving the buffer empty, unless the bytes hold exactly
+    // `count` well-formed arguments.
+    bool assign(const unsigned char* bytes, size_t size, uint8_t count, bool truncated) {
+        if (size > capacity) return false;
+        std::memcpy(data_, bytes, size);
+        size_ = static_cast<uint16_t>(size);
+        count_ = count;
+        truncated_ = truncated;
+        if (!wellFormed()) {
+            clear();
+            return false;
+        }
+        return true;
+    }
+
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+    uint8_t count() const { return count_; }
+    bool truncated() const { return truncated_; }
+
+    // Expands "{}" placeholders in `format` with the captured arguments;
+    // "{{" and "}}" are literal braces. Placeholders without a matching
+    // argument are left as-is.
+    void render(const char* format, std::string& out) const {
+        out.clear();
+        size_t offset = 0;
+        uint8_t consumed = 0;
+
+        for (const char* p = format; *p; ++p) {
+            if (p[0] == '{' && p[1] == '{') {
+                out += '{';
+                ++p;
+            } else if (p[0] == '}' && p[1] == '}') {
+                out += '}';
+                ++p;
+            } else if (p[0] == '{' && p[1] == '}') {
+                if (consumed < count_) {
+                    offset = renderArgument(offset, out);
+                    ++consumed;
+                } else {
+                    out += "{}";
+                }
+                ++p;
+            } else {
+                out += *p;
+            }
+        }
+
+        if (truncated_) {
+            out += " [truncated]";
+        }
+    }
+
+private:
+    // Size of the argument starting at `offset`, tag included, or 0 if its
+    // tag is unknown or it runs past size_
+    size_t argumentSize(size_t offset) const {
+        if (offset >= size_) return 0;
+        size_t payload = 0;
+        switch (static_cast<LogArgType>(data_[offset])) {
+            case LogArgType::INT64:   payload = sizeof(int64_t); break;
+            case LogArgType::UINT64:  payload = sizeof(uint64_t); break;
+            case LogArgType::DOUBLE:  payload = sizeof(double); break;
+            case LogArgType::BOOL:    payload = sizeof(uint8_t); break;
+            case LogArgType::CHAR:    payload = sizeof(char); break;
+            case LogArgType::POINTER: payload = sizeof(uintptr_t); break;
+            case LogArgType::STRING:
+                if (size_ - offset - 1 < sizeof(uint16_t)) return 0;
+                payload = sizeof(uint16_t) + readScalar<uint16_t>(offset + 1);
+                break;
+            default:
+                return 0;
+        }
+        return payload < size_ - offset ? 1 + payload : 0;
+    }
+
+    bool wellFormed() const {
+        size_t offset = 0;
+        for (uint8_t i = 0; i < count_; ++i) {
+            size_t bytes = argumentSize(offset);
+            if (bytes == 0) return false;
+            offset += bytes;
+        }
+        return offset == size_;
+    }
+
+    template<typename T>
+    T readScalar(size_t offset) const {
+        T value;
+        std::memcpy(&value, data_ + offset, sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    static void appendNumber(std::string& out, T value) {
+        char buffer[32];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr);
+    }
+
+    size_t renderArgument(size_t offset, std::string& out) const {
+        auto type = static_cast<LogArgType>(data_[offset++]);
+        switch (type) {
+            case LogArgType::INT64:
+                appendNumber(out, readScalar<int64_t>(offset));
+                return offset + sizeof(int64_t);
+            case LogArgType::UINT64:
+                appendNumber(out, readScalar<uint64_t>(offset));
+                return offset + sizeof(uint64_t);
+            case LogArgType::DOUBLE:
+                appendNumber(out, readScalar<double>(offset));
+                return offset + sizeof(double);
+            case LogArgType::BOOL:
+                out += readScalar<uint8_t>(offset) ? "true" : "false";
+                return offset + sizeof(uint8_t);
+            case LogArgType::CHAR:
+                out += readScalar<char>(offset);
+                return offset + sizeof(char);
+            case LogArgType::STRING: {
+                auto length = readScalar<uint16_t>(offset);
+                offset += sizeof(uint16_t);
+                out.append(reinterpret_cast<const char*>(data_ + offset), length);
+                return offset + length;
+            }
+            case LogArgType::POINTER: {
+                char buffer[2 + 2 * sizeof(uintptr_t)] = {'0', 'x'};
+                auto result = std::to_chars(buffer + 2, buffer + sizeof(buffer),
+                                            readScalar<uintptr_t>(offset), 16);
+                out.append(buffer, result.ptr);
+                return offset + sizeof(uintptr_t);
+            }
+            default:
+                break;
+        }
+        return size_;
+    }
+};
+
 // ===== LOG ENTRY STRUCTURE =====
 
 struct LogEntry {
@@ -73,6 +318,12 @@ struct LogEntry {
     int line;
     std::thread::id thread_id;
     
+    // Deferred formatting: when set, `message` is rendered from these on the
+    // worker thread, and only if some appender reads it. The format string
+    // must have static storage duration.
+    const char* format = nullptr;
+    LogArgBuffer args;
+    
     LogEntry() = default;
     
     LogEntry(LogLevel lvl, const std::string& name, const std::string& msg,
@@ -96,6 +347,12 @@ public:
     virtual ~LogFormatter() = default;
     virtual std::string format(const LogEntry& entry) const = 0;
     virtual std::unique_ptr<LogFormatter> clone() const = 0;
+    
+    // Appends the formatted entry to `out`; buffered appenders use this to
+    // format straight into their write buffer
+    virtual void formatTo(const LogEntry& entry, std::string& out) const {
+        out += format(entry);
+    }
 };
 
 // ===== DEFAULT FORMATTER IMPLEMENTATION =====
@@ -105,6 +362,10 @@ private:
     std::string date_format_;
     bool show_thread_id_;
     bool show_location_;
+    mutable std::time_t cached_time_ = 0;
+    mutable std::string cached_time_text_;
+    mutable std::thread::id cached_thread_;
+    mutable std::string cached_thread_text_;
     
 public:
     explicit DefaultFormatter(const std::string& date_fmt = "%Y-%m-%d %H:%M:%S",
@@ -112,45 +373,80 @@ public:
         : date_format_(date_fmt), show_thread_id_(show_thread), show_location_(show_loc) {}
     
     std::string format(const LogEntry& entry) const override {
-        std::ostringstream oss;
-        
+        std::string formatted;
+        formatTo(entry, formatted);
+        return formatted;
+    }
+    
+    // Renders without an ostringstream; the per-second timestamp text and the
+    // last thread id are cached, so a formatter instance must not be shared
+    // between threads (each appender owns its own).
+    void formatTo(const LogEntry& entry, std::string& out) const override {
         // Timestamp
         auto time_t = std::chrono::system_clock::to_time_t(entry.timestamp);
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
             entry.timestamp.time_since_epoch()) % 1000;
         
-        oss << std::put_time(std::localtime(&time_t), date_format_.c_str())
-            << "." << std::setfill('0') << std::setw(3) << ms.count();
+        if (time_t != cached_time_ || cached_time_text_.empty()) {
+            std::ostringstream oss;
+            oss << std::put_time(std::localtime(&time_t), date_format_.c_str());
+            cached_time_text_ = oss.str();
+            cached_time_ = time_t;
+        }
+        
+        char millis[4] = {
+            static_cast<char>('0' + ms.count() / 100),
+            static_cast<char>('0' + ms.count() / 10 % 10),
+            static_cast<char>('0' + ms.count() % 10),
+            '\0'
+        };
+        out += cached_time_text_;
+        out += '.';
+        out += millis;
         
         // Log level
-        oss << " [" << logLevelToString(entry.level) << "]";
+        out += " [";
+        out += logLevelToString(entry.level);
+        out += ']';
         
         // Logger name
         if (!entry.logger_name.empty()) {
-            oss << " [" << entry.logger_name << "]";
+            out += " [";
+            out += entry.logger_name;
+            out += ']';
         }
         
         // Thread ID
         if (show_thread_id_) {
-            oss << " [Thread-" << entry.thread_id << "]";
+            if (entry.thread_id != cached_thread_ || cached_thread_text_.empty()) {
+                std::ostringstream oss;
+                oss << entry.thread_id;
+                cached_thread_text_ = oss.str();
+                cached_thread_ = entry.thread_id;
+            }
+            out += " [Thread-";
+            out += cached_thread_text_;
+            out += ']';
         }
         
         // Location information
         if (show_location_ && !entry.file.empty()) {
-            oss << " [" << entry.file;
+            out += " [";
+            out += entry.file;
             if (!entry.function.empty()) {
-                oss << "::" << entry.function;
+                out += "::";
+                out += entry.function;
             }
             if (entry.line > 0) {
-                oss << ":" << entry.line;
+                out += ':';
+                out += std::to_string(entry.line);
             }
-            oss << "]";
+            out += ']';
         }
         
         // Message
-        oss << " - " << entry.message;
-        
-        return oss.str();
+        out += " - ";
+        out += entry.message;
     }
     
     std::unique_ptr<LogFormatter> clone() const override {
@@ -235,6 +531,97 @@ public:
     virtual void flush() = 0;
     virtual void setFormatter(std::unique_ptr<LogFormatter> formatter) = 0;
     virtual std::unique_ptr<LogAppender> clone() const = 0;
+    
+    // Called by the AsyncLogger worker with everything it drained in one go.
+    // Appenders that can amortise locking or I/O across entries override this.
+    virtual void appendBatch(const LogEntry* const* entries, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            append(*entries[i]);
+        }
+    }
+    
+    // Called by the AsyncLogger worker when it runs out of entries, so that
+    // buffering appenders can honour a time-based flush threshold while idle
+    virtual void flushIfStale() {}
+    
+    // Whether append() reads `message` for deferred-format entries. The
+    // AsyncLogger worker skips rendering them when no appender does.
+    virtual bool needsRenderedMessage() const { return true; }
+};
+
+// ===== BUFFERED LOG FILE =====
+
+// Output file with a large user-space write buffer. Entries are formatted
+// straight into buffer(); the buffer is written out when it reaches
+// `buffer_size` bytes, when `flush_interval` has passed since the last
+// write, once markUrgent() has been called (ERROR and FATAL entries), or on
+// flush().
+class BufferedLogFile {
+private:
+    std::ofstream file_;
+    std::string buffer_;
+    size_t buffer_size_;
+    std::chrono::milliseconds flush_interval_;
+    std::chrono::steady_clock::time_point last_write_;
+    bool urgent_ = false;
+    
+public:
+    BufferedLogFile(size_t buffer_size, std::chrono::milliseconds flush_interval)
+        : buffer_size_(buffer_size)
+        , flush_interval_(flush_interval)
+        , last_write_(std::chrono::steady_clock::now()) {
+        buffer_.reserve(buffer_size_);
+    }
+    
+    ~BufferedLogFile() {
+        close();
+    }
+    
+    bool open(const std::string& filename) {
+        file_.open(filename, std::ios::app);
+        last_write_ = std::chrono::steady_clock::now();
+        return file_.is_open();
+    }
+    
+    void close() {
+        if (file_.is_open()) {
+            write();
+            file_.close();
+        }
+    }
+    
+    bool is_open() const { return file_.is_open(); }
+    
+    std::string& buffer() { return buffer_; }
+    
+    // Bytes in the file, counting what is still buffered
+    std::streampos size() {
+        return file_.tellp() + static_cast<std::streamoff>(buffer_.size());
+    }
+    
+    // The buffer holds an entry that must not wait for the size or time threshold
+    void markUrgent() { urgent_ = true; }
+    
+    bool due() const {
+        return urgent_ || buffer_.size() >= buffer_size_ ||
+               (!buffer_.empty() && std::chrono::steady_clock::now() - last_write_ >= flush_interval_);
+    }
+    
+    void write() {
+        if (!buffer_.empty() && file_.is_open()) {
+            file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            file_.flush();
+        }
+        buffer_.clear();
+        urgent_ = false;
+        last_write_ = std::chrono::steady_clock::now();
+    }
+    
+    void writeIfDue() {
+        if (due()) {
+            write();
+        }
+    }
 };
 
 // ===== CONSOLE APPENDER =====
@@ -302,11 +689,13 @@ public:
 class FileAppender : public LogAppender {
 private:
     std::unique_ptr<LogFormatter> formatter_;
-    std::ofstream file_;
+    BufferedLogFile file_;
     std::string filename_;
     std::mutex mutex_;
     size_t max_file_size_;
     int max_backup_files_;
+    size_t buffer_size_;
+    std::chrono::milliseconds flush_interval_;
     
     void rotateFile() {
         if (max_backup_files_ <= 0) return;
@@ -329,48 +718,83 @@ private:
         std::rename(filename_.c_str(), backup_name.c_str());
         
         // Reopen file
-        file_.open(filename_, std::ios::app);
+        file_.open(filename_);
+    }
+    
+    void appendLocked(const LogEntry& entry) {
+        formatter_->formatTo(entry, file_.buffer());
+        file_.buffer() += '\n';
+        if (entry.level >= LogLevel::ERROR) {
+            file_.markUrgent();
+        }
+    }
+    
+    void writeIfDueLocked() {
+        if (!file_.due()) return;
+        
+        file_.write();
+        
+        // Check if rotation is needed
+        if (max_file_size_ > 0 && file_.size() > std::streampos(static_cast<std::streamoff>(max_file_size_))) {
+            rotateFile();
+        }
     }
     
 public:
     explicit FileAppender(const std::string& filename, 
                          size_t max_size = 10 * 1024 * 1024, // 10MB default
-                         int max_backups = 5)
+                         int max_backups = 5,
+                         size_t buffer_size = 64 * 1024,
+                         std::chrono::milliseconds flush_interval = std::chrono::milliseconds(1000))
         : formatter_(std::make_unique<DefaultFormatter>())
+        , file_(buffer_size, flush_interval)
         , filename_(filename)
         , max_file_size_(max_size)
-        , max_backup_files_(max_backups) {
+        , max_backup_files_(max_backups)
+        , buffer_size_(buffer_size)
+        , flush_interval_(flush_interval) {
         
-        file_.open(filename_, std::ios::app);
-        if (!file_.is_open()) {
+        if (!file_.open(filename_)) {
             throw std::runtime_error("Failed to open log file: " + filename_);
         }
     }
     
-    ~FileAppender() {
+    // Direct calls have no worker to write out an idle buffer later, so
+    // they write through; only batches from the AsyncLogger are held back
+    void append(const LogEntry& entry) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
         if (file_.is_open()) {
-            file_.close();
+            appendLocked(entry);
+            file_.markUrgent();
+            writeIfDueLocked();
         }
     }
     
-    void append(const LogEntry& entry) override {
+    void appendBatch(const LogEntry* const* entries, size_t count) override {
         std::lock_guard<std::mutex> lock(mutex_);
         
         if (file_.is_open()) {
-            std::string formatted = formatter_->format(entry);
-            file_ << formatted << std::endl;
-            
-            // Check if rotation is needed
-            if (max_file_size_ > 0 && file_.tellp() > static_cast<std::streampos>(max_file_size_)) {
-                rotateFile();
+            for (size_t i = 0; i < count; ++i) {
+                appendLocked(*entries[i]);
+                // Keep size-based rotation within one buffer of max_file_size_
+                if (file_.buffer().size() >= buffer_size_) {
+                    writeIfDueLocked();
+                }
             }
+            writeIfDueLocked();
         }
     }
     
+    void flushIfStale() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        writeIfDueLocked();
+    }
+    
     void flush() override {
         std::lock_guard<std::mutex> lock(mutex_);
         if (file_.is_open()) {
-            file_.flush();
+            file_.write();
         }
     }
     
@@ -380,7 +804,8 @@ public:
     }
     
     std::unique_ptr<LogAppender> clone() const override {
-        auto cloned = std::make_unique<FileAppender>(filename_, max_file_size_, max_backup_files_);
+        auto cloned = std::make_unique<FileAppender>(filename_, max_file_size_, max_backup_files_,
+                                                     buffer_size_, flush_interval_);
         cloned->setFormatter(formatter_->clone());
         return std::move(cloned);
     }
@@ -391,16 +816,16 @@ public:
 class RotatingFileAppender : public LogAppender {
 private:
     std::unique_ptr<LogFormatter> formatter_;
-    std::ofstream file_;
+    BufferedLogFile file_;
     std::string base_filename_;
     std::mutex mutex_;
     std::chrono::system_clock::time_point last_rotation_;
     std::chrono::hours rotation_interval_;
+    size_t buffer_size_;
+    std::chrono::milliseconds flush_interval_;
     
     void rotateFile() {
-        if (file_.is_open()) {
-            file_.close();
-        }
+        file_.close();
         
         auto now = std::chrono::system_clock::now();
         auto time_t = std::chrono::system_clock::to_time_t(now);
@@ -410,38 +835,183 @@ private:
             << std::put_time(std::localtime(&time_t), "%Y%m%d_%H%M%S")
             << ".log";
         
-        file_.open(oss.str(), std::ios::app);
+        file_.open(oss.str());
         last_rotation_ = now;
     }
     
+    void appendLocked(const LogEntry& entry) {
+        // Check if rotation is needed; buffered entries go to the old file
+        if (entry.timestamp - last_rotation_ >= rotation_interval_) {
+            rotateFile();
+        }
+        
+        if (file_.is_open()) {
+            formatter_->formatTo(entry, file_.buffer());
+            file_.buffer() += '\n';
+            if (entry.level >= LogLevel::ERROR) {
+                file_.markUrgent();
+            }
+        }
+    }
+    
 public:
     explicit RotatingFileAppender(const std::string& base_filename,
-                                 std::chrono::hours interval = std::chrono::hours(24))
+                                 std::chrono::hours interval = std::chrono::hours(24),
+                                 size_t buffer_size = 64 * 1024,
+                                 std::chrono::milliseconds flush_interval = std::chrono::milliseconds(1000))
         : formatter_(std::make_unique<DefaultFormatter>())
+        , file_(buffer_size, flush_interval)
         , base_filename_(base_filename)
         , last_rotation_(std::chrono::system_clock::now())
-        , rotation_interval_(interval) {
+        , rotation_interval_(interval)
+        , buffer_size_(buffer_size)
+        , flush_interval_(flush_interval) {
         
         rotateFile();
     }
     
-    ~RotatingFileAppender() {
-        if (file_.is_open()) {
-            file_.close();
+    // Written through, as in FileAppender::append
+    void append(const LogEntry& entry) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        appendLocked(entry);
+        file_.write();
+    }
+    
+    void appendBatch(const LogEntry* const* entries, size_t count) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < count; ++i) {
+            appendLocked(*entries[i]);
+        }
+        file_.writeIfDue();
+    }
+    
+    void flushIfStale() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        file_.writeIfDue();
+    }
+    
+    void flush() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        file_.write();
+    }
+    
+    void setFormatter(std::unique_ptr<LogFormatter> formatter) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        formatter_ = std::move(formatter);
+    }
+    
+    std::unique_ptr<LogAppender> clone() const override {
+        auto cloned = std::make_unique<RotatingFileAppender>(base_filename_, rotation_interval_,
+                                                             buffer_size_, flush_interval_);
+        cloned->setFormatter(formatter_->clone());
+        return std::move(cloned);
+    }
+};
+
+// ===== BINARY LOG APPENDER =====
+
+// Compact binary log: deferred-format entries are stored as a format-string
+// id plus the raw LogArgBuffer bytes, so nothing is rendered at write time.
+// Strings (formats, logger names, file and function names) are written once
+// as definitions and referenced by id afterwards. Decode offline with
+// BinaryLogReader / decodeBinaryLog().
+//
+// Record layout (native byte order):
+//   'H' "CVHLOG1"                         segment header, resets string ids
+//   'S' u32 id, u32 length, bytes         string definition
+//   'E' i64 ns, u8 level, u32 name, u32 file, u32 function, i32 line,
+//       u32 format, payload               log entry
+// The payload is u16 size, u8 count, u8 truncated, args bytes when `format`
+// names a string, or u32 length + message bytes when format == raw_message_id.
+namespace BinaryLogFormat {
+    constexpr char header[8] = {'H', 'C', 'V', 'H', 'L', 'O', 'G', '1'};
+    constexpr char string_record = 'S';
+    constexpr char entry_record = 'E';
+    constexpr uint32_t raw_message_id = 0xFFFFFFFFu;
+}
+
+class BinaryLogAppender : public LogAppender {
+private:
+    std::ofstream file_;
+    std::string filename_;
+    std::mutex mutex_;
+    std::unordered_map<const char*, uint32_t> format_ids_;
+    std::unordered_map<std::string, uint32_t> string_ids_;
+    uint32_t next_id_ = 0;
+    
+    template<typename T>
+    void writeValue(const T& value) {
+        file_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    
+    uint32_t defineString(std::string_view text) {
+        uint32_t id = next_id_++;
+        file_.put(BinaryLogFormat::string_record);
+        writeValue(id);
+        writeValue(static_cast<uint32_t>(text.size()));
+        file_.write(text.data(), static_cast<std::streamsize>(text.size()));
+        return id;
+    }
+    
+    uint32_t internString(const std::string& text) {
+        auto it = string_ids_.find(text);
+        if (it != string_ids_.end()) {
+            return it->second;
+        }
+        uint32_t id = defineString(text);
+        string_ids_.emplace(text, id);
+        return id;
+    }
+    
+    // Format strings have static storage, so their address identifies them
+    uint32_t internFormat(const char* format) {
+        auto it = format_ids_.find(format);
+        if (it != format_ids_.end()) {
+            return it->second;
+        }
+        uint32_t id = internString(format);
+        format_ids_.emplace(format, id);
+        return id;
+    }
+    
+public:
+    explicit BinaryLogAppender(const std::string& filename)
+        : filename_(filename) {
+        file_.open(filename_, std::ios::binary | std::ios::app);
+        if (!file_.is_open()) {
+            throw std::runtime_error("Failed to open binary log file: " + filename_);
         }
+        file_.write(BinaryLogFormat::header, sizeof(BinaryLogFormat::header));
     }
     
     void append(const LogEntry& entry) override {
         std::lock_guard<std::mutex> lock(mutex_);
+        if (!file_.is_open()) return;
         
-        // Check if rotation is needed
-        auto now = std::chrono::system_clock::now();
-        if (now - last_rotation_ >= rotation_interval_) {
-            rotateFile();
-        }
+        uint32_t name_id = internString(entry.logger_name);
+        uint32_t file_id = internString(entry.file);
+        uint32_t function_id = internString(entry.function);
+        uint32_t format_id = entry.format ? internFormat(entry.format) : BinaryLogFormat::raw_message_id;
         
-        if (file_.is_open()) {
-            file_ << formatter_->format(entry) << std::endl;
+        file_.put(BinaryLogFormat::entry_record);
+        writeValue<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            entry.timestamp.time_since_epoch()).count());
+        writeValue(static_cast<uint8_t>(entry.level));
+        writeValue(name_id);
+        writeValue(file_id);
+        writeValue(function_id);
+        writeValue(static_cast<int32_t>(entry.line));
+        writeValue(format_id);
+        
+        if (entry.format) {
+            writeValue(static_cast<uint16_t>(entry.args.size()));
+            writeValue(entry.args.count());
+            writeValue(static_cast<uint8_t>(entry.args.truncated()));
+            file_.write(reinterpret_cast<const char*>(entry.args.data()),
+                        static_cast<std::streamsize>(entry.args.size()));
+        } else {
+            writeValue(static_cast<uint32_t>(entry.message.size()));
+            file_.write(entry.message.data(), static_cast<std::streamsize>(entry.message.size()));
         }
     }
     
@@ -452,63 +1022,449 @@ public:
         }
     }
     
-    void setFormatter(std::unique_ptr<LogFormatter> formatter) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        formatter_ = std::move(formatter);
-    }
+    // Binary records are rendered by the reader, not by a formatter
+    void setFormatter(std::unique_ptr<LogFormatter>) override {}
+    
+    // Deferred entries are written as their raw arguments
+    bool needsRenderedMessage() const override { return false; }
     
     std::unique_ptr<LogAppender> clone() const override {
-        auto cloned = std::make_unique<RotatingFileAppender>(base_filename_, rotation_interval_);
-        cloned->setFormatter(formatter_->clone());
-        return std::move(cloned);
+        return std::make_unique<BinaryLogAppender>(filename_);
+    }
+};
+
+// ===== BINARY LOG READER =====
+
+class BinaryLogReader {
+private:
+    std::ifstream file_;
+    std::string filename_;
+    std::unordered_map<uint32_t, std::string> strings_;
+    std::vector<unsigned char> scratch_;
+    std::streamoff file_size_ = 0;
+    
+    template<typename T>
+    T readValue() {
+        T value;
+        if (!file_.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+            throw std::runtime_error("Truncated binary log record in " + filename_);
+        }
+        return value;
+    }
+    
+    // Lengths come from the file, so check them against what is left of it
+    // before allocating
+    void readBytes(size_t length) {
+        std::streamoff left = file_size_ - static_cast<std::streamoff>(file_.tellg());
+        if (left < static_cast<std::streamoff>(length)) {
+            throw std::runtime_error("Truncated binary log record in " + filename_);
+        }
+        scratch_.resize(length);
+        if (length > 0 && !file_.read(reinterpret_cast<char*>(scratch_.data()),
+                                      static_cast<std::streamsize>(length))) {
+            throw std::runtime_error("Truncated binary log record in " + filename_);
+        }
+    }
+    
+    void readHeader() {
+        char rest[sizeof(BinaryLogFormat::header) - 1];
+        if (!file_.read(rest, sizeof(rest)) ||
+            std::memcmp(rest, BinaryLogFormat::header + 1, sizeof(rest)) != 0) {
+            throw std::runtime_error("Invalid binary log header in " + filename_);
+        }
+        strings_.clear();
+    }
+    
+    const std::string& lookup(uint32_t id) const {
+        auto it = strings_.find(id);
+        if (it == strings_.end()) {
+            throw std::runtime_error("Undefined string id in binary log " + filename_);
+        }
+        return it->second;
+    }
+    
+public:
+    explicit BinaryLogReader(const std::string& filename)
+        : filename_(filename) {
+        file_.open(filename_, std::ios::binary);
+        if (!file_.is_open()) {
+            throw std::runtime_error("Failed to open binary log file: " + filename_);
+        }
+        file_.seekg(0, std::ios::end);
+        file_size_ = file_.tellg();
+        file_.seekg(0, std::ios::beg);
+        if (file_.peek() != BinaryLogFormat::header[0]) {
+            throw std::runtime_error("Invalid binary log header in " + filename_);
+        }
+    }
+    
+    // Reads the next entry with its message already rendered.
+    // Returns false at end of file.
+    bool next(LogEntry& entry) {
+        int tag;
+        while ((tag = file_.get()) != std::char_traits<char>::eof()) {
+            if (tag == BinaryLogFormat::header[0]) {
+                readHeader();
+            } else if (tag == BinaryLogFormat::string_record) {
+                auto id = readValue<uint32_t>();
+                readBytes(readValue<uint32_t>());
+                strings_[id].assign(scratch_.begin(), scratch_.end());
+            } else if (tag == BinaryLogFormat::entry_record) {
+                entry.timestamp = std::chrono::system_clock::time_point(
+                    std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                        std::chrono::nanoseconds(readValue<int64_t>())));
+                auto level = readValue<uint8_t>();
+                if (level > static_cast<uint8_t>(LogLevel::OFF)) {
+                    throw std::runtime_error("Invalid log level in binary log " + filename_);
+                }
+                entry.level = static_cast<LogLevel>(level);
+                entry.logger_name = lookup(readValue<uint32_t>());
+                entry.file = lookup(readValue<uint32_t>());
+                entry.function = lookup(readValue<uint32_t>());
+                entry.line = readValue<int32_t>();
+                entry.thread_id = std::thread::id();
+                entry.format = nullptr;
+                
+                auto format_id = readValue<uint32_t>();
+                if (format_id == BinaryLogFormat::raw_message_id) {
+                    readBytes(readValue<uint32_t>());
+                    entry.args.clear();
+                    entry.message.assign(scratch_.begin(), scratch_.end());
+                } else {
+                    auto size = readValue<uint16_t>();
+                    auto count = readValue<uint8_t>();
+                    auto truncated = readValue<uint8_t>() != 0;
+                    readBytes(size);
+                    if (!entry.args.assign(scratch_.data(), size, count, truncated)) {
+                        throw std::runtime_error("Corrupt argument block in binary log " + filename_);
+                    }
+                    entry.args.render(lookup(format_id).c_str(), entry.message);
+                }
+                return true;
+            } else {
+                throw std::runtime_error("Unknown record type in binary log " + filename_);
+            }
+        }
+        return false;
+    }
+};
+
+// Renders every entry of a binary log through `formatter`, one line each.
+// Returns the number of entries decoded.
+inline size_t decodeBinaryLog(const std::string& filename, std::ostream& out,
+                              const LogFormatter& formatter = DefaultFormatter("%Y-%m-%d %H:%M:%S", false, true)) {
+    BinaryLogReader reader(filename);
+    LogEntry entry;
+    size_t decoded = 0;
+    while (reader.next(entry)) {
+        out << formatter.format(entry) << '\n';
+        ++decoded;
+    }
+    return decoded;
+}
+
+// ===== LOCK-FREE LOG RING BUFFER =====
+
+// What a producer does when the ring buffer has no free slot
+enum class OverflowPolicy {
+    BLOCK,        // Wait for the worker to free a slot
+    DROP_NEWEST,  // Discard the entry being logged
+    DROP_OLDEST   // Discard the oldest queued entry to make room (or the new
+                  // one while the worker is still writing out that slot)
+};
+
+// Bounded multi-producer ring buffer of preallocated LogEntry slots.
+// Each slot carries a sequence number (Vyukov's bounded queue), so producers
+// only contend on a single CAS and the strings inside a slot keep their
+// capacity across reuse instead of allocating on every log call.
+class LogRingBuffer {
+private:
+    struct alignas(64) Slot {
+        std::atomic<size_t> sequence{0};
+        LogEntry entry;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) std::atomic<size_t> dequeue_pos_{0};
+
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+public:
+    explicit LogRingBuffer(size_t capacity)
+        : slots_(std::make_unique<Slot[]>(roundUpToPowerOfTwo(capacity)))
+        , mask_(roundUpToPowerOfTwo(capacity) - 1) {
+        for (size_t i = 0; i <= mask_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LogRingBuffer(const LogRingBuffer&) = delete;
+    LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+
+    // Claims a free slot and lets `fill` write the entry in place.
+    // Returns false without calling `fill` when the buffer is full.
+    template<typename Fill>
+    bool tryPush(Fill&& fill) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            size_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        fill(slot->entry);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Claims the oldest published entry and hands it to `consume` in place;
+    // the slot is returned to producers once `consume` returns.
+    // Returns false when no published entry is available.
+    template<typename Consume>
+    bool tryPop(Consume&& consume) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            size_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        consume(slot->entry);
+        slot->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Claims up to `max_entries` consecutive published entries at once and
+    // hands them to `consume(LogEntry* const* entries, size_t count)`; the
+    // slots are returned to producers after `consume` returns. `scratch`
+    // holds the entry pointers and is reused across calls.
+    // Returns the number of entries consumed (0 when empty).
+    template<typename Consume>
+    size_t tryPopBatch(std::vector<LogEntry*>& scratch, size_t max_entries, Consume&& consume) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        size_t count;
+        for (;;) {
+            count = 0;
+            while (count < max_entries) {
+                size_t seq = slots_[(pos + count) & mask_].sequence.load(std::memory_order_acquire);
+                if (seq != pos + count + 1) break;
+                ++count;
+            }
+            if (count == 0) {
+                return 0;
+            }
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + count)) {
+                break;
+            }
+        }
+
+        scratch.clear();
+        for (size_t i = 0; i < count; ++i) {
+            scratch.push_back(&slots_[(pos + i) & mask_].entry);
+        }
+        consume(scratch.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            slots_[(pos + i) & mask_].sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+        }
+        return count;
     }
+
+    // Position the next producer will claim; entries below it have been claimed.
+    size_t enqueuePosition() const {
+        return enqueue_pos_.load();
+    }
+
+    size_t dequeuePosition() const {
+        return dequeue_pos_.load();
+    }
+
+    bool empty() const {
+        return dequeue_pos_.load() >= enqueue_pos_.load();
+    }
+
+    size_t capacity() const { return mask_ + 1; }
 };
 
 // ===== ASYNC LOGGER IMPLEMENTATION =====
 
 class AsyncLogger {
 private:
-    std::queue<LogEntry> log_queue_;
+    LogRingBuffer ring_;
+    std::atomic<OverflowPolicy> overflow_policy_;
+    std::atomic<uint64_t> dropped_count_{0};
     std::vector<std::unique_ptr<LogAppender>> appenders_;
-    std::mutex queue_mutex_;
+    std::vector<LogEntry*> batch_;
+    size_t max_batch_size_;
+    std::mutex appenders_mutex_;
+    std::mutex wake_mutex_;
     std::condition_variable condition_;
+    std::atomic<bool> worker_waiting_{false};
     std::thread worker_thread_;
     std::atomic<bool> shutdown_;
     LogLevel min_level_;
     std::string name_;
     
+    // Drains everything currently published; returns the number of entries written.
+    // Entries are only claimed while holding appenders_mutex_, so flush() can
+    // wait for in-flight entries by taking the same mutex.
+    size_t drainQueue() {
+        std::lock_guard<std::mutex> lock(appenders_mutex_);
+        size_t written = 0;
+        size_t claimed;
+        
+        while ((claimed = ring_.tryPopBatch(batch_, max_batch_size_, [this](LogEntry* const* entries, size_t count) {
+            // Write the whole batch to each appender, rendering deferred
+            // messages just before the first appender that reads them
+            bool rendered = false;
+            for (auto& appender : appenders_) {
+                if (!rendered && appender->needsRenderedMessage()) {
+                    for (size_t i = 0; i < count; ++i) {
+                        if (entries[i]->format) {
+                            entries[i]->args.render(entries[i]->format, entries[i]->message);
+                        }
+                    }
+                    rendered = true;
+                }
+                try {
+                    appender->appendBatch(entries, count);
+                } catch (const std::exception& e) {
+                    std::cerr << "Logger error in appender: " << e.what() << std::endl;
+                }
+            }
+        })) > 0) {
+            written += claimed;
+        }
+        
+        if (written == 0) {
+            for (auto& appender : appenders_) {
+                try {
+                    appender->flushIfStale();
+                } catch (const std::exception& e) {
+                    std::cerr << "Logger error in appender: " << e.what() << std::endl;
+                }
+            }
+        }
+        
+        return written;
+    }
+    
+    void wakeWorker() {
+        if (worker_waiting_.load()) {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            condition_.notify_one();
+        }
+    }
+    
     void workerFunction() {
         while (!shutdown_.load()) {
-            std::unique_lock<std::mutex> lock(queue_mutex_);
-            condition_.wait(lock, [this]() { return !log_queue_.empty() || shutdown_.load(); });
+            if (drainQueue() > 0) {
+                continue;
+            }
             
-            while (!log_queue_.empty()) {
-                LogEntry entry = std::move(log_queue_.front());
-                log_queue_.pop();
-                lock.unlock();
-                
-                // Write to all appenders
-                for (auto& appender : appenders_) {
-                    try {
-                        appender->append(entry);
-                    } catch (const std::exception& e) {
-                        std::cerr << "Logger error in appender: " << e.what() << std::endl;
-                    }
-                }
-                
-                lock.lock();
+            // Producers check worker_waiting_ after publishing, so either they
+            // see the flag or we see their entry here; the timeout is a backstop.
+            worker_waiting_.store(true);
+            if (ring_.empty() && !shutdown_.load()) {
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                condition_.wait_for(lock, std::chrono::milliseconds(50), [this]() {
+                    return !ring_.empty() || shutdown_.load();
+                });
             }
+            worker_waiting_.store(false);
         }
         
+        drainQueue();
+        
         // Flush all appenders on shutdown
+        std::lock_guard<std::mutex> lock(appenders_mutex_);
         for (auto& appender : appenders_) {
             appender->flush();
         }
     }
     
+    static void backoff(unsigned& attempt) {
+        if (++attempt < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+    
+    // Writes one entry into the ring buffer, applying the overflow policy
+    template<typename Fill>
+    void publish(Fill&& fill) {
+        unsigned attempt = 0;
+        while (!ring_.tryPush(fill)) {
+            switch (overflow_policy_.load(std::memory_order_relaxed)) {
+                case OverflowPolicy::DROP_NEWEST:
+                    dropped_count_.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                case OverflowPolicy::DROP_OLDEST:
+                    // Popping only makes room when the slot the next push needs holds a
+                    // queued entry. While the worker is still writing that slot out,
+                    // every queued entry could be discarded and the push would still
+                    // wait, so the new entry is dropped instead.
+                    if (ring_.enqueuePosition() - ring_.dequeuePosition() < ring_.capacity()) {
+                        dropped_count_.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+                    if (ring_.tryPop([](const LogEntry&) {})) {
+                        dropped_count_.fetch_add(1, std::memory_order_relaxed);
+                        continue;
+                    }
+                    break;
+                case OverflowPolicy::BLOCK:
+                default:
+                    break;
+            }
+            
+            if (shutdown_.load(std::memory_order_relaxed)) {
+                dropped_count_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            wakeWorker();
+            backoff(attempt);
+        }
+        
+        wakeWorker();
+    }
+    
 public:
-    explicit AsyncLogger(const std::string& name, LogLevel min_level = LogLevel::INFO)
-        : shutdown_(false), min_level_(min_level), name_(name) {
+    explicit AsyncLogger(const std::string& name, LogLevel min_level = LogLevel::INFO,
+                         size_t queue_capacity = 8192,
+                         OverflowPolicy policy = OverflowPolicy::BLOCK)
+        : ring_(queue_capacity), overflow_policy_(policy)
+        , max_batch_size_(std::max<size_t>(1, std::min<size_t>(256, ring_.capacity() / 4)))
+        , shutdown_(false)
+        , min_level_(min_level), name_(name) {
         worker_thread_ = std::thread(&AsyncLogger::workerFunction, this);
     }
     
@@ -517,9 +1473,11 @@ public:
     }
     
     void shutdown() {
-        if (!shutdown_.load()) {
-            shutdown_.store(true);
-            condition_.notify_all();
+        if (!shutdown_.exchange(true)) {
+            {
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+                condition_.notify_all();
+            }
             if (worker_thread_.joinable()) {
                 worker_thread_.join();
             }
@@ -527,7 +1485,7 @@ public:
     }
     
     void addAppender(std::unique_ptr<LogAppender> appender) {
-        std::lock_guard<std::mutex> lock(queue_mutex_);
+        std::lock_guard<std::mutex> lock(appenders_mutex_);
         appenders_.push_back(std::move(appender));
     }
     
@@ -543,17 +1501,66 @@ public:
         return level >= min_level_;
     }
     
+    void setOverflowPolicy(OverflowPolicy policy) {
+        overflow_policy_.store(policy, std::memory_order_relaxed);
+    }
+    
+    OverflowPolicy getOverflowPolicy() const {
+        return overflow_policy_.load(std::memory_order_relaxed);
+    }
+    
+    // Entries discarded by DROP_NEWEST / DROP_OLDEST since construction
+    uint64_t getDroppedCount() const {
+        return dropped_count_.load(std::memory_order_relaxed);
+    }
+    
+    size_t getQueueCapacity() const { return ring_.capacity(); }
+    
     void log(LogLevel level, const std::string& message,
              const std::string& file = "", const std::string& function = "", int line = 0) {
-        if (!shouldLog(level)) return;
+        if (!shouldLog(level) || shutdown_.load(std::memory_order_relaxed)) return;
         
-        LogEntry entry(level, name_, message, file, function, line);
+        publish([&](LogEntry& entry) {
+            // Assigning into the slot reuses the capacity its strings already have
+            entry.timestamp = std::chrono::system_clock::now();
+            entry.level = level;
+            entry.logger_name = name_;
+            entry.message = message;
+            entry.file = file;
+            entry.function = function;
+            entry.line = line;
+            entry.thread_id = std::this_thread::get_id();
+            entry.format = nullptr;
+            entry.args.clear();
+        });
+    }
+    
+    // Deferred-format logging: only the arguments are captured here, in binary
+    // form; "{}" placeholders are expanded on the worker thread. `format` must
+    // be a string literal (or otherwise outlive the logger).
+    template<typename... Args>
+    void logf(LogLevel level, const char* format, const Args&... args) {
+        logfAt(level, "", "", 0, format, args...);
+    }
+    
+    template<typename... Args>
+    void logfAt(LogLevel level, const char* file, const char* function, int line,
+                const char* format, const Args&... args) {
+        if (!shouldLog(level) || shutdown_.load(std::memory_order_relaxed)) return;
         
-        {
-            std::lock_guard<std::mutex> lock(queue_mutex_);
-            log_queue_.push(std::move(entry));
-        }
-        condition_.notify_one();
+        publish([&](LogEntry& entry) {
+            entry.timestamp = std::chrono::system_clock::now();
+            entry.level = level;
+            entry.logger_name = name_;
+            entry.message.clear();
+            entry.file = file;
+            entry.function = function;
+            entry.line = line;
+            entry.thread_id = std::this_thread::get_id();
+            entry.format = format;
+            entry.args.clear();
+            (entry.args.append(args), ...);
+        });
     }
     
     // Convenience methods
@@ -587,8 +1594,17 @@ public:
         log(LogLevel::FATAL, message, file, function, line);
     }
     
+    // Waits until everything logged before the call has reached the appenders,
+    // then flushes them.
     void flush() {
-        std::lock_guard<std::mutex> lock(queue_mutex_);
+        size_t target = ring_.enqueuePosition();
+        unsigned attempt = 0;
+        while (ring_.dequeuePosition() < target && !shutdown_.load()) {
+            wakeWorker();
+            backoff(attempt);
+        }
+        
+        std::lock_guard<std::mutex> lock(appenders_mutex_);
         for (auto& appender : appenders_) {
             appender->flush();
         }
@@ -602,7 +1618,7 @@ public:
 class LoggerManager {
 private:
     std::unordered_map<std::string, std::unique_ptr<AsyncLogger>> loggers_;
-    std::mutex loggers_mutex_;
+    mutable std::mutex loggers_mutex_;
     LogLevel default_level_;
     
     LoggerManager() : default_level_(LogLevel::INFO) {}
@@ -684,6 +1700,31 @@ public:
     do { if ((logger)->shouldLog(CppVerseHub::Utils::LogLevel::FATAL)) { \
         (logger)->fatal(message, __FILE__, __FUNCTION__, __LINE__); } } while(0)
 
+// Deferred-format variants: LOGF_INFO(logger, "Fleet {} at sector {}", id, sector)
+#define LOGF_TRACE(logger, ...) \
+    do { if ((logger)->shouldLog(CppVerseHub::Utils::LogLevel::TRACE)) { \
+        (logger)->logfAt(CppVerseHub::Utils::LogLevel::TRACE, __FILE__, __FUNCTION__, __LINE__, __VA_ARGS__); } } while(0)
+
+#define LOGF_DEBUG(logger, ...) \
+    do { if ((logger)->shouldLog(CppVerseHub::Utils::LogLevel::DEBUG)) { \
+        (logger)->logfAt(CppVerseHub::Utils::LogLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, __VA_ARGS__); } } while(0)
+
+#define LOGF_INFO(logger, ...) \
+    do { if ((logger)->shouldLog(CppVerseHub::Utils::LogLevel::INFO)) { \
+        (logger)->logfAt(CppVerseHub::Utils::LogLevel::INFO, __FILE__, __FUNCTION__, __LINE__, __VA_ARGS__); } } while(0)
+
+#define LOGF_WARN(logger, ...) \
+    do { if ((logger)->shouldLog(CppVerseHub::Utils::LogLevel::WARN)) { \
+        (logger)->logfAt(CppVerseHub::Utils::LogLevel::WARN, __FILE__, __FUNCTION__, __LINE__, __VA_ARGS__); } } while(0)
+
+#define LOGF_ERROR(logger, ...) \
+    do { if ((logger)->shouldLog(CppVerseHub::Utils::LogLevel::ERROR)) { \
+        (logger)->logfAt(CppVerseHub::Utils::LogLevel::ERROR, __FILE__, __FUNCTION__, __LINE__, __VA_ARGS__); } } while(0)
+
+#define LOGF_FATAL(logger, ...) \
+    do { if ((logger)->shouldLog(CppVerseHub::Utils::LogLevel::FATAL)) { \
+        (logger)->logfAt(CppVerseHub::Utils::LogLevel::FATAL, __FILE__, __FUNCTION__, __LINE__, __VA_ARGS__); } } while(0)
+
 // ===== SCOPED LOGGER FOR RAII =====
 
 class ScopedLogger {
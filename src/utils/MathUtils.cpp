@@ -2,11 +2,30 @@
 // Mathematical Computations Implementation
 
 #include "MathUtils.hpp"
+#include "ParallelTasks.hpp"
 #include <iostream>
 #include <iomanip>
+#include <chrono>
+
+// Wider kernels are picked here, by utils_lib's own flags; MathUtils.hpp only
+// holds code that is the same in every translation unit
+#if defined(CPPVERSEHUB_MATH_SSE2) && defined(__AVX2__)
+#define CPPVERSEHUB_MATH_AVX2 1
+#endif
 
 namespace CppVerseHub::Utils::Math {
 
+namespace {
+
+// Worker threads to use: requested (0 = every thread of the shared utility
+// pool), but no more than one per min_work units of work
+size_t workerThreads(size_t requested, size_t work, size_t min_work) {
+    size_t threads = requested > 0 ? requested : parallelTaskThreads();
+    return std::max<size_t>(1, std::min(threads, work / min_work));
+}
+
+} // namespace
+
 // ===== FAST MATH IMPLEMENTATIONS =====
 
 float fastInverseSqrt(float x) {
@@ -32,6 +51,68 @@ double accurateInverseSqrt(double x) {
     return guess;
 }
 
+// ===== SIMD KERNEL IMPLEMENTATIONS =====
+
+#ifdef CPPVERSEHUB_MATH_SSE2
+namespace Simd {
+    
+    // out row i = sum over k of a[i][k] * b row k, one row per register
+    // (two halves without AVX2)
+    void multiply(const Rows<double, 4>& a, const Rows<double, 4>& b, Rows<double, 4>& out) {
+#ifdef CPPVERSEHUB_MATH_AVX2
+        __m256d b0 = _mm256_loadu_pd(b[0].data()), b1 = _mm256_loadu_pd(b[1].data());
+        __m256d b2 = _mm256_loadu_pd(b[2].data()), b3 = _mm256_loadu_pd(b[3].data());
+        for (size_t i = 0; i < 4; ++i) {
+            __m256d sum = _mm256_mul_pd(_mm256_set1_pd(a[i][0]), b0);
+            sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_set1_pd(a[i][1]), b1));
+            sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_set1_pd(a[i][2]), b2));
+            sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_set1_pd(a[i][3]), b3));
+            _mm256_storeu_pd(out[i].data(), sum);
+        }
+#else
+        for (size_t half = 0; half < 4; half += 2) {
+            __m128d b0 = _mm_loadu_pd(b[0].data() + half), b1 = _mm_loadu_pd(b[1].data() + half);
+            __m128d b2 = _mm_loadu_pd(b[2].data() + half), b3 = _mm_loadu_pd(b[3].data() + half);
+            for (size_t i = 0; i < 4; ++i) {
+                __m128d sum = _mm_mul_pd(_mm_set1_pd(a[i][0]), b0);
+                sum = _mm_add_pd(sum, _mm_mul_pd(_mm_set1_pd(a[i][1]), b1));
+                sum = _mm_add_pd(sum, _mm_mul_pd(_mm_set1_pd(a[i][2]), b2));
+                sum = _mm_add_pd(sum, _mm_mul_pd(_mm_set1_pd(a[i][3]), b3));
+                _mm_storeu_pd(out[i].data() + half, sum);
+            }
+        }
+#endif
+    }
+    
+    void sqrtInPlace(float* values, size_t count) {
+        size_t i = 0;
+#ifdef CPPVERSEHUB_MATH_AVX2
+        for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_ps(values + i, _mm256_sqrt_ps(_mm256_loadu_ps(values + i)));
+        }
+#endif
+        for (; i + 4 <= count; i += 4) {
+            _mm_storeu_ps(values + i, _mm_sqrt_ps(_mm_loadu_ps(values + i)));
+        }
+        for (; i < count; ++i) values[i] = std::sqrt(values[i]);
+    }
+    
+    void sqrtInPlace(double* values, size_t count) {
+        size_t i = 0;
+#ifdef CPPVERSEHUB_MATH_AVX2
+        for (; i + 4 <= count; i += 4) {
+            _mm256_storeu_pd(values + i, _mm256_sqrt_pd(_mm256_loadu_pd(values + i)));
+        }
+#endif
+        for (; i + 2 <= count; i += 2) {
+            _mm_storeu_pd(values + i, _mm_sqrt_pd(_mm_loadu_pd(values + i)));
+        }
+        for (; i < count; ++i) values[i] = std::sqrt(values[i]);
+    }
+    
+} // namespace Simd
+#endif
+
 // ===== TRANSFORMATION MATRIX IMPLEMENTATIONS =====
 
 namespace Transform {
@@ -194,6 +275,200 @@ namespace Transform {
 
 namespace Noise {
     
+    namespace {
+        
+        constexpr size_t NoiseBatchSize = 256;
+        constexpr size_t MinSamplesPerThread = 16384;
+        
+        // The octave sum of octaveNoise over a grid, NoiseBatchSize points of a
+        // row at a time, rows shared out across threads. batch(x, y, z, out, n)
+        // evaluates single-octave noise at n points. The arithmetic (and its
+        // order) matches octaveNoise exactly so the results are bitwise equal.
+        template<typename Batch>
+        void fillNoiseGrid(const Batch& batch, double x0, double y0, double z0, double dx, double dy, double dz,
+                           size_t width, size_t height, size_t depth, int octaves, double persistence,
+                           double* out, size_t threads) {
+            const size_t rows = height * depth;
+            if (width == 0 || rows == 0) return;
+            
+            double max_value = 0.0;
+            double amplitude = 1.0;
+            for (int octave = 0; octave < octaves; ++octave) {
+                max_value += amplitude;
+                amplitude *= persistence;
+            }
+            
+            runParallelTasks(rows, workerThreads(threads, width * rows, MinSamplesPerThread), [&](size_t row) {
+                const double y = y0 + static_cast<double>(row % height) * dy;
+                const double z = z0 + static_cast<double>(row / height) * dz;
+                double* row_out = out + row * width;
+                
+                double bx[NoiseBatchSize], by[NoiseBatchSize], bz[NoiseBatchSize];
+                double values[NoiseBatchSize], total[NoiseBatchSize];
+                for (size_t begin = 0; begin < width; begin += NoiseBatchSize) {
+                    const size_t count = std::min(NoiseBatchSize, width - begin);
+                    std::fill(total, total + count, 0.0);
+                    
+                    double frequency = 1.0;
+                    double octave_amplitude = 1.0;
+                    for (int octave = 0; octave < octaves; ++octave) {
+                        for (size_t i = 0; i < count; ++i) {
+                            bx[i] = (x0 + static_cast<double>(begin + i) * dx) * frequency;
+                            by[i] = y * frequency;
+                            bz[i] = z * frequency;
+                        }
+                        batch(bx, by, bz, values, count);
+                        for (size_t i = 0; i < count; ++i) {
+                            total[i] += values[i] * octave_amplitude;
+                        }
+                        octave_amplitude *= persistence;
+                        frequency *= 2.0;
+                    }
+                    
+                    for (size_t i = 0; i < count; ++i) {
+                        row_out[begin + i] = total[i] / max_value;
+                    }
+                }
+            });
+        }
+        
+#ifdef CPPVERSEHUB_MATH_AVX2
+        // Four-lane versions of PerlinNoise::noise and SimplexNoise::noise(x, y).
+        // Every operation mirrors the scalar code in the same order (the build
+        // disables FMA contraction), so the lanes are bitwise equal to it.
+        
+        inline __m256d selectLanes(__m128i mask, __m256d if_true, __m256d if_false) {
+            return _mm256_blendv_pd(if_false, if_true, _mm256_castsi256_pd(_mm256_cvtepi32_epi64(mask)));
+        }
+        
+        inline __m256d negateLanes(__m128i mask, __m256d value) {
+            __m256d sign = _mm256_and_pd(_mm256_castsi256_pd(_mm256_cvtepi32_epi64(mask)), _mm256_set1_pd(-0.0));
+            return _mm256_xor_pd(value, sign);
+        }
+        
+        inline __m256d perlinFade4(__m256d t) {
+            __m256d inner = _mm256_add_pd(_mm256_mul_pd(t, _mm256_sub_pd(_mm256_mul_pd(t, _mm256_set1_pd(6.0)),
+                                                                        _mm256_set1_pd(15.0))),
+                                          _mm256_set1_pd(10.0));
+            return _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(t, t), t), inner);
+        }
+        
+        // The repository's lerp(a, b, t) called as lerp(w, a, b): w + b * (a - w)
+        inline __m256d perlinLerp4(__m256d w, __m256d a, __m256d b) {
+            return _mm256_add_pd(w, _mm256_mul_pd(b, _mm256_sub_pd(a, w)));
+        }
+        
+        inline __m256d perlinGrad4(__m128i hash, __m256d x, __m256d y, __m256d z) {
+            __m128i h = _mm_and_si128(hash, _mm_set1_epi32(15));
+            __m256d u = selectLanes(_mm_cmplt_epi32(h, _mm_set1_epi32(8)), x, y);
+            __m128i use_x = _mm_or_si128(_mm_cmpeq_epi32(h, _mm_set1_epi32(12)), _mm_cmpeq_epi32(h, _mm_set1_epi32(14)));
+            __m256d v = selectLanes(_mm_cmplt_epi32(h, _mm_set1_epi32(4)), y, selectLanes(use_x, x, z));
+            __m128i flip_u = _mm_cmpeq_epi32(_mm_and_si128(h, _mm_set1_epi32(1)), _mm_set1_epi32(1));
+            __m128i flip_v = _mm_cmpeq_epi32(_mm_and_si128(h, _mm_set1_epi32(2)), _mm_set1_epi32(2));
+            return _mm256_add_pd(negateLanes(flip_u, u), negateLanes(flip_v, v));
+        }
+        
+        inline __m128i gather4(const int* table, __m128i index) {
+            return _mm_i32gather_epi32(table, index, 4);
+        }
+        
+        __m256d perlinNoise4(const int* perm, __m256d x, __m256d y, __m256d z) {
+            const __m128i mask = _mm_set1_epi32(255);
+            const __m128i one = _mm_set1_epi32(1);
+            const __m256d one_d = _mm256_set1_pd(1.0);
+            
+            __m256d fx = _mm256_floor_pd(x);
+            __m256d fy = _mm256_floor_pd(y);
+            __m256d fz = _mm256_floor_pd(z);
+            __m128i X = _mm_and_si128(_mm256_cvttpd_epi32(fx), mask);
+            __m128i Y = _mm_and_si128(_mm256_cvttpd_epi32(fy), mask);
+            __m128i Z = _mm_and_si128(_mm256_cvttpd_epi32(fz), mask);
+            
+            x = _mm256_sub_pd(x, fx);
+            y = _mm256_sub_pd(y, fy);
+            z = _mm256_sub_pd(z, fz);
+            
+            __m256d u = perlinFade4(x);
+            __m256d v = perlinFade4(y);
+            __m256d w = perlinFade4(z);
+            
+            __m128i A = _mm_add_epi32(gather4(perm, X), Y);
+            __m128i AA = _mm_add_epi32(gather4(perm, A), Z);
+            __m128i AB = _mm_add_epi32(gather4(perm, _mm_add_epi32(A, one)), Z);
+            __m128i B = _mm_add_epi32(gather4(perm, _mm_add_epi32(X, one)), Y);
+            __m128i BA = _mm_add_epi32(gather4(perm, B), Z);
+            __m128i BB = _mm_add_epi32(gather4(perm, _mm_add_epi32(B, one)), Z);
+            
+            __m256d x1 = _mm256_sub_pd(x, one_d);
+            __m256d y1 = _mm256_sub_pd(y, one_d);
+            __m256d z1 = _mm256_sub_pd(z, one_d);
+            
+            __m256d near_z = perlinLerp4(v, perlinLerp4(u, perlinGrad4(gather4(perm, AA), x, y, z),
+                                                           perlinGrad4(gather4(perm, BA), x1, y, z)),
+                                            perlinLerp4(u, perlinGrad4(gather4(perm, AB), x, y1, z),
+                                                           perlinGrad4(gather4(perm, BB), x1, y1, z)));
+            __m256d far_z = perlinLerp4(v, perlinLerp4(u, perlinGrad4(gather4(perm, _mm_add_epi32(AA, one)), x, y, z1),
+                                                          perlinGrad4(gather4(perm, _mm_add_epi32(BA, one)), x1, y, z1)),
+                                           perlinLerp4(u, perlinGrad4(gather4(perm, _mm_add_epi32(AB, one)), x, y1, z1),
+                                                          perlinGrad4(gather4(perm, _mm_add_epi32(BB, one)), x1, y1, z1)));
+            return perlinLerp4(w, near_z, far_z);
+        }
+        
+        // (t < 0 ? 0 : t^4 * (+-x +-y)) for one simplex corner; gi selects the signs
+        inline __m256d simplexCorner4(__m128i gi, __m256d x, __m256d y) {
+            __m256d t = _mm256_sub_pd(_mm256_sub_pd(_mm256_set1_pd(0.5), _mm256_mul_pd(x, x)), _mm256_mul_pd(y, y));
+            __m256d t_sq = _mm256_mul_pd(t, t);
+            __m128i flip_x = _mm_cmpeq_epi32(_mm_and_si128(gi, _mm_set1_epi32(1)), _mm_setzero_si128());
+            __m128i flip_y = _mm_cmpeq_epi32(_mm_and_si128(gi, _mm_set1_epi32(2)), _mm_setzero_si128());
+            __m256d n = _mm256_mul_pd(_mm256_mul_pd(t_sq, t_sq),
+                                      _mm256_add_pd(negateLanes(flip_x, x), negateLanes(flip_y, y)));
+            return _mm256_blendv_pd(n, _mm256_setzero_pd(), _mm256_cmp_pd(t, _mm256_setzero_pd(), _CMP_LT_OQ));
+        }
+        
+        // value % 12 for permutation entries (0..255): floor(value * 2731 / 2^15)
+        // equals value / 12 over that range
+        inline __m128i mod12(__m128i value) {
+            __m128i quotient = _mm_srli_epi32(_mm_mullo_epi32(value, _mm_set1_epi32(2731)), 15);
+            return _mm_sub_epi32(value, _mm_mullo_epi32(quotient, _mm_set1_epi32(12)));
+        }
+        
+        __m256d simplexNoise4(const int* perm, __m256d x, __m256d y) {
+            const double F2 = 0.5 * (std::sqrt(3.0) - 1.0);
+            const double G2 = (3.0 - std::sqrt(3.0)) / 6.0;
+            const __m128i mask = _mm_set1_epi32(255);
+            const __m128i one = _mm_set1_epi32(1);
+            
+            __m256d s = _mm256_mul_pd(_mm256_add_pd(x, y), _mm256_set1_pd(F2));
+            __m128i i = _mm256_cvttpd_epi32(_mm256_floor_pd(_mm256_add_pd(x, s)));
+            __m128i j = _mm256_cvttpd_epi32(_mm256_floor_pd(_mm256_add_pd(y, s)));
+            
+            __m256d t = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_add_epi32(i, j)), _mm256_set1_pd(G2));
+            __m256d x0 = _mm256_sub_pd(x, _mm256_sub_pd(_mm256_cvtepi32_pd(i), t));
+            __m256d y0 = _mm256_sub_pd(y, _mm256_sub_pd(_mm256_cvtepi32_pd(j), t));
+            
+            __m256d x_major = _mm256_cmp_pd(x0, y0, _CMP_GT_OQ);
+            __m128i i1 = _mm256_cvttpd_epi32(_mm256_and_pd(x_major, _mm256_set1_pd(1.0)));
+            __m128i j1 = _mm_sub_epi32(one, i1);
+            
+            __m256d x1 = _mm256_add_pd(_mm256_sub_pd(x0, _mm256_cvtepi32_pd(i1)), _mm256_set1_pd(G2));
+            __m256d y1 = _mm256_add_pd(_mm256_sub_pd(y0, _mm256_cvtepi32_pd(j1)), _mm256_set1_pd(G2));
+            __m256d x2 = _mm256_add_pd(_mm256_sub_pd(x0, _mm256_set1_pd(1.0)), _mm256_set1_pd(2.0 * G2));
+            __m256d y2 = _mm256_add_pd(_mm256_sub_pd(y0, _mm256_set1_pd(1.0)), _mm256_set1_pd(2.0 * G2));
+            
+            __m128i ii = _mm_and_si128(i, mask);
+            __m128i jj = _mm_and_si128(j, mask);
+            __m128i gi0 = mod12(gather4(perm, _mm_add_epi32(ii, gather4(perm, jj))));
+            __m128i gi1 = mod12(gather4(perm, _mm_add_epi32(_mm_add_epi32(ii, i1), gather4(perm, _mm_add_epi32(jj, j1)))));
+            __m128i gi2 = mod12(gather4(perm, _mm_add_epi32(_mm_add_epi32(ii, one), gather4(perm, _mm_add_epi32(jj, one)))));
+            
+            __m256d n = _mm256_add_pd(_mm256_add_pd(simplexCorner4(gi0, x0, y0), simplexCorner4(gi1, x1, y1)),
+                                      simplexCorner4(gi2, x2, y2));
+            return _mm256_mul_pd(_mm256_set1_pd(70.0), n);
+        }
+#endif
+        
+    } // anonymous namespace
+    
     PerlinNoise::PerlinNoise(unsigned int seed) {
         // Initialize permutation table
         std::mt19937 generator(seed);
@@ -274,6 +549,32 @@ namespace Noise {
         return value;
     }
     
+    void PerlinNoise::noiseBatch(const double* x, const double* y, const double* z, double* out, size_t count) const {
+        size_t i = 0;
+#ifdef CPPVERSEHUB_MATH_AVX2
+        for (; i + 4 <= count; i += 4) {
+            _mm256_storeu_pd(out + i, perlinNoise4(permutation_.data(), _mm256_loadu_pd(x + i),
+                                                   _mm256_loadu_pd(y + i), _mm256_loadu_pd(z + i)));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = noise(x[i], y[i], z[i]);
+        }
+    }
+    
+    void PerlinNoise::fillGrid(double x0, double y0, double dx, double dy, size_t width, size_t height,
+                               int octaves, double* out, double persistence, size_t threads) const {
+        fillGrid(x0, y0, 0.0, dx, dy, 0.0, width, height, 1, octaves, out, persistence, threads);
+    }
+    
+    void PerlinNoise::fillGrid(double x0, double y0, double z0, double dx, double dy, double dz,
+                               size_t width, size_t height, size_t depth,
+                               int octaves, double* out, double persistence, size_t threads) const {
+        fillNoiseGrid([this](const double* x, const double* y, const double* z, double* values, size_t count) {
+            noiseBatch(x, y, z, values, count);
+        }, x0, y0, z0, dx, dy, dz, width, height, depth, octaves, persistence, out, threads);
+    }
+    
     SimplexNoise::SimplexNoise(unsigned int seed) {
         std::mt19937 generator(seed);
         std::iota(perm_.begin(), perm_.begin() + 256, 0);
@@ -351,6 +652,85 @@ namespace Noise {
         return 0.5 * (noise(x, y) + noise(y + 0.1, z + 0.1));
     }
     
+    double SimplexNoise::octaveNoise(double x, double y, int octaves, double persistence) const {
+        double total = 0.0;
+        double frequency = 1.0;
+        double amplitude = 1.0;
+        double max_value = 0.0;
+        
+        for (int i = 0; i < octaves; ++i) {
+            total += noise(x * frequency, y * frequency) * amplitude;
+            
+            max_value += amplitude;
+            amplitude *= persistence;
+            frequency *= 2.0;
+        }
+        
+        return total / max_value;
+    }
+    
+    double SimplexNoise::octaveNoise(double x, double y, double z, int octaves, double persistence) const {
+        double total = 0.0;
+        double frequency = 1.0;
+        double amplitude = 1.0;
+        double max_value = 0.0;
+        
+        for (int i = 0; i < octaves; ++i) {
+            total += noise(x * frequency, y * frequency, z * frequency) * amplitude;
+            
+            max_value += amplitude;
+            amplitude *= persistence;
+            frequency *= 2.0;
+        }
+        
+        return total / max_value;
+    }
+    
+    void SimplexNoise::noiseBatch(const double* x, const double* y, double* out, size_t count) const {
+        size_t i = 0;
+#ifdef CPPVERSEHUB_MATH_AVX2
+        for (; i + 4 <= count; i += 4) {
+            _mm256_storeu_pd(out + i, simplexNoise4(perm_.data(), _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = noise(x[i], y[i]);
+        }
+    }
+    
+    void SimplexNoise::noiseBatch(const double* x, const double* y, const double* z, double* out, size_t count) const {
+        size_t i = 0;
+#ifdef CPPVERSEHUB_MATH_AVX2
+        const __m256d offset = _mm256_set1_pd(0.1);
+        for (; i + 4 <= count; i += 4) {
+            __m256d vx = _mm256_loadu_pd(x + i);
+            __m256d vy = _mm256_loadu_pd(y + i);
+            __m256d vz = _mm256_loadu_pd(z + i);
+            __m256d sum = _mm256_add_pd(simplexNoise4(perm_.data(), vx, vy),
+                                        simplexNoise4(perm_.data(), _mm256_add_pd(vy, offset), _mm256_add_pd(vz, offset)));
+            _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_set1_pd(0.5), sum));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = noise(x[i], y[i], z[i]);
+        }
+    }
+    
+    void SimplexNoise::fillGrid(double x0, double y0, double dx, double dy, size_t width, size_t height,
+                                int octaves, double* out, double persistence, size_t threads) const {
+        fillNoiseGrid([this](const double* x, const double* y, const double*, double* values, size_t count) {
+            noiseBatch(x, y, values, count);
+        }, x0, y0, 0.0, dx, dy, 0.0, width, height, 1, octaves, persistence, out, threads);
+    }
+    
+    void SimplexNoise::fillGrid(double x0, double y0, double z0, double dx, double dy, double dz,
+                                size_t width, size_t height, size_t depth,
+                                int octaves, double* out, double persistence, size_t threads) const {
+        fillNoiseGrid([this](const double* x, const double* y, const double* z, double* values, size_t count) {
+            noiseBatch(x, y, z, values, count);
+        }, x0, y0, z0, dx, dy, dz, width, height, depth, octaves, persistence, out, threads);
+    }
+    
 } // namespace Noise
 
 // ===== SPACE CALCULATIONS IMPLEMENTATIONS =====
@@ -436,29 +816,60 @@ namespace Space {
         return transfer;
     }
     
+    namespace {
+        
+        // Bodies closer than this exert no force on each other, matching
+        // gravitationalForce for coincident positions
+        constexpr double MinDistanceSq = std::numeric_limits<double>::epsilon() * std::numeric_limits<double>::epsilon();
+        
+        // Below this many bodies per thread, extra threads cost more than they save
+        constexpr size_t MinBodiesPerThread = 256;
+        
+        // Cells with at most this many bodies are summed directly; the depth
+        // cap stops subdivision when bodies (nearly) coincide
+        constexpr std::uint32_t OctreeLeafSize = 8;
+        constexpr std::uint32_t OctreeMaxDepth = 32;
+        
+        // Child octant of p within a cell centred at center: bit 0 = x, 1 = y, 2 = z
+        std::uint32_t octantOf(const Vec3d& p, const Vec3d& center) {
+            return (p[0] >= center[0] ? 1u : 0u) | (p[1] >= center[1] ? 2u : 0u) | (p[2] >= center[2] ? 4u : 0u);
+        }
+        
+    } // anonymous namespace
+    
     void NBodySimulator::addBody(double mass, const Vec3d& position, const Vec3d& velocity) {
-        bodies_.push_back({mass, position, velocity, Vec3d(0, 0, 0)});
+        masses_.push_back(mass);
+        positions_.push_back(position);
+        velocities_.push_back(velocity);
+        accelerations_.push_back(Vec3d(0, 0, 0));
+        accelerations_current_ = false;
+    }
+    
+    void NBodySimulator::setForceMethod(ForceMethod method, double theta) {
+        if (!std::isfinite(theta) || theta < 0.0) {
+            throw std::invalid_argument("Barnes-Hut opening angle must be finite and non-negative");
+        }
+        force_method_ = method;
+        theta_ = theta;
+        accelerations_current_ = false;
     }
     
     void NBodySimulator::step() {
-        // Calculate accelerations
-        for (size_t i = 0; i < bodies_.size(); ++i) {
-            bodies_[i].acceleration = Vec3d(0, 0, 0);
-            
-            for (size_t j = 0; j < bodies_.size(); ++j) {
-                if (i == j) continue;
-                
-                Vec3d force = gravitationalForce(bodies_[i].mass, bodies_[j].mass,
-                                               bodies_[i].position, bodies_[j].position);
-                bodies_[i].acceleration += force / bodies_[i].mass;
-            }
+        if (integrator_ == Integrator::Leapfrog) {
+            // Kick-drift-kick; the closing kick's accelerations open the next step
+            if (!accelerations_current_) computeAccelerations();
+            velocities_.addScaled(accelerations_, 0.5 * time_step_);
+            positions_.addScaled(velocities_, time_step_);
+            computeAccelerations();
+            velocities_.addScaled(accelerations_, 0.5 * time_step_);
+            return;
         }
         
-        // Update positions and velocities (Verlet integration)
-        for (auto& body : bodies_) {
-            body.position += body.velocity * time_step_ + body.acceleration * (0.5 * time_step_ * time_step_);
-            body.velocity += body.acceleration * time_step_;
-        }
+        computeAccelerations();
+        positions_.addScaled(velocities_, time_step_);
+        positions_.addScaled(accelerations_, 0.5 * time_step_ * time_step_);
+        velocities_.addScaled(accelerations_, time_step_);
+        accelerations_current_ = false;
     }
     
     void NBodySimulator::simulate(double duration) {
@@ -469,6 +880,228 @@ namespace Space {
         }
     }
     
+    size_t NBodySimulator::workerCount() const {
+        return workerThreads(thread_count_, masses_.size(), MinBodiesPerThread);
+    }
+    
+    void NBodySimulator::computeAccelerations() {
+        if (force_method_ == ForceMethod::BarnesHut) {
+            computeBarnesHutAccelerations();
+        } else {
+            computeDirectAccelerations();
+        }
+        accelerations_current_ = true;
+    }
+    
+    void NBodySimulator::computeDirectAccelerations() {
+        // Each task owns a block of target bodies, copied to the stack so the
+        // inner loop over targets vectorizes without aliasing checks; sources
+        // stream past once per block
+        constexpr size_t BlockSize = 128;
+        const size_t count = masses_.size();
+        const double* x = positions_.x();
+        const double* y = positions_.y();
+        const double* z = positions_.z();
+        
+        std::vector<double> gm(count);
+        for (size_t j = 0; j < count; ++j) {
+            gm[j] = Constants::GRAVITATIONAL_CONSTANT * masses_[j];
+        }
+        
+        const size_t block_count = (count + BlockSize - 1) / BlockSize;
+        runParallelTasks(block_count, workerCount(), [&](size_t block) {
+            const size_t begin = block * BlockSize;
+            const size_t size = std::min(BlockSize, count - begin);
+            double bx[BlockSize], by[BlockSize], bz[BlockSize];
+            double ax[BlockSize] = {}, ay[BlockSize] = {}, az[BlockSize] = {};
+            std::copy(x + begin, x + begin + size, bx);
+            std::copy(y + begin, y + begin + size, by);
+            std::copy(z + begin, z + begin + size, bz);
+            
+            for (size_t j = 0; j < count; ++j) {
+                const double sx = x[j], sy = y[j], sz = z[j], source_gm = gm[j];
+                for (size_t i = 0; i < size; ++i) {
+                    const double dx = sx - bx[i], dy = sy - by[i], dz = sz - bz[i];
+                    const double distance_sq = dx * dx + dy * dy + dz * dz;
+                    const double scale = distance_sq >= MinDistanceSq
+                        ? source_gm / (distance_sq * std::sqrt(distance_sq)) : 0.0;
+                    ax[i] += dx * scale;
+                    ay[i] += dy * scale;
+                    az[i] += dz * scale;
+                }
+            }
+            
+            std::copy(ax, ax + size, accelerations_.x() + begin);
+            std::copy(ay, ay + size, accelerations_.y() + begin);
+            std::copy(az, az + size, accelerations_.z() + begin);
+        });
+    }
+    
+    void NBodySimulator::computeBarnesHutAccelerations() {
+        buildOctree();
+        
+        // Walk bodies in tree order so neighbouring queries share cells in cache;
+        // chunks are claimed dynamically since dense regions cost more
+        constexpr size_t ChunkSize = 512;
+        const size_t count = order_.size();
+        runParallelTasks((count + ChunkSize - 1) / ChunkSize, workerCount(), [&](size_t chunk) {
+            const size_t end = std::min(count, (chunk + 1) * ChunkSize);
+            for (size_t k = chunk * ChunkSize; k < end; ++k) {
+                accelerations_.set(order_[k], treeAcceleration(sorted_positions_.get(k)));
+            }
+        });
+    }
+    
+    void NBodySimulator::buildOctree() {
+        if (masses_.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("Barnes-Hut supports at most 2^32 - 1 bodies");
+        }
+        const auto count = static_cast<std::uint32_t>(masses_.size());
+        
+        tree_.clear();
+        order_.resize(count);
+        std::iota(order_.begin(), order_.end(), 0u);
+        if (count == 0) return;
+        
+        Vec3d low = positions_.get(0);
+        Vec3d high = low;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            low = low.min(positions_.get(i));
+            high = high.max(positions_.get(i));
+        }
+        Vec3d extent = high - low;
+        double half_size = 0.5 * std::max({extent[0], extent[1], extent[2]});
+        if (half_size <= 0.0) half_size = 1.0;
+        
+        tree_.push_back({(low + high) * 0.5, half_size, Vec3d(0, 0, 0), 0.0, 0, 0, 0, count});
+        buildNode(0, 0);
+        
+        sorted_positions_.resize(count);
+        sorted_gm_.resize(count);
+        for (std::uint32_t k = 0; k < count; ++k) {
+            sorted_positions_.set(k, positions_.get(order_[k]));
+            sorted_gm_[k] = Constants::GRAVITATIONAL_CONSTANT * masses_[order_[k]];
+        }
+    }
+    
+    void NBodySimulator::buildNode(std::uint32_t node_index, std::uint32_t depth) {
+        // Copy: tree_ reallocates as children are appended
+        const OctreeNode node = tree_[node_index];
+        
+        if (node.body_end - node.body_begin <= OctreeLeafSize || depth >= OctreeMaxDepth) {
+            double mass = 0.0;
+            Vec3d weighted(0, 0, 0);
+            for (std::uint32_t k = node.body_begin; k < node.body_end; ++k) {
+                mass += masses_[order_[k]];
+                weighted += positions_.get(order_[k]) * masses_[order_[k]];
+            }
+            tree_[node_index].mass = mass;
+            tree_[node_index].center_of_mass = mass > 0.0 ? weighted / mass : node.center;
+            return;
+        }
+        
+        // Group order_[begin, end) by octant in place (an 8-bucket counting sort)
+        std::array<std::uint32_t, 8> counts{};
+        for (std::uint32_t k = node.body_begin; k < node.body_end; ++k) {
+            ++counts[octantOf(positions_.get(order_[k]), node.center)];
+        }
+        std::array<std::uint32_t, 8> next{};
+        std::array<std::uint32_t, 8> bucket_end{};
+        std::uint32_t offset = node.body_begin;
+        for (std::uint32_t octant = 0; octant < 8; ++octant) {
+            next[octant] = offset;
+            offset += counts[octant];
+            bucket_end[octant] = offset;
+        }
+        for (std::uint32_t octant = 0; octant < 8; ++octant) {
+            while (next[octant] < bucket_end[octant]) {
+                std::uint32_t target = octantOf(positions_.get(order_[next[octant]]), node.center);
+                if (target == octant) {
+                    ++next[octant];
+                } else {
+                    std::swap(order_[next[octant]], order_[next[target]++]);
+                }
+            }
+        }
+        
+        // Non-empty children are stored contiguously, then built depth-first
+        const auto first_child = static_cast<std::uint32_t>(tree_.size());
+        const double child_half = 0.5 * node.half_size;
+        std::uint32_t begin = node.body_begin;
+        for (std::uint32_t octant = 0; octant < 8; ++octant) {
+            if (counts[octant] == 0) continue;
+            Vec3d child_center(node.center[0] + ((octant & 1u) ? child_half : -child_half),
+                               node.center[1] + ((octant & 2u) ? child_half : -child_half),
+                               node.center[2] + ((octant & 4u) ? child_half : -child_half));
+            tree_.push_back({child_center, child_half, Vec3d(0, 0, 0), 0.0, 0, 0, begin, begin + counts[octant]});
+            begin += counts[octant];
+        }
+        const auto child_count = static_cast<std::uint32_t>(tree_.size()) - first_child;
+        tree_[node_index].first_child = first_child;
+        tree_[node_index].child_count = child_count;
+        
+        double mass = 0.0;
+        Vec3d weighted(0, 0, 0);
+        for (std::uint32_t child = first_child; child < first_child + child_count; ++child) {
+            buildNode(child, depth + 1);
+            mass += tree_[child].mass;
+            weighted += tree_[child].center_of_mass * tree_[child].mass;
+        }
+        tree_[node_index].mass = mass;
+        tree_[node_index].center_of_mass = mass > 0.0 ? weighted / mass : node.center;
+    }
+    
+    Vec3d NBodySimulator::treeAcceleration(const Vec3d& position) const {
+        const double theta_sq = theta_ * theta_;
+        const double* x = sorted_positions_.x();
+        const double* y = sorted_positions_.y();
+        const double* z = sorted_positions_.z();
+        double ax = 0.0, ay = 0.0, az = 0.0;
+        
+        // Each level pushes at most 8 children and pops its parent
+        std::array<std::uint32_t, 7 * OctreeMaxDepth + 8> stack;
+        size_t top = 0;
+        stack[top++] = 0;
+        
+        while (top > 0) {
+            const OctreeNode& node = tree_[stack[--top]];
+            
+            if (node.child_count == 0) {
+                // The body itself is in here at distance 0 and adds nothing
+                for (std::uint32_t k = node.body_begin; k < node.body_end; ++k) {
+                    const double dx = x[k] - position[0], dy = y[k] - position[1], dz = z[k] - position[2];
+                    const double distance_sq = dx * dx + dy * dy + dz * dz;
+                    if (distance_sq < MinDistanceSq) continue;
+                    const double scale = sorted_gm_[k] / (distance_sq * std::sqrt(distance_sq));
+                    ax += dx * scale;
+                    ay += dy * scale;
+                    az += dz * scale;
+                }
+                continue;
+            }
+            
+            // Never approximate a cell the body itself lies in
+            Vec3d offset = (position - node.center).abs();
+            bool inside = offset[0] <= node.half_size && offset[1] <= node.half_size && offset[2] <= node.half_size;
+            Vec3d direction = node.center_of_mass - position;
+            double distance_sq = direction.lengthSquared();
+            double size = 2.0 * node.half_size;
+            if (!inside && size * size < theta_sq * distance_sq) {
+                const double scale = Constants::GRAVITATIONAL_CONSTANT * node.mass / (distance_sq * std::sqrt(distance_sq));
+                ax += direction[0] * scale;
+                ay += direction[1] * scale;
+                az += direction[2] * scale;
+                continue;
+            }
+            
+            for (std::uint32_t child = node.first_child; child < node.first_child + node.child_count; ++child) {
+                stack[top++] = child;
+            }
+        }
+        
+        return Vec3d(ax, ay, az);
+    }
+    
 } // namespace Space
 
 // ===== RANDOM GENERATOR IMPLEMENTATION =====
@@ -626,8 +1259,8 @@ void demonstrateMathUtils() {
     // Distance calculations
     Vec2f line_start(0.0f, 0.0f);
     Vec2f line_end(5.0f, 0.0f);
-    Vec2f point(2.5f, 3.0f);
-    float point_line_distance = Geometry::pointToLineDistance(point, line_start, line_end);
+    Vec2f line_point(2.5f, 3.0f);
+    float point_line_distance = Geometry::pointToLineDistance(line_point, line_start, line_end);
     std::cout << "Point to line distance: " << point_line_distance << std::endl;
     
     // Ray-circle intersection
@@ -784,6 +1417,39 @@ void demonstrateSpacePhysics() {
     } else {
         std::cout << "⚠ Earth orbit simulation may need refinement" << std::endl;
     }
+    
+    // Barnes-Hut vs direct summation on a star cluster
+    std::cout << "\nStar cluster, one step with each force method:" << std::endl;
+    const size_t star_count = 3000;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    Space::NBodySimulator direct(1.0);
+    Space::NBodySimulator tree(1.0);
+    tree.setForceMethod(Space::NBodySimulator::ForceMethod::BarnesHut, 0.5);
+    for (size_t i = 0; i < star_count; ++i) {
+        Vec3d position(unit(gen), unit(gen), unit(gen));
+        position *= 1000.0 * Constants::ASTRONOMICAL_UNIT;
+        direct.addBody(Constants::SOLAR_MASS, position, Vec3d(0, 0, 0));
+        tree.addBody(Constants::SOLAR_MASS, position, Vec3d(0, 0, 0));
+    }
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    direct.step();
+    auto direct_time = std::chrono::high_resolution_clock::now() - start_time;
+    start_time = std::chrono::high_resolution_clock::now();
+    tree.step();
+    auto tree_time = std::chrono::high_resolution_clock::now() - start_time;
+    
+    double max_error = 0.0;
+    for (size_t i = 0; i < star_count; ++i) {
+        Vec3d expected = direct.getBodyAcceleration(i);
+        max_error = std::max(max_error, (tree.getBodyAcceleration(i) - expected).length() / expected.length());
+    }
+    std::cout << "  Direct (" << star_count << " stars): "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(direct_time).count() << " ms" << std::endl;
+    std::cout << "  Barnes-Hut (theta 0.5): "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(tree_time).count() << " ms, max relative error "
+              << std::setprecision(4) << max_error << std::endl;
 }
 
 void demonstrateAdvancedMath() {
@@ -13,6 +13,19 @@
 #include <functional>
 #include <limits>
 #include <type_traits>
+#include <cstdint>
+#include <stdexcept>
+#include <map>
+
+// Define CPPVERSEHUB_MATH_SIMD=0 to build the generic loops only
+#ifndef CPPVERSEHUB_MATH_SIMD
+#define CPPVERSEHUB_MATH_SIMD 1
+#endif
+
+#if CPPVERSEHUB_MATH_SIMD && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <immintrin.h>
+#define CPPVERSEHUB_MATH_SSE2 1
+#endif
 
 namespace CppVerseHub::Utils::Math {
 
@@ -89,6 +102,181 @@ float fastInverseSqrt(float x);
 // More accurate version using Newton-Raphson
 double accurateInverseSqrt(double x);
 
+// ===== SIMD KERNELS =====
+
+// Hand-vectorized kernels for Vector / Matrix operations. The SSE2 kernels
+// are inline: SSE2 is part of every x86-64 target, so each translation unit
+// compiles the same code. Wider kernels live out of line in MathUtils.cpp,
+// where utils_lib's own flags pick the instruction set once (AVX2 for the
+// double 4x4 product and sqrtInPlace when available). Products are summed
+// in the same order as the generic loops, starting from the first product
+// rather than zero, and no FMA is used.
+namespace Simd {
+    
+    template<typename T, size_t N>
+    using Rows = std::array<std::array<T, N>, N>;
+    
+    // True when Vector<T, N> / Matrix<T, N, N> have kernels in this build:
+    // divide and multiply, plus dot, cross and matrix * vector when N == 3
+    template<typename T, size_t N>
+    inline constexpr bool has_kernels = false;
+    
+    // Declared for every size so callers can name them; only the
+    // has_kernels sizes below are defined
+    template<typename T, size_t N> void divide(const std::array<T, N>& v, T scalar, std::array<T, N>& out);
+    template<typename T, size_t N> void multiply(const Rows<T, N>& a, const Rows<T, N>& b, Rows<T, N>& out);
+    template<typename T, size_t N> T dot(const std::array<T, N>& a, const std::array<T, N>& b);
+    template<typename T, size_t N> void cross(const std::array<T, N>& a, const std::array<T, N>& b, std::array<T, N>& out);
+    template<typename T, size_t N> void transform(const Rows<T, N>& m, const std::array<T, N>& v, std::array<T, N>& out);
+    
+    // values[i] = sqrt(values[i]). A plain std::sqrt loop does not vectorize
+    // without -fno-math-errno, so the array form has kernels of its own
+    template<typename T>
+    void sqrtInPlace(T* values, size_t count) {
+        for (size_t i = 0; i < count; ++i) values[i] = std::sqrt(values[i]);
+    }
+    
+#ifdef CPPVERSEHUB_MATH_SSE2
+    template<> inline constexpr bool has_kernels<float, 3> = true;
+    template<> inline constexpr bool has_kernels<float, 4> = true;
+    template<> inline constexpr bool has_kernels<double, 3> = true;
+    template<> inline constexpr bool has_kernels<double, 4> = true;
+    
+    inline __m128 load(const std::array<float, 4>& v) { return _mm_loadu_ps(v.data()); }
+    inline void store(std::array<float, 4>& v, __m128 r) { _mm_storeu_ps(v.data(), r); }
+    
+    inline void divide(const std::array<float, 4>& v, float scalar, std::array<float, 4>& out) {
+        store(out, _mm_div_ps(load(v), _mm_set1_ps(scalar)));
+    }
+    
+    // out row i = sum over k of a[i][k] * b row k
+    inline void multiply(const Rows<float, 4>& a, const Rows<float, 4>& b, Rows<float, 4>& out) {
+        __m128 b0 = load(b[0]), b1 = load(b[1]), b2 = load(b[2]), b3 = load(b[3]);
+        for (size_t i = 0; i < 4; ++i) {
+            __m128 sum = _mm_mul_ps(_mm_set1_ps(a[i][0]), b0);
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(a[i][1]), b1));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(a[i][2]), b2));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(a[i][3]), b3));
+            store(out[i], sum);
+        }
+    }
+    
+    // Three-wide floats fill lanes 0-2 of one register and keep lane 3 zero.
+    // Lanes 0-1 move as one 64-bit load or store and lane 2 on its own, so
+    // nothing past the array is read or written.
+    inline __m128 load(const std::array<float, 3>& v) {
+        __m128 low = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v.data())));
+        return _mm_movelh_ps(low, _mm_load_ss(&v[2]));
+    }
+    inline void store(std::array<float, 3>& v, __m128 r) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(v.data()), _mm_castps_si128(r));
+        _mm_store_ss(&v[2], _mm_movehl_ps(r, r));
+    }
+    
+    inline void divide(const std::array<float, 3>& v, float scalar, std::array<float, 3>& out) {
+        store(out, _mm_div_ps(load(v), _mm_set1_ps(scalar)));
+    }
+    
+    inline float dot(const std::array<float, 3>& a, const std::array<float, 3>& b) {
+        __m128 products = _mm_mul_ps(load(a), load(b));
+        __m128 sum = _mm_add_ss(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1)));
+        return _mm_cvtss_f32(_mm_add_ss(sum, _mm_movehl_ps(products, products)));
+    }
+    
+    // a * (b1, b2, b0) - (a1, a2, a0) * b gives the cross product in lanes
+    // (2, 0, 1), which one more shuffle puts back in order
+    inline void cross(const std::array<float, 3>& a, const std::array<float, 3>& b, std::array<float, 3>& out) {
+        __m128 va = load(a), vb = load(b);
+        __m128 a120 = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 b120 = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 rotated = _mm_sub_ps(_mm_mul_ps(va, b120), _mm_mul_ps(a120, vb));
+        store(out, _mm_shuffle_ps(rotated, rotated, _MM_SHUFFLE(3, 0, 2, 1)));
+    }
+    
+    inline void multiply(const Rows<float, 3>& a, const Rows<float, 3>& b, Rows<float, 3>& out) {
+        __m128 b0 = load(b[0]), b1 = load(b[1]), b2 = load(b[2]);
+        for (size_t i = 0; i < 3; ++i) {
+            __m128 sum = _mm_mul_ps(_mm_set1_ps(a[i][0]), b0);
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(a[i][1]), b1));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(a[i][2]), b2));
+            store(out[i], sum);
+        }
+    }
+    
+    // Columns of m times the broadcast v[j]
+    inline void transform(const Rows<float, 3>& m, const std::array<float, 3>& v, std::array<float, 3>& out) {
+        __m128 sum = _mm_mul_ps(_mm_set_ps(0.0f, m[2][0], m[1][0], m[0][0]), _mm_set1_ps(v[0]));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set_ps(0.0f, m[2][1], m[1][1], m[0][1]), _mm_set1_ps(v[1])));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set_ps(0.0f, m[2][2], m[1][2], m[0][2]), _mm_set1_ps(v[2])));
+        store(out, sum);
+    }
+    
+    // Three-wide doubles: lanes 0 and 1 in one register, lane 2 scalar. Loads
+    // and stores use the same (0, 1) / 2 split, so a result read back by the
+    // next kernel is store-forwarded instead of stalling.
+    inline __m128d loadLow(const std::array<double, 3>& v) { return _mm_loadu_pd(v.data()); }
+    
+    inline void divide(const std::array<double, 3>& v, double scalar, std::array<double, 3>& out) {
+        _mm_storeu_pd(out.data(), _mm_div_pd(loadLow(v), _mm_set1_pd(scalar)));
+        out[2] = v[2] / scalar;
+    }
+    
+    inline double dot(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+        __m128d products = _mm_mul_pd(loadLow(a), loadLow(b));
+        __m128d sum = _mm_add_sd(products, _mm_unpackhi_pd(products, products));
+        return _mm_cvtsd_f64(sum) + a[2] * b[2];
+    }
+    
+    inline void cross(const std::array<double, 3>& a, const std::array<double, 3>& b, std::array<double, 3>& out) {
+        // Lanes 0, 1: (a1, a2) * (b2, b0) - (a2, a0) * (b1, b2)
+        __m128d a01 = loadLow(a), a2 = _mm_load_sd(&a[2]);
+        __m128d b01 = loadLow(b), b2 = _mm_load_sd(&b[2]);
+        __m128d a12 = _mm_shuffle_pd(a01, a2, 1), a20 = _mm_shuffle_pd(a2, a01, 0);
+        __m128d b12 = _mm_shuffle_pd(b01, b2, 1), b20 = _mm_shuffle_pd(b2, b01, 0);
+        double z = a[0] * b[1] - a[1] * b[0];
+        _mm_storeu_pd(out.data(), _mm_sub_pd(_mm_mul_pd(a12, b20), _mm_mul_pd(a20, b12)));
+        out[2] = z;
+    }
+    
+    inline void multiply(const Rows<double, 3>& a, const Rows<double, 3>& b, Rows<double, 3>& out) {
+        __m128d b0 = _mm_loadu_pd(b[0].data()), b1 = _mm_loadu_pd(b[1].data()), b2 = _mm_loadu_pd(b[2].data());
+        for (size_t i = 0; i < 3; ++i) {
+            __m128d sum = _mm_mul_pd(_mm_set1_pd(a[i][0]), b0);
+            sum = _mm_add_pd(sum, _mm_mul_pd(_mm_set1_pd(a[i][1]), b1));
+            sum = _mm_add_pd(sum, _mm_mul_pd(_mm_set1_pd(a[i][2]), b2));
+            double last = a[i][0] * b[0][2] + a[i][1] * b[1][2] + a[i][2] * b[2][2];
+            _mm_storeu_pd(out[i].data(), sum);
+            out[i][2] = last;
+        }
+    }
+    
+    // Rows 0 and 1 share a register: columns of m times the broadcast v[j]
+    inline void transform(const Rows<double, 3>& m, const std::array<double, 3>& v, std::array<double, 3>& out) {
+        __m128d sum = _mm_mul_pd(_mm_set_pd(m[1][0], m[0][0]), _mm_set1_pd(v[0]));
+        sum = _mm_add_pd(sum, _mm_mul_pd(_mm_set_pd(m[1][1], m[0][1]), _mm_set1_pd(v[1])));
+        sum = _mm_add_pd(sum, _mm_mul_pd(_mm_set_pd(m[1][2], m[0][2]), _mm_set1_pd(v[2])));
+        double last = m[2][0] * v[0] + m[2][1] * v[1] + m[2][2] * v[2];
+        _mm_storeu_pd(out.data(), sum);
+        out[2] = last;
+    }
+    
+    inline void divide(const std::array<double, 4>& v, double scalar, std::array<double, 4>& out) {
+        __m128d divisor = _mm_set1_pd(scalar);
+        _mm_storeu_pd(out.data(), _mm_div_pd(_mm_loadu_pd(v.data()), divisor));
+        _mm_storeu_pd(out.data() + 2, _mm_div_pd(_mm_loadu_pd(v.data() + 2), divisor));
+    }
+    
+    // Out of line (MathUtils.cpp): AVX2 when utils_lib is built for it
+    void multiply(const Rows<double, 4>& a, const Rows<double, 4>& b, Rows<double, 4>& out);
+    
+    // Out of line as well: whole arrays are worth the call, and AVX2 is used
+    // whenever utils_lib is built for it
+    void sqrtInPlace(float* values, size_t count);
+    void sqrtInPlace(double* values, size_t count);
+#endif
+    
+} // namespace Simd
+
 // ===== VECTOR MATHEMATICS =====
 
 template<typename T, size_t N>
@@ -153,6 +341,10 @@ public:
     
     Vector operator/(T scalar) const {
         Vector result;
+        if constexpr (Simd::has_kernels<T, N>) {
+            Simd::divide(components_, scalar, result.components_);
+            return result;
+        }
         for (size_t i = 0; i < N; ++i) {
             result[i] = components_[i] / scalar;
         }
@@ -189,6 +381,9 @@ public:
     
     // Vector properties
     T dot(const Vector& other) const {
+        if constexpr (N == 3 && Simd::has_kernels<T, N>) {
+            return Simd::dot(components_, other.components_);
+        }
         T result = T(0);
         for (size_t i = 0; i < N; ++i) {
             result += components_[i] * other[i];
@@ -227,6 +422,11 @@ public:
     // Cross product (3D only)
     Vector cross(const Vector& other) const {
         static_assert(N == 3, "Cross product only defined for 3D vectors");
+        if constexpr (Simd::has_kernels<T, N>) {
+            Vector result;
+            Simd::cross(components_, other.components_, result.components_);
+            return result;
+        }
         return Vector(
             components_[1] * other[2] - components_[2] * other[1],
             components_[2] * other[0] - components_[0] * other[2],
@@ -370,6 +570,10 @@ public:
     template<size_t OtherCols>
     Matrix<T, Rows, OtherCols> operator*(const Matrix<T, Cols, OtherCols>& other) const {
         Matrix<T, Rows, OtherCols> result;
+        if constexpr (Rows == Cols && Cols == OtherCols && Simd::has_kernels<T, Rows>) {
+            Simd::multiply(data_, other.data_, result.data_);
+            return result;
+        }
         for (size_t i = 0; i < Rows; ++i) {
             for (size_t j = 0; j < OtherCols; ++j) {
                 for (size_t k = 0; k < Cols; ++k) {
@@ -383,6 +587,10 @@ public:
     // Matrix-vector multiplication
     Vector<T, Rows> operator*(const Vector<T, Cols>& vec) const {
         Vector<T, Rows> result;
+        if constexpr (Rows == 3 && Cols == 3 && Simd::has_kernels<T, Rows>) {
+            Simd::transform(data_, vec.data(), result.data());
+            return result;
+        }
         for (size_t i = 0; i < Rows; ++i) {
             for (size_t j = 0; j < Cols; ++j) {
                 result[i] += data_[i][j] * vec[j];
@@ -532,6 +740,246 @@ namespace Transform {
     
 } // namespace Transform
 
+// ===== BATCH VECTOR MATHEMATICS =====
+
+// Structure-of-arrays storage for many 3D vectors: x, y and z each live in
+// their own contiguous array, so the bulk operations below compile to
+// straight vector loops instead of one Vector operator call per element.
+template<typename T>
+class Vec3Batch {
+    static_assert(std::is_floating_point_v<T>, "Vec3Batch requires a floating-point type");
+    
+private:
+    std::vector<T> x_;
+    std::vector<T> y_;
+    std::vector<T> z_;
+    
+public:
+    Vec3Batch() = default;
+    
+    explicit Vec3Batch(size_t count) : x_(count, T(0)), y_(count, T(0)), z_(count, T(0)) {}
+    
+    explicit Vec3Batch(const std::vector<Vector<T, 3>>& vectors) {
+        load(vectors);
+    }
+    
+    // Size management
+    size_t size() const { return x_.size(); }
+    bool empty() const { return x_.empty(); }
+    
+    void resize(size_t count) {
+        x_.resize(count, T(0));
+        y_.resize(count, T(0));
+        z_.resize(count, T(0));
+    }
+    
+    void reserve(size_t count) {
+        x_.reserve(count);
+        y_.reserve(count);
+        z_.reserve(count);
+    }
+    
+    void clear() {
+        x_.clear();
+        y_.clear();
+        z_.clear();
+    }
+    
+    // Interop with Vector<T, 3>
+    void push_back(const Vector<T, 3>& v) {
+        x_.push_back(v[0]);
+        y_.push_back(v[1]);
+        z_.push_back(v[2]);
+    }
+    
+    Vector<T, 3> get(size_t index) const {
+        return Vector<T, 3>(x_[index], y_[index], z_[index]);
+    }
+    
+    void set(size_t index, const Vector<T, 3>& v) {
+        x_[index] = v[0];
+        y_[index] = v[1];
+        z_[index] = v[2];
+    }
+    
+    void load(const Vector<T, 3>* vectors, size_t count) {
+        resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            set(i, vectors[i]);
+        }
+    }
+    
+    void load(const std::vector<Vector<T, 3>>& vectors) {
+        load(vectors.data(), vectors.size());
+    }
+    
+    // Writes size() vectors to out
+    void store(Vector<T, 3>* out) const {
+        for (size_t i = 0; i < size(); ++i) {
+            out[i] = get(i);
+        }
+    }
+    
+    void store(std::vector<Vector<T, 3>>& out) const {
+        out.resize(size());
+        store(out.data());
+    }
+    
+    std::vector<Vector<T, 3>> toVectors() const {
+        std::vector<Vector<T, 3>> result;
+        store(result);
+        return result;
+    }
+    
+    // Raw component arrays
+    T* x() { return x_.data(); }
+    T* y() { return y_.data(); }
+    T* z() { return z_.data(); }
+    const T* x() const { return x_.data(); }
+    const T* y() const { return y_.data(); }
+    const T* z() const { return z_.data(); }
+    
+    // Bulk operations
+    
+    // v = m * v for every vector
+    void transform(const Matrix<T, 3, 3>& m) {
+        T* x = x_.data();
+        T* y = y_.data();
+        T* z = z_.data();
+        const T m00 = m[0][0], m01 = m[0][1], m02 = m[0][2];
+        const T m10 = m[1][0], m11 = m[1][1], m12 = m[1][2];
+        const T m20 = m[2][0], m21 = m[2][1], m22 = m[2][2];
+        for (size_t i = 0, n = size(); i < n; ++i) {
+            const T px = x[i], py = y[i], pz = z[i];
+            x[i] = m00 * px + m01 * py + m02 * pz;
+            y[i] = m10 * px + m11 * py + m12 * pz;
+            z[i] = m20 * px + m21 * py + m22 * pz;
+        }
+    }
+    
+    // Transforms every vector as a point (w = 1) by an affine matrix such as
+    // those from Transform::translation3D / rotation3D; the bottom row is ignored
+    void transformPoints(const Matrix<T, 4, 4>& m) {
+        T* x = x_.data();
+        T* y = y_.data();
+        T* z = z_.data();
+        const T m00 = m[0][0], m01 = m[0][1], m02 = m[0][2], m03 = m[0][3];
+        const T m10 = m[1][0], m11 = m[1][1], m12 = m[1][2], m13 = m[1][3];
+        const T m20 = m[2][0], m21 = m[2][1], m22 = m[2][2], m23 = m[2][3];
+        for (size_t i = 0, n = size(); i < n; ++i) {
+            const T px = x[i], py = y[i], pz = z[i];
+            x[i] = m00 * px + m01 * py + m02 * pz + m03;
+            y[i] = m10 * px + m11 * py + m12 * pz + m13;
+            z[i] = m20 * px + m21 * py + m22 * pz + m23;
+        }
+    }
+    
+    // this[i] += other[i] * scale, e.g. positions.addScaled(velocities, dt)
+    void addScaled(const Vec3Batch& other, T scale) {
+        if (other.size() != size()) {
+            throw std::invalid_argument("Vec3Batch sizes must match");
+        }
+        addScaledArray(x_.data(), other.x_.data(), scale);
+        addScaledArray(y_.data(), other.y_.data(), scale);
+        addScaledArray(z_.data(), other.z_.data(), scale);
+    }
+    
+    // this[i] += v * scale
+    void addScaled(const Vector<T, 3>& v, T scale) {
+        addOffset(x_.data(), v[0] * scale);
+        addOffset(y_.data(), v[1] * scale);
+        addOffset(z_.data(), v[2] * scale);
+    }
+    
+    // out[i] = |this[i]|; out must hold size() values
+    void lengths(T* out) const {
+        for (size_t begin = 0, n = size(); begin < n; begin += BlockSize) {
+            const size_t count = std::min(BlockSize, n - begin);
+            lengthsSquared(begin, count, out + begin);
+            Simd::sqrtInPlace(out + begin, count);
+        }
+    }
+    
+    std::vector<T> lengths() const {
+        std::vector<T> result(size());
+        lengths(result.data());
+        return result;
+    }
+    
+    // Same result as Vector::normalize() per element: vectors no longer than
+    // epsilon become zero
+    void normalize() {
+        T len[BlockSize];
+        for (size_t begin = 0, n = size(); begin < n; begin += BlockSize) {
+            const size_t count = std::min(BlockSize, n - begin);
+            lengthsSquared(begin, count, len);
+            Simd::sqrtInPlace(len, count);
+            
+            T* x = x_.data() + begin;
+            T* y = y_.data() + begin;
+            T* z = z_.data() + begin;
+            for (size_t i = 0; i < count; ++i) {
+                const bool keep = len[i] > std::numeric_limits<T>::epsilon();
+                const T nx = x[i] / len[i], ny = y[i] / len[i], nz = z[i] / len[i];
+                x[i] = keep ? nx : T(0);
+                y[i] = keep ? ny : T(0);
+                z[i] = keep ? nz : T(0);
+            }
+        }
+    }
+    
+    // out[i] = distance from this[i] to point; out must hold size() values
+    void distancesTo(const Vector<T, 3>& point, T* out) const {
+        const T* x = x_.data();
+        const T* y = y_.data();
+        const T* z = z_.data();
+        const T px = point[0], py = point[1], pz = point[2];
+        for (size_t begin = 0, n = size(); begin < n; begin += BlockSize) {
+            const size_t end = std::min(begin + BlockSize, n);
+            for (size_t i = begin; i < end; ++i) {
+                const T dx = x[i] - px, dy = y[i] - py, dz = z[i] - pz;
+                out[i] = dx * dx + dy * dy + dz * dz;
+            }
+            Simd::sqrtInPlace(out + begin, end - begin);
+        }
+    }
+    
+    std::vector<T> distancesTo(const Vector<T, 3>& point) const {
+        std::vector<T> result(size());
+        distancesTo(point, result.data());
+        return result;
+    }
+    
+private:
+    // Square roots run as a second pass over blocks small enough to stay in L1
+    static constexpr size_t BlockSize = 256;
+    
+    // out[0, count) = squared lengths of elements [begin, begin + count)
+    void lengthsSquared(size_t begin, size_t count, T* out) const {
+        const T* x = x_.data() + begin;
+        const T* y = y_.data() + begin;
+        const T* z = z_.data() + begin;
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+        }
+    }
+    
+    void addScaledArray(T* target, const T* source, T scale) {
+        for (size_t i = 0, n = size(); i < n; ++i) {
+            target[i] += source[i] * scale;
+        }
+    }
+    
+    void addOffset(T* target, T offset) {
+        for (size_t i = 0, n = size(); i < n; ++i) {
+            target[i] += offset;
+        }
+    }
+};
+
+using Vec3fBatch = Vec3Batch<float>;
+using Vec3dBatch = Vec3Batch<double>;
+
 // ===== INTERPOLATION FUNCTIONS =====
 
 namespace Interpolation {
@@ -592,12 +1040,19 @@ namespace Interpolation {
 
 namespace Noise {
     
+    // Grids are sampled at (x0 + i * dx, y0 + j * dy, z0 + k * dz) and stored
+    // row-major: out[(k * height + j) * width + i]. Each value is bitwise equal
+    // to octaveNoise at that point; rows are evaluated in SIMD-width batches
+    // and split across threads of the shared utility pool (threads = 0 uses all
+    // of them).
+    
     class PerlinNoise {
     private:
         std::array<int, 512> permutation_;
         
         double fade(double t) const { return t * t * t * (t * (t * 6 - 15) + 10); }
         double grad(int hash, double x, double y, double z) const;
+        void noiseBatch(const double* x, const double* y, const double* z, double* out, size_t count) const;
         
     public:
         PerlinNoise(unsigned int seed = 0);
@@ -605,17 +1060,40 @@ namespace Noise {
         double noise(double x, double y, double z = 0.0) const;
         double octaveNoise(double x, double y, double z, int octaves, double persistence) const;
         double turbulence(double x, double y, double z, int octaves) const;
+        
+        // octaveNoise(x, y, 0, octaves, persistence) over a width x height grid
+        void fillGrid(double x0, double y0, double dx, double dy, size_t width, size_t height,
+                      int octaves, double* out, double persistence = 0.5, size_t threads = 0) const;
+        
+        // octaveNoise(x, y, z, octaves, persistence) over a width x height x depth grid
+        void fillGrid(double x0, double y0, double z0, double dx, double dy, double dz,
+                      size_t width, size_t height, size_t depth,
+                      int octaves, double* out, double persistence = 0.5, size_t threads = 0) const;
     };
     
     class SimplexNoise {
     private:
         std::array<int, 512> perm_;
         
+        void noiseBatch(const double* x, const double* y, const double* z, double* out, size_t count) const;
+        void noiseBatch(const double* x, const double* y, double* out, size_t count) const;
+        
     public:
         SimplexNoise(unsigned int seed = 0);
         
         double noise(double x, double y) const;
         double noise(double x, double y, double z) const;
+        
+        // Same octave sum as PerlinNoise::octaveNoise
+        double octaveNoise(double x, double y, int octaves, double persistence) const;
+        double octaveNoise(double x, double y, double z, int octaves, double persistence) const;
+        
+        void fillGrid(double x0, double y0, double dx, double dy, size_t width, size_t height,
+                      int octaves, double* out, double persistence = 0.5, size_t threads = 0) const;
+        
+        void fillGrid(double x0, double y0, double z0, double dx, double dy, double dz,
+                      size_t width, size_t height, size_t depth,
+                      int octaves, double* out, double persistence = 0.5, size_t threads = 0) const;
     };
     
 } // namespace Noise
@@ -625,8 +1103,8 @@ namespace Noise {
 namespace Statistics {
     
     template<typename Container>
-    auto mean(const Container& data) -> decltype(*data.begin()) {
-        using ValueType = decltype(*data.begin());
+    auto mean(const Container& data) -> std::decay_t<decltype(*data.begin())> {
+        using ValueType = std::decay_t<decltype(*data.begin())>;
         if (data.empty()) return ValueType{};
         
         auto sum = std::accumulate(data.begin(), data.end(), ValueType{});
@@ -634,8 +1112,8 @@ namespace Statistics {
     }
     
     template<typename Container>
-    auto variance(const Container& data) -> decltype(*data.begin()) {
-        using ValueType = decltype(*data.begin());
+    auto variance(const Container& data) -> std::decay_t<decltype(*data.begin())> {
+        using ValueType = std::decay_t<decltype(*data.begin())>;
         if (data.size() < 2) return ValueType{};
         
         ValueType mean_val = mean(data);
@@ -650,12 +1128,12 @@ namespace Statistics {
     }
     
     template<typename Container>
-    auto standardDeviation(const Container& data) -> decltype(*data.begin()) {
+    auto standardDeviation(const Container& data) -> std::decay_t<decltype(*data.begin())> {
         return std::sqrt(variance(data));
     }
     
     template<typename Container>
-    auto median(Container data) -> decltype(*data.begin()) {
+    auto median(Container data) -> std::decay_t<decltype(*data.begin())> {
         if (data.empty()) return {};
         
         std::sort(data.begin(), data.end());
@@ -669,8 +1147,8 @@ namespace Statistics {
     }
     
     template<typename Container>
-    auto mode(const Container& data) -> decltype(*data.begin()) {
-        using ValueType = decltype(*data.begin());
+    auto mode(const Container& data) -> std::decay_t<decltype(*data.begin())> {
+        using ValueType = std::decay_t<decltype(*data.begin())>;
         if (data.empty()) return ValueType{};
         
         std::map<ValueType, size_t> frequency;
@@ -732,16 +1210,67 @@ namespace Space {
     
     // N-body gravitational simulation utilities
     class NBodySimulator {
+    public:
+        // Direct sums every pair, O(n^2). BarnesHut groups bodies in an octree
+        // and treats a cell as one point mass when size / distance < theta,
+        // O(n log n); theta = 0 opens every cell and matches Direct up to rounding.
+        enum class ForceMethod { Direct, BarnesHut };
+        
+        // Taylor moves positions to second order and velocities to first from
+        // the acceleration at the start of the step. Leapfrog is kick-drift-kick
+        // (velocity Verlet): symplectic, so energy error stays bounded over
+        // long runs, for the same one force evaluation per step.
+        enum class Integrator { Taylor, Leapfrog };
+        
     private:
-        struct Body {
+        // Cells cover sorted bodies [body_begin, body_end); a cell with no
+        // children is a leaf whose bodies are summed directly
+        struct OctreeNode {
+            Vec3d center;
+            double half_size;
+            Vec3d center_of_mass;
             double mass;
-            Vec3d position;
-            Vec3d velocity;
-            Vec3d acceleration;
+            std::uint32_t first_child;
+            std::uint32_t child_count;
+            std::uint32_t body_begin;
+            std::uint32_t body_end;
         };
         
-        std::vector<Body> bodies_;
+        // Bodies as structure-of-arrays so the force loops vectorize
+        std::vector<double> masses_;
+        Vec3dBatch positions_;
+        Vec3dBatch velocities_;
+        Vec3dBatch accelerations_;
+        bool accelerations_current_ = false;  // accelerations_ match positions_
+        
         double time_step_;
+        ForceMethod force_method_ = ForceMethod::Direct;
+        double theta_ = 0.5;
+        Integrator integrator_ = Integrator::Taylor;
+        size_t thread_count_ = 0;
+        
+        // Barnes-Hut scratch, kept between steps to reuse the allocations.
+        // order_[k] is the body at tree position k; sorted_* hold positions
+        // and G * mass in tree order so leaf sums read contiguous memory.
+        std::vector<OctreeNode> tree_;
+        std::vector<std::uint32_t> order_;
+        Vec3dBatch sorted_positions_;
+        std::vector<double> sorted_gm_;
+        
+        size_t checkedIndex(size_t index) const {
+            if (index >= masses_.size()) {
+                throw std::out_of_range("NBodySimulator body index out of range");
+            }
+            return index;
+        }
+        
+        size_t workerCount() const;
+        void computeAccelerations();
+        void computeDirectAccelerations();
+        void computeBarnesHutAccelerations();
+        void buildOctree();
+        void buildNode(std::uint32_t node_index, std::uint32_t depth);
+        Vec3d treeAcceleration(const Vec3d& position) const;
         
     public:
         NBodySimulator(double dt = 0.01) : time_step_(dt) {}
@@ -750,10 +1279,25 @@ namespace Space {
         void step();
         void simulate(double duration);
         
-        size_t getBodyCount() const { return bodies_.size(); }
-        Vec3d getBodyPosition(size_t index) const { return bodies_.at(index).position; }
-        Vec3d getBodyVelocity(size_t index) const { return bodies_.at(index).velocity; }
-        double getBodyMass(size_t index) const { return bodies_.at(index).mass; }
+        // Throws std::invalid_argument unless theta is finite and >= 0
+        void setForceMethod(ForceMethod method, double theta = 0.5);
+        ForceMethod getForceMethod() const { return force_method_; }
+        double getTheta() const { return theta_; }
+        
+        void setIntegrator(Integrator integrator) { integrator_ = integrator; }
+        Integrator getIntegrator() const { return integrator_; }
+        
+        // Force evaluation threads from the shared utility pool; 0 (the default)
+        // uses all of them. Small systems run on fewer threads than requested.
+        void setThreadCount(size_t threads) { thread_count_ = threads; }
+        size_t getThreadCount() const { return thread_count_; }
+        
+        size_t getBodyCount() const { return masses_.size(); }
+        Vec3d getBodyPosition(size_t index) const { return positions_.get(checkedIndex(index)); }
+        Vec3d getBodyVelocity(size_t index) const { return velocities_.get(checkedIndex(index)); }
+        // Acceleration from the most recent force evaluation
+        Vec3d getBodyAcceleration(size_t index) const { return accelerations_.get(checkedIndex(index)); }
+        double getBodyMass(size_t index) const { return masses_.at(index); }
     };
     
 } // namespace Space
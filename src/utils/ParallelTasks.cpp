@@ -0,0 +1,59 @@
+// File: src/utils/ParallelTasks.cpp
+// Shared worker pool for the data-parallel loops in the utilities module
+
+#include "ParallelTasks.hpp"
+#include "concurrency/ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace CppVerseHub::Utils {
+
+namespace {
+
+// The caller always runs tasks too, so the pool keeps one thread fewer than the hardware has
+Concurrency::WorkStealingThreadPool& sharedPool() {
+    static Concurrency::WorkStealingThreadPool pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+} // namespace
+
+size_t parallelTaskThreads() {
+    return sharedPool().thread_count() + 1;
+}
+
+void runParallelTasks(size_t count, size_t max_threads, const std::function<void(size_t)>& task) {
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    
+    auto worker = [&]() {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            try {
+                task(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(failure_mutex);
+                if (!failure) failure = std::current_exception();
+            }
+        }
+    };
+    
+    size_t threads = std::min({max_threads, count, parallelTaskThreads()});
+    if (threads <= 1) {
+        worker();
+    } else {
+        Concurrency::TaskGroup group(sharedPool());
+        for (size_t t = 1; t < threads; ++t) {
+            group.spawn(worker);
+        }
+        worker();
+        group.sync();
+    }
+    
+    if (failure) std::rethrow_exception(failure);
+}
+
+} // namespace CppVerseHub::Utils
@@ -0,0 +1,22 @@
+// File: src/utils/ParallelTasks.hpp
+// Shared worker pool for the data-parallel loops in the utilities module
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace CppVerseHub::Utils {
+
+// Runs task(0) .. task(count - 1) on up to `max_threads` threads, the caller
+// included, and returns once all of them have finished. The helper threads
+// come from one WorkStealingThreadPool that lives for the whole program, so
+// calling this every frame or simulation step starts no threads. Tasks are
+// handed out one at a time from a shared counter. The first exception a task
+// throws is rethrown after every task has run.
+void runParallelTasks(size_t count, size_t max_threads, const std::function<void(size_t)>& task);
+
+// Threads runParallelTasks() can use at once, the caller included
+size_t parallelTaskThreads();
+
+} // namespace CppVerseHub::Utils
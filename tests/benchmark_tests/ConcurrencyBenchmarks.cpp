@@ -12,6 +12,9 @@
 #include <vector>
 #include <random>
 #include <functional>
+#include <deque>
+#include <optional>
+#include <queue>
 
 // Include concurrency components
 #include "ThreadPool.hpp"
@@ -210,6 +213,135 @@ TEST_CASE_METHOD(ConcurrencyBenchmarkFixture, "Thread Creation and Management Be
     }
 }
 
+TEST_CASE_METHOD(ConcurrencyBenchmarkFixture, "Thread Pool Task Overhead Benchmarks", "[benchmark][concurrency][threadpool]") {
+    
+    SECTION("Task wrapping: packaged_task + shared_ptr + std::function vs PoolTask") {
+        const int taskCount = 100000;
+        const int iterations = 5;
+        
+        // The pre-PoolTask submission path: three heap allocations per task
+        auto legacyTime = benchmarkConcurrency("legacy task wrapping", [&]() {
+            std::queue<std::function<void()>> queue;
+            std::vector<std::future<int>> futures;
+            futures.reserve(taskCount);
+            
+            for (int i = 0; i < taskCount; ++i) {
+                auto task = std::make_shared<std::packaged_task<int()>>(std::bind([](int x) { return x + 1; }, i));
+                futures.push_back(task->get_future());
+                queue.emplace([task]() { (*task)(); });
+            }
+            while (!queue.empty()) {
+                queue.front()();
+                queue.pop();
+            }
+        }, iterations);
+        
+        auto poolTaskTime = benchmarkConcurrency("PoolTask wrapping", [&]() {
+            std::queue<PoolTask> queue;
+            std::vector<std::future<int>> futures;
+            futures.reserve(taskCount);
+            
+            for (int i = 0; i < taskCount; ++i) {
+                auto [task, future] = detail::package_task([](int x) { return x + 1; }, i);
+                futures.push_back(std::move(future));
+                queue.push(std::move(task));
+            }
+            while (!queue.empty()) {
+                queue.front()();
+                queue.pop();
+            }
+        }, iterations);
+        
+        INFO("Task wrapping (" << taskCount << " tasks, single thread):");
+        INFO("Legacy: " << (taskCount / (legacyTime / 1000000.0)) << " tasks/sec");
+        INFO("PoolTask: " << (taskCount / (poolTaskTime / 1000000.0)) << " tasks/sec");
+        INFO("Speedup: " << (legacyTime / poolTaskTime) << "x");
+        
+        REQUIRE(legacyTime > 0);
+        REQUIRE(poolTaskTime > 0);
+    }
+    
+    SECTION("Tiny task throughput per pool") {
+        const int taskCount = 50000;
+        const size_t numThreads = std::max(2u, std::thread::hardware_concurrency());
+        std::atomic<int> executed{0};
+        auto tinyTask = [&executed]() { executed.fetch_add(1, std::memory_order_relaxed); };
+        
+        BasicThreadPool basicPool(numThreads);
+        PriorityThreadPool priorityPool(numThreads);
+        WorkStealingThreadPool stealingPool(numThreads);
+        
+        auto basicTime = benchmarkConcurrency("basic pool", [&]() {
+            std::vector<std::future<void>> futures;
+            futures.reserve(taskCount);
+            for (int i = 0; i < taskCount; ++i) {
+                futures.push_back(basicPool.submit(tinyTask));
+            }
+            for (auto& future : futures) future.wait();
+        }, 3);
+        
+        auto priorityTime = benchmarkConcurrency("priority pool", [&]() {
+            std::vector<std::future<void>> futures;
+            futures.reserve(taskCount);
+            for (int i = 0; i < taskCount; ++i) {
+                futures.push_back(priorityPool.submit(PriorityThreadPool::Priority::NORMAL, tinyTask));
+            }
+            for (auto& future : futures) future.wait();
+        }, 3);
+        
+        auto stealingTime = benchmarkConcurrency("work-stealing pool", [&]() {
+            std::vector<std::future<void>> futures;
+            futures.reserve(taskCount);
+            for (int i = 0; i < taskCount; ++i) {
+                futures.push_back(stealingPool.submit(tinyTask));
+            }
+            for (auto& future : futures) future.wait();
+        }, 3);
+        
+        INFO("Tiny task throughput (" << taskCount << " tasks, " << numThreads << " threads):");
+        INFO("BasicThreadPool: " << (taskCount / (basicTime / 1000000.0)) << " tasks/sec");
+        INFO("PriorityThreadPool: " << (taskCount / (priorityTime / 1000000.0)) << " tasks/sec");
+        INFO("WorkStealingThreadPool: " << (taskCount / (stealingTime / 1000000.0)) << " tasks/sec");
+        
+        REQUIRE(executed.load() == 3 * 3 * taskCount);
+    }
+
+    SECTION("Per-entity submit vs submit_bulk vs parallel_for") {
+        const int entityCount = 50000;
+        const size_t numThreads = std::max(2u, std::thread::hardware_concurrency());
+        std::vector<double> entities(entityCount, 1.0);
+        auto updateEntity = [](double& value) { value = value * 1.0001 + 0.5; };
+        
+        BasicThreadPool pool(numThreads);
+        
+        auto perTaskTime = benchmarkConcurrency("per-entity submit", [&]() {
+            std::vector<std::future<void>> futures;
+            futures.reserve(entityCount);
+            for (auto& entity : entities) {
+                futures.push_back(pool.submit([&entity, &updateEntity]() { updateEntity(entity); }));
+            }
+            for (auto& future : futures) future.wait();
+        }, 3);
+        
+        auto bulkTime = benchmarkConcurrency("submit_bulk", [&]() {
+            pool.submit_bulk(entities, updateEntity).wait();
+        }, 3);
+        
+        auto parallelForTime = benchmarkConcurrency("parallel_for", [&]() {
+            pool.parallel_for<size_t>(0, entities.size(), 256, [&](size_t i) { updateEntity(entities[i]); }).wait();
+        }, 3);
+        
+        INFO("Simulation tick over " << entityCount << " entities (" << numThreads << " threads):");
+        INFO("Per-entity submit: " << perTaskTime << "μs avg");
+        INFO("submit_bulk: " << bulkTime << "μs avg");
+        INFO("parallel_for (grain 256): " << parallelForTime << "μs avg");
+        INFO("Bulk speedup: " << (perTaskTime / bulkTime) << "x");
+        
+        REQUIRE(bulkTime > 0);
+        REQUIRE(parallelForTime > 0);
+    }
+}
+
 TEST_CASE_METHOD(ConcurrencyBenchmarkFixture, "Synchronization Primitive Benchmarks", "[benchmark][concurrency][synchronization]") {
     
     SECTION("Mutex contention benchmark") {
@@ -581,6 +713,163 @@ TEST_CASE_METHOD(ConcurrencyBenchmarkFixture, "Lock-Free Data Structure Benchmar
     }
 }
 
+/**
+ * @brief Mutex-guarded deque matching the WorkerQueue previously used by WorkStealingThreadPool
+ */
+class MutexWorkDeque {
+public:
+    void push(int* item) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        items_.push_back(item);
+    }
+    
+    std::optional<int*> pop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (items_.empty()) return std::nullopt;
+        int* item = items_.back();
+        items_.pop_back();
+        return item;
+    }
+    
+    std::optional<int*> steal() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (items_.empty()) return std::nullopt;
+        int* item = items_.front();
+        items_.pop_front();
+        return item;
+    }
+    
+private:
+    std::deque<int*> items_;
+    std::mutex mutex_;
+};
+
+/**
+ * @brief Owner push/pop with stealing from neighbours, the access pattern of a work-stealing pool
+ * @return Number of items processed (must equal numThreads * itemsPerThread)
+ */
+template<typename Deque>
+long runWorkStealingWorkload(int numThreads, int itemsPerThread) {
+    std::vector<std::unique_ptr<Deque>> deques;
+    for (int t = 0; t < numThreads; ++t) {
+        deques.push_back(std::make_unique<Deque>());
+    }
+    
+    std::vector<int> payload(static_cast<size_t>(numThreads) * itemsPerThread, 1);
+    std::atomic<long> processed{0};
+    const long total = static_cast<long>(payload.size());
+    std::vector<std::thread> threads;
+    
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            Deque& own = *deques[t];
+            long local = 0;
+            
+            // Push in bursts and pop some locally, like recursive task spawning
+            for (int i = 0; i < itemsPerThread; ++i) {
+                own.push(&payload[static_cast<size_t>(t) * itemsPerThread + i]);
+                if (i % 4 == 3) {
+                    if (auto item = own.pop()) local += **item;
+                }
+            }
+            
+            // Drain own deque, then help others until everything is processed
+            while (processed.load(std::memory_order_relaxed) + local < total) {
+                if (auto item = own.pop()) {
+                    local += **item;
+                    continue;
+                }
+                bool stole = false;
+                for (int v = 1; v < numThreads && !stole; ++v) {
+                    if (auto item = deques[(t + v) % numThreads]->steal()) {
+                        local += **item;
+                        stole = true;
+                    }
+                }
+                if (!stole) {
+                    processed.fetch_add(local, std::memory_order_relaxed);
+                    local = 0;
+                    std::this_thread::yield();
+                }
+            }
+            processed.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+    
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return processed.load();
+}
+
+TEST_CASE_METHOD(ConcurrencyBenchmarkFixture, "Work-Stealing Deque Benchmarks", "[benchmark][concurrency][work-stealing]") {
+    
+    SECTION("Chase-Lev deque vs mutex deque scaling") {
+        const int itemsPerThread = 20000;
+        const int iterations = 3;
+        std::vector<int> threadCounts = {1, 2, 4, 8, 16, 32, 64};
+        
+        for (int numThreads : threadCounts) {
+            long chaseLevProcessed = 0;
+            long mutexProcessed = 0;
+            
+            auto chaseLevTime = benchmarkConcurrency("chase-lev deque", [&]() {
+                chaseLevProcessed = runWorkStealingWorkload<ChaseLevDeque<int*>>(numThreads, itemsPerThread);
+            }, iterations);
+            
+            auto mutexTime = benchmarkConcurrency("mutex deque", [&]() {
+                mutexProcessed = runWorkStealingWorkload<MutexWorkDeque>(numThreads, itemsPerThread);
+            }, iterations);
+            
+            INFO("Threads: " << numThreads << " (" << itemsPerThread << " items/thread)");
+            INFO("Chase-Lev deque: " << chaseLevTime << "μs avg");
+            INFO("Mutex deque: " << mutexTime << "μs avg");
+            INFO("Lock-free speedup: " << (mutexTime / chaseLevTime) << "x");
+            
+            REQUIRE(chaseLevProcessed == static_cast<long>(numThreads) * itemsPerThread);
+            REQUIRE(mutexProcessed == static_cast<long>(numThreads) * itemsPerThread);
+        }
+    }
+    
+    SECTION("WorkStealingThreadPool nested submission throughput") {
+        const int outerTasks = 64;
+        const int innerTasks = 256;
+        std::vector<size_t> threadCounts = {1, 2, 4, 8, 16, 32, 64};
+        
+        for (size_t numThreads : threadCounts) {
+            std::atomic<int> executed{0};
+            
+            auto poolTime = benchmarkConcurrency("work-stealing pool", [&]() {
+                WorkStealingThreadPool pool(numThreads);
+                std::vector<std::future<std::vector<std::future<void>>>> outer;
+                
+                for (int i = 0; i < outerTasks; ++i) {
+                    // Inner submissions go to the worker's own lock-free deque; their futures
+                    // are handed back so the timing covers every nested task, including running ones
+                    outer.push_back(pool.submit([&pool, &executed, innerTasks]() {
+                        std::vector<std::future<void>> inner;
+                        inner.reserve(innerTasks);
+                        for (int j = 0; j < innerTasks; ++j) {
+                            inner.push_back(pool.submit([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }));
+                        }
+                        return inner;
+                    }));
+                }
+                
+                for (auto& future : outer) {
+                    for (auto& innerFuture : future.get()) {
+                        innerFuture.wait();
+                    }
+                }
+            }, 1);
+            
+            INFO("Pool threads: " << numThreads << ", " << (outerTasks * innerTasks) << " nested tasks: " << poolTime << "μs");
+            REQUIRE(executed.load() == outerTasks * innerTasks);
+            REQUIRE(poolTime > 0);
+        }
+    }
+}
+
 TEST_CASE_METHOD(ConcurrencyBenchmarkFixture, "Real-World Concurrency Scenarios", "[benchmark][concurrency][real-world]") {
     
     SECTION("Parallel planet processing benchmark") {
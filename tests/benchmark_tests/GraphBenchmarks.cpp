@@ -0,0 +1,830 @@
+// File: tests/benchmark_tests/GraphBenchmarks.cpp
+// Space route graph benchmarks for CppVerseHub showcase
+
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <queue>
+#include <random>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <functional>
+#include <utility>
+#include <filesystem>
+#include <thread>
+
+#include "GraphAlgorithms.hpp"
+
+using namespace CppVerseHub::Algorithms;
+using OptimizationGoal = SpacePathfinder::OptimizationGoal;
+
+namespace {
+
+/**
+ * @brief side x side stations on a jittered 10-unit lattice, each linked to
+ * its right and lower neighbours, plus one long-haul route per 100
+ * stations. Costs follow SpaceGraph's distance-based fuel and time model.
+ */
+SpaceGraph buildStationLattice(size_t side, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> jitter(-3.0, 3.0);
+    std::uniform_real_distribution<double> danger(0.0, 0.3);
+    std::uniform_int_distribution<size_t> anyStation(0, side * side - 1);
+
+    SpaceGraph graph(false);
+    for (size_t row = 0; row < side; ++row) {
+        for (size_t col = 0; col < side; ++col) {
+            graph.add_station("S" + std::to_string(row * side + col),
+                              {static_cast<double>(col) * 10.0 + jitter(gen),
+                               static_cast<double>(row) * 10.0 + jitter(gen), jitter(gen)});
+        }
+    }
+
+    auto link = [&](size_t from, size_t to, const std::string& type) {
+        double distance = graph.get_station(from).get_position().distance_to(graph.get_station(to).get_position());
+        double fuel = distance * 2.5 + std::pow(distance / 100.0, 1.2) * 50.0;
+        graph.add_route(from, to, fuel, distance / 100.0, danger(gen), false, type);
+    };
+    for (size_t row = 0; row < side; ++row) {
+        for (size_t col = 0; col < side; ++col) {
+            size_t station = row * side + col;
+            if (col + 1 < side) link(station, station + 1, "direct");
+            if (row + 1 < side) link(station, station + side, "direct");
+        }
+    }
+    for (size_t i = 0; i < side * side / 100; ++i) {
+        link(anyStation(gen), anyStation(gen), "relay");
+    }
+    return graph;
+}
+
+/**
+ * @brief The previous SpacePathfinder::dijkstra_shortest_path inner loop,
+ * kept as a baseline: it walks SpaceGraph's vector<vector<SpaceRoute>>
+ * adjacency lists directly. Returns the cost of the best path.
+ */
+double adjacencyListDijkstra(const SpaceGraph& graph, size_t start, size_t destination,
+                             const std::function<double(const SpaceRoute&)>& cost) {
+    std::vector<double> distance(graph.station_count(), std::numeric_limits<double>::infinity());
+    std::vector<bool> visited(graph.station_count(), false);
+
+    using PQElement = std::pair<double, size_t>;
+    std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> pq;
+    distance[start] = 0.0;
+    pq.push({0.0, start});
+
+    while (!pq.empty()) {
+        auto [current_dist, current] = pq.top();
+        pq.pop();
+        if (visited[current]) continue;
+        visited[current] = true;
+        if (current == destination) break;
+
+        for (const auto& route : graph.get_routes_from(current)) {
+            double new_dist = current_dist + cost(route);
+            if (new_dist < distance[route.to_station]) {
+                distance[route.to_station] = new_dist;
+                pq.push({new_dist, route.to_station});
+            }
+        }
+    }
+    return distance[destination];
+}
+
+/**
+ * @brief dijkstra_shortest_path before it moved to SearchWorkspace, kept as
+ * a baseline: per-query distance, parent and visited arrays and a
+ * std::priority_queue with duplicate entries, on the same CSR layout.
+ */
+double allocatingDijkstra(const FrozenSpaceGraph& routes, size_t start, size_t destination, OptimizationGoal goal) {
+    std::vector<double> distance(routes.station_count(), std::numeric_limits<double>::infinity());
+    std::vector<size_t> parent(routes.station_count(), SIZE_MAX);
+    std::vector<bool> visited(routes.station_count(), false);
+
+    using PQElement = std::pair<double, size_t>;
+    std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> pq;
+    distance[start] = 0.0;
+    pq.push({0.0, start});
+
+    while (!pq.empty()) {
+        auto [current_dist, current] = pq.top();
+        pq.pop();
+        if (visited[current]) continue;
+        visited[current] = true;
+        if (current == destination) break;
+
+        for (size_t route = routes.route_begin(current); route < routes.route_end(current); ++route) {
+            double new_dist = current_dist + SpacePathfinder::route_cost(routes.fuel_cost(route), routes.time_cost(route),
+                                                                         routes.danger_level(route), goal);
+            if (new_dist < distance[routes.target(route)]) {
+                distance[routes.target(route)] = new_dist;
+                parent[routes.target(route)] = current;
+                pq.push({new_dist, routes.target(route)});
+            }
+        }
+    }
+    return distance[destination];
+}
+
+/**
+ * @brief Hop-count betweenness straight from the definition: per-source BFS
+ * distance and path-count tables, then every (s, v, t) triple. Normalized
+ * like SpaceNetworkAnalysis::calculate_betweenness_centrality.
+ */
+std::vector<double> pairCountingBetweenness(const FrozenSpaceGraph& routes) {
+    const size_t n = routes.station_count();
+    std::vector<std::vector<long>> hops(n, std::vector<long>(n, -1));
+    std::vector<std::vector<double>> paths(n, std::vector<double>(n, 0.0));
+    for (size_t s = 0; s < n; ++s) {
+        std::vector<size_t> queue{s};
+        hops[s][s] = 0;
+        paths[s][s] = 1.0;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            size_t v = queue[head];
+            for (size_t route = routes.route_begin(v); route < routes.route_end(v); ++route) {
+                size_t w = routes.target(route);
+                if (hops[s][w] < 0) {
+                    hops[s][w] = hops[s][v] + 1;
+                    queue.push_back(w);
+                }
+                if (hops[s][w] == hops[s][v] + 1) paths[s][w] += paths[s][v];
+            }
+        }
+    }
+
+    std::vector<double> betweenness(n, 0.0);
+    for (size_t v = 0; v < n; ++v) {
+        for (size_t s = 0; s < n; ++s) {
+            for (size_t t = 0; t < n; ++t) {
+                if (s == v || t == v || s == t || hops[s][v] < 0 || hops[v][t] < 0 || hops[s][t] < 0) continue;
+                if (hops[s][v] + hops[v][t] == hops[s][t]) betweenness[v] += paths[s][v] * paths[v][t] / paths[s][t];
+            }
+        }
+        betweenness[v] /= static_cast<double>(n - 1) * static_cast<double>(n - 2);
+    }
+    return betweenness;
+}
+
+/**
+ * @brief systemsPerSide^2 star systems on a 1000-unit lattice, each holding
+ * stationsPerSystem stations in a ring plus routes to their three nearest
+ * neighbours, with no parallel routes. Two gateway stations per system have relay routes to the
+ * matching gateways of the adjacent systems.
+ */
+SpaceGraph buildStarSystems(size_t systemsPerSide, size_t stationsPerSystem, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> spread(-20.0, 20.0);
+    std::uniform_real_distribution<double> danger(0.0, 0.3);
+
+    SpaceGraph graph(false);
+    for (size_t system = 0; system < systemsPerSide * systemsPerSide; ++system) {
+        double cx = static_cast<double>(system % systemsPerSide) * 1000.0;
+        double cy = static_cast<double>(system / systemsPerSide) * 1000.0;
+        for (size_t i = 0; i < stationsPerSystem; ++i) {
+            graph.add_station("S" + std::to_string(system * stationsPerSystem + i),
+                              {cx + spread(gen), cy + spread(gen), spread(gen)});
+        }
+    }
+
+    auto link = [&](size_t from, size_t to, const std::string& type) {
+        double distance = graph.get_station(from).get_position().distance_to(graph.get_station(to).get_position());
+        double fuel = distance * 2.5 + std::pow(distance / 100.0, 1.2) * 50.0;
+        graph.add_route(from, to, fuel, distance / 100.0, danger(gen), false, type);
+    };
+    for (size_t system = 0; system < systemsPerSide * systemsPerSide; ++system) {
+        const size_t base = system * stationsPerSystem;
+        for (size_t i = 0; i < stationsPerSystem; ++i) {
+            link(base + i, base + (i + 1) % stationsPerSystem, "direct");
+            std::vector<std::pair<double, size_t>> nearest;
+            for (size_t j = 0; j < stationsPerSystem; ++j) {
+                if (j == i) continue;
+                nearest.emplace_back(graph.get_station(base + i).get_position().distance_to(
+                                         graph.get_station(base + j).get_position()), j);
+            }
+            std::partial_sort(nearest.begin(), nearest.begin() + 3, nearest.end());
+            for (size_t k = 0; k < 3; ++k) {
+                size_t j = nearest[k].second;
+                bool onRing = j == i + 1 || (i == 0 && j + 1 == stationsPerSystem);
+                if (j > i && !onRing) link(base + i, base + j, "direct");
+            }
+        }
+        for (size_t gateway = 0; gateway < 2; ++gateway) {
+            if (system % systemsPerSide + 1 < systemsPerSide) {
+                link(base + gateway, base + stationsPerSystem + gateway, "relay");
+            }
+            if (system / systemsPerSide + 1 < systemsPerSide) {
+                link(base + gateway, base + systemsPerSide * stationsPerSystem + gateway, "relay");
+            }
+        }
+    }
+    return graph;
+}
+
+double elapsedMs(std::chrono::high_resolution_clock::time_point begin) {
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+}
+
+} // namespace
+
+TEST_CASE("Space Pathfinder Benchmarks", "[benchmark][algorithms][graph]") {
+
+    SECTION("CSR layout vs adjacency lists on 10^6 stations") {
+        const size_t side = 1000;
+        SpaceGraph graph = buildStationLattice(side, 7);
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        graph.freeze();
+        double freezeTime = elapsedMs(begin);
+        REQUIRE(graph.is_frozen());
+
+        auto layout = graph.frozen();
+        INFO("Stations: " << layout->station_count() << ", routes: " << layout->route_count()
+             << ", freeze(): " << freezeTime << " ms");
+        REQUIRE(layout->station_count() == side * side);
+
+        SpacePathfinder pathfinder(graph);
+        const std::vector<std::pair<size_t, size_t>> queries = {
+            {0, side * side - 1}, {side - 1, side * (side - 1)}, {side * side / 2, 17}};
+
+        double baselineTime = 0.0, dijkstraTime = 0.0, aStarTime = 0.0;
+        for (auto [start, destination] : queries) {
+            begin = std::chrono::high_resolution_clock::now();
+            double expected = adjacencyListDijkstra(graph, start, destination, [](const SpaceRoute& route) {
+                return route.fuel_cost * 0.4 + route.time_cost * 0.4 + route.danger_level * 200.0;
+            });
+            baselineTime += elapsedMs(begin);
+
+            begin = std::chrono::high_resolution_clock::now();
+            PathResult dijkstra = pathfinder.dijkstra_shortest_path(start, destination, OptimizationGoal::BALANCED);
+            dijkstraTime += elapsedMs(begin);
+
+            begin = std::chrono::high_resolution_clock::now();
+            PathResult aStar = pathfinder.a_star_pathfinding(start, destination, OptimizationGoal::BALANCED);
+            aStarTime += elapsedMs(begin);
+
+            REQUIRE(dijkstra.path_found);
+            REQUIRE(aStar.path_found);
+            CHECK(dijkstra.total_cost == Approx(expected).epsilon(1e-9));
+            CHECK(aStar.total_cost == Approx(expected).epsilon(1e-9));
+        }
+
+        INFO("Adjacency-list Dijkstra (previous layout): " << baselineTime / queries.size() << " ms/query");
+        INFO("SpacePathfinder Dijkstra on CSR: " << dijkstraTime / queries.size() << " ms/query");
+        INFO("SpacePathfinder A* on CSR: " << aStarTime / queries.size() << " ms/query");
+        CHECK(dijkstraTime > 0.0);
+    }
+
+    SECTION("Editing a frozen graph drops the layout but not existing snapshots") {
+        SpaceGraph graph = buildStationLattice(20, 11);
+        graph.freeze();
+        auto snapshot = graph.frozen();
+        size_t routes = snapshot->route_count();
+
+        graph.add_route(0, 399, 1.0, 1.0, 0.0, false, "emergency");
+        CHECK_FALSE(graph.is_frozen());
+        CHECK(snapshot->route_count() == routes);
+
+        graph.freeze();
+        auto layout = graph.frozen();
+        CHECK(layout->route_count() == routes + 2);
+        size_t route = layout->find_route(0, 399);
+        REQUIRE(route != FrozenSpaceGraph::npos);
+        CHECK(layout->route_type(route) == RouteType::EMERGENCY);
+        CHECK(layout->find_route(399, 0) != FrozenSpaceGraph::npos);
+    }
+}
+
+TEST_CASE("Contraction Hierarchy Benchmarks", "[benchmark][algorithms][graph][ch]") {
+
+    SECTION("Index queries vs Dijkstra on 10^5 stations, with a save/load round trip") {
+        SpaceGraph graph = buildStarSystems(32, 100, 5);
+        graph.freeze();
+        const size_t stations = graph.station_count();
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        auto hierarchy = std::make_shared<const ContractionHierarchy>(graph, OptimizationGoal::BALANCED);
+        double buildTime = elapsedMs(begin);
+
+        const auto file = std::filesystem::temp_directory_path() / "cppversehub_ch_benchmark.idx";
+        hierarchy->save(file.string());
+        begin = std::chrono::high_resolution_clock::now();
+        auto loaded = std::make_shared<const ContractionHierarchy>(ContractionHierarchy::load(file.string()));
+        double loadTime = elapsedMs(begin);
+        std::filesystem::remove(file);
+
+        INFO("Stations: " << stations << ", routes: " << graph.frozen()->route_count()
+             << ", hierarchy arcs: " << hierarchy->arc_count());
+        INFO("Build: " << buildTime << " ms, load: " << loadTime << " ms");
+        REQUIRE(loaded->station_count() == stations);
+        REQUIRE(loaded->arc_count() == hierarchy->arc_count());
+
+        std::mt19937 gen(9);
+        std::uniform_int_distribution<size_t> anyStation(0, stations - 1);
+        std::vector<std::pair<size_t, size_t>> queries(2000);
+        for (auto& query : queries) query = {anyStation(gen), anyStation(gen)};
+
+        // Dijkstra on a sample; the index must agree with it
+        SpacePathfinder plain(graph);
+        SpacePathfinder indexed(graph);
+        indexed.use_contraction_hierarchy(loaded);
+        double dijkstraTime = 0.0, indexedTime = 0.0;
+        for (size_t i = 0; i < 20; ++i) {
+            auto [start, destination] = queries[i];
+            begin = std::chrono::high_resolution_clock::now();
+            PathResult expected = plain.dijkstra_shortest_path(start, destination, OptimizationGoal::BALANCED);
+            dijkstraTime += elapsedMs(begin);
+            begin = std::chrono::high_resolution_clock::now();
+            PathResult actual = indexed.dijkstra_shortest_path(start, destination, OptimizationGoal::BALANCED);
+            indexedTime += elapsedMs(begin);
+
+            REQUIRE(actual.path_found == expected.path_found);
+            CHECK(actual.total_cost == Approx(expected.total_cost).epsilon(1e-9));
+            CHECK(actual.path.front() == start);
+            CHECK(actual.path.back() == destination);
+            CHECK(hierarchy->distance(start, destination) == Approx(expected.total_cost).epsilon(1e-9));
+        }
+
+        double checksum = 0.0;
+        begin = std::chrono::high_resolution_clock::now();
+        for (auto [start, destination] : queries) checksum += loaded->distance(start, destination);
+        double distanceTime = elapsedMs(begin);
+
+        INFO("Dijkstra: " << dijkstraTime / 20.0 * 1000.0 << " us/query");
+        INFO("dijkstra_shortest_path with index (full PathResult): " << indexedTime / 20.0 * 1000.0 << " us/query");
+        INFO("ContractionHierarchy::distance: " << distanceTime / queries.size() * 1000.0 << " us/query");
+        CHECK(std::isfinite(checksum));
+    }
+
+    SECTION("Every optimization goal agrees with Dijkstra") {
+        SpaceGraph graph = buildStationLattice(30, 21);
+        SpacePathfinder pathfinder(graph);
+        std::mt19937 gen(4);
+        std::uniform_int_distribution<size_t> anyStation(0, graph.station_count() - 1);
+
+        for (auto goal : {OptimizationGoal::MINIMUM_FUEL, OptimizationGoal::MINIMUM_TIME, OptimizationGoal::MAXIMUM_SAFETY,
+                          OptimizationGoal::BALANCED, OptimizationGoal::MINIMUM_HOPS}) {
+            ContractionHierarchy hierarchy(graph, goal);
+            CHECK(hierarchy.goal() == goal);
+            for (int i = 0; i < 25; ++i) {
+                size_t start = anyStation(gen), destination = anyStation(gen);
+                PathResult expected = pathfinder.dijkstra_shortest_path(start, destination, goal);
+                ContractionHierarchy::QueryResult actual = hierarchy.query(start, destination);
+                CHECK(actual.cost == Approx(expected.total_cost).epsilon(1e-9));
+                REQUIRE(!actual.path.empty());
+                CHECK(actual.path.front() == start);
+                CHECK(actual.path.back() == destination);
+            }
+        }
+    }
+
+    SECTION("Corrupt and mismatched index files are rejected") {
+        const auto file = std::filesystem::temp_directory_path() / "cppversehub_ch_corrupt.idx";
+        ContractionHierarchy hierarchy(buildStationLattice(10, 3), OptimizationGoal::MINIMUM_FUEL);
+        hierarchy.save(file.string());
+        std::filesystem::resize_file(file, std::filesystem::file_size(file) / 2);
+        CHECK_THROWS_AS(ContractionHierarchy::load(file.string()), std::runtime_error);
+        std::filesystem::remove(file);
+        CHECK_THROWS_AS(ContractionHierarchy::load(file.string()), std::runtime_error);
+
+        SpaceGraph other = buildStationLattice(11, 3);
+        SpacePathfinder pathfinder(other);
+        CHECK_THROWS_AS(pathfinder.use_contraction_hierarchy(std::make_shared<const ContractionHierarchy>(hierarchy)),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("Search Workspace Benchmarks", "[benchmark][algorithms][graph]") {
+
+    SECTION("Local queries on 10^6 stations: reused workspace vs per-query allocation") {
+        const size_t side = 1000;
+        SpaceGraph graph = buildStationLattice(side, 7);
+        graph.freeze();
+        auto layout = graph.frozen();
+        SpacePathfinder pathfinder(graph);
+
+        // Destinations within 30 rows and columns, as for nearby-station lookups
+        std::mt19937 gen(12);
+        std::uniform_int_distribution<size_t> anyCoordinate(30, side - 31);
+        std::uniform_int_distribution<int> offset(-30, 30);
+        std::vector<std::pair<size_t, size_t>> queries(200);
+        for (auto& [start, destination] : queries) {
+            size_t row = anyCoordinate(gen), col = anyCoordinate(gen);
+            start = row * side + col;
+            destination = static_cast<size_t>(static_cast<int>(row) + offset(gen)) * side +
+                          static_cast<size_t>(static_cast<int>(col) + offset(gen));
+        }
+
+        double baselineTime = 0.0, dijkstraTime = 0.0, aStarTime = 0.0, bidirectionalTime = 0.0;
+        size_t dijkstraSettled = 0, bidirectionalSettled = 0;
+        for (auto [start, destination] : queries) {
+            auto begin = std::chrono::high_resolution_clock::now();
+            double expected = allocatingDijkstra(*layout, start, destination, OptimizationGoal::BALANCED);
+            baselineTime += elapsedMs(begin);
+
+            begin = std::chrono::high_resolution_clock::now();
+            PathResult dijkstra = pathfinder.dijkstra_shortest_path(start, destination, OptimizationGoal::BALANCED);
+            dijkstraTime += elapsedMs(begin);
+            begin = std::chrono::high_resolution_clock::now();
+            PathResult aStar = pathfinder.a_star_pathfinding(start, destination, OptimizationGoal::BALANCED);
+            aStarTime += elapsedMs(begin);
+            begin = std::chrono::high_resolution_clock::now();
+            PathResult bidirectional = pathfinder.bidirectional_search(start, destination, OptimizationGoal::BALANCED);
+            bidirectionalTime += elapsedMs(begin);
+
+            REQUIRE(dijkstra.path_found);
+            REQUIRE(bidirectional.path_found);
+            CHECK(dijkstra.total_cost == Approx(expected).epsilon(1e-9));
+            CHECK(bidirectional.total_cost == Approx(expected).epsilon(1e-9));
+            CHECK(bidirectional.path.front() == start);
+            CHECK(bidirectional.path.back() == destination);
+            CHECK(aStar.path_found);
+            dijkstraSettled += dijkstra.nodes_explored;
+            bidirectionalSettled += bidirectional.nodes_explored;
+        }
+
+        const double count = static_cast<double>(queries.size());
+        INFO("Per-query allocation + std::priority_queue: " << baselineTime / count * 1000.0 << " us/query");
+        INFO("Dijkstra on SearchWorkspace: " << dijkstraTime / count * 1000.0 << " us/query, "
+             << dijkstraSettled / queries.size() << " stations settled");
+        INFO("A* on SearchWorkspace: " << aStarTime / count * 1000.0 << " us/query");
+        INFO("Bidirectional Dijkstra: " << bidirectionalTime / count * 1000.0 << " us/query, "
+             << bidirectionalSettled / queries.size() << " stations settled");
+        CHECK(dijkstraTime < baselineTime);
+    }
+
+    SECTION("Bidirectional search follows one-way routes") {
+        SpaceGraph graph(true);
+        std::mt19937 gen(2);
+        std::uniform_real_distribution<double> cost(1.0, 10.0);
+        const size_t stations = 2000;
+        for (size_t i = 0; i < stations; ++i) {
+            graph.add_station("S" + std::to_string(i), {static_cast<double>(i), 0.0, 0.0});
+        }
+        std::uniform_int_distribution<size_t> anyStation(0, stations - 1);
+        for (size_t i = 0; i < stations * 3; ++i) {
+            graph.add_route(anyStation(gen), anyStation(gen), cost(gen), cost(gen));
+        }
+        SpacePathfinder pathfinder(graph);
+
+        size_t reachable = 0;
+        for (int i = 0; i < 200; ++i) {
+            size_t start = anyStation(gen), destination = anyStation(gen);
+            PathResult expected = pathfinder.dijkstra_shortest_path(start, destination, OptimizationGoal::MINIMUM_FUEL);
+            PathResult actual = pathfinder.bidirectional_search(start, destination, OptimizationGoal::MINIMUM_FUEL);
+            REQUIRE(actual.path_found == expected.path_found);
+            if (!expected.path_found) continue;
+            ++reachable;
+            CHECK(actual.total_cost == Approx(expected.total_cost).epsilon(1e-9));
+            CHECK(actual.path.front() == start);
+            CHECK(actual.path.back() == destination);
+        }
+        CHECK(reachable > 0);
+
+        PathResult self = pathfinder.bidirectional_search(5, 5);
+        CHECK(self.path_found);
+        CHECK(self.path.size() == 1);
+    }
+}
+
+TEST_CASE("Network Analysis Benchmarks", "[benchmark][algorithms][graph]") {
+
+    SECTION("Brandes betweenness matches pair counting") {
+        SpaceGraph lattice = buildStationLattice(8, 3);
+        SpaceGraph oneWay(true);
+        std::mt19937 gen(6);
+        for (size_t i = 0; i < 60; ++i) oneWay.add_station("S" + std::to_string(i), {static_cast<double>(i), 0.0, 0.0});
+        std::uniform_int_distribution<size_t> anyStation(0, 59);
+        for (size_t i = 0; i < 150; ++i) oneWay.add_route(anyStation(gen), anyStation(gen), 1.0, 1.0);
+
+        for (const SpaceGraph* graph : {&lattice, &oneWay}) {
+            SpaceNetworkAnalysis analysis(*graph);
+            std::vector<double> expected = pairCountingBetweenness(*graph->frozen());
+            std::vector<double> actual = analysis.calculate_betweenness_centrality(OptimizationGoal::MINIMUM_HOPS, 3);
+            REQUIRE(actual.size() == expected.size());
+            for (size_t station = 0; station < expected.size(); ++station) {
+                CHECK(actual[station] == Approx(expected[station]).margin(1e-12));
+            }
+        }
+    }
+
+    SECTION("Betweenness and closeness on 4096 stations, 1 vs 4 threads") {
+        SpaceGraph graph = buildStationLattice(64, 11);
+        graph.freeze();
+        SpaceNetworkAnalysis analysis(graph);
+
+        for (auto goal : {OptimizationGoal::MINIMUM_HOPS, OptimizationGoal::BALANCED}) {
+            auto begin = std::chrono::high_resolution_clock::now();
+            std::vector<double> serialBetweenness = analysis.calculate_betweenness_centrality(goal, 1);
+            double serialBetweennessTime = elapsedMs(begin);
+            begin = std::chrono::high_resolution_clock::now();
+            std::vector<double> parallelBetweenness = analysis.calculate_betweenness_centrality(goal, 4);
+            double parallelBetweennessTime = elapsedMs(begin);
+
+            begin = std::chrono::high_resolution_clock::now();
+            std::vector<double> serialCloseness = analysis.calculate_closeness_centrality(goal, 1);
+            double serialClosenessTime = elapsedMs(begin);
+            begin = std::chrono::high_resolution_clock::now();
+            std::vector<double> parallelCloseness = analysis.calculate_closeness_centrality(goal, 4);
+            double parallelClosenessTime = elapsedMs(begin);
+
+            INFO("Goal " << static_cast<int>(goal) << ", hardware threads: " << std::thread::hardware_concurrency());
+            INFO("Betweenness: " << serialBetweennessTime << " ms on 1 thread, " << parallelBetweennessTime << " ms on 4");
+            INFO("Closeness: " << serialClosenessTime << " ms on 1 thread, " << parallelClosenessTime << " ms on 4");
+            for (size_t station = 0; station < graph.station_count(); ++station) {
+                CHECK(parallelBetweenness[station] == Approx(serialBetweenness[station]).margin(1e-12));
+                CHECK(parallelCloseness[station] == serialCloseness[station]);
+            }
+            CHECK(*std::max_element(serialBetweenness.begin(), serialBetweenness.end()) <= 1.0);
+            CHECK(*std::min_element(serialCloseness.begin(), serialCloseness.end()) > 0.0);
+        }
+    }
+
+    SECTION("One-to-many and distance tables vs repeated point-to-point queries") {
+        const size_t side = 250;
+        SpaceGraph graph = buildStationLattice(side, 8);
+        graph.freeze();
+        SpacePathfinder pathfinder(graph);
+
+        std::mt19937 gen(10);
+        std::uniform_int_distribution<size_t> anyStation(0, side * side - 1);
+        std::vector<size_t> sources(8), targets(32);
+        for (auto& station : sources) station = anyStation(gen);
+        for (auto& station : targets) station = anyStation(gen);
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        std::vector<std::vector<double>> expected(sources.size());
+        for (size_t row = 0; row < sources.size(); ++row) {
+            for (size_t target : targets) {
+                expected[row].push_back(pathfinder.dijkstra_shortest_path(sources[row], target).total_cost);
+            }
+        }
+        double pointToPointTime = elapsedMs(begin);
+
+        begin = std::chrono::high_resolution_clock::now();
+        std::vector<PathResult> oneToMany = pathfinder.one_to_many(sources[0], targets);
+        double oneToManyTime = elapsedMs(begin);
+
+        begin = std::chrono::high_resolution_clock::now();
+        std::vector<std::vector<double>> table = pathfinder.distance_table(sources, targets, OptimizationGoal::BALANCED, 4);
+        double tableTime = elapsedMs(begin);
+
+        INFO("8 x 32 dijkstra_shortest_path calls: " << pointToPointTime << " ms");
+        INFO("one_to_many, one source: " << oneToManyTime << " ms");
+        INFO("distance_table, 8 sources on 4 threads: " << tableTime << " ms");
+        REQUIRE(oneToMany.size() == targets.size());
+        for (size_t column = 0; column < targets.size(); ++column) {
+            REQUIRE(oneToMany[column].path_found);
+            CHECK(oneToMany[column].total_cost == Approx(expected[0][column]).epsilon(1e-9));
+            CHECK(oneToMany[column].path.front() == sources[0]);
+            CHECK(oneToMany[column].path.back() == targets[column]);
+        }
+        for (size_t row = 0; row < sources.size(); ++row) {
+            for (size_t column = 0; column < targets.size(); ++column) {
+                CHECK(table[row][column] == Approx(expected[row][column]).epsilon(1e-9));
+            }
+        }
+        CHECK(tableTime < pointToPointTime);
+    }
+}
+
+TEST_CASE("Dynamic Shortest Path Benchmarks", "[benchmark][algorithms][graph]") {
+
+    SECTION("Evacuation tree repairs on 90,000 stations vs full recompute") {
+        const size_t side = 300;
+        const size_t evacuationPoint = side * side / 2 + side / 2;
+        SpaceGraph graph = buildStationLattice(side, 12);
+        graph.freeze();
+        const FrozenSpaceGraph& layout = *graph.frozen();
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        DynamicShortestPaths tree(layout, evacuationPoint, OptimizationGoal::MINIMUM_TIME,
+                                  DynamicShortestPaths::Direction::TO_ROOT);
+        double recomputeTime = elapsedMs(begin);
+        REQUIRE(tree.station_count() == side * side);
+
+        // Independent copy of the network the tree should be tracking
+        auto cost = [](double fuel, double time, double danger) {
+            return SpacePathfinder::route_cost(fuel, time, danger, OptimizationGoal::MINIMUM_TIME);
+        };
+        std::vector<std::vector<std::pair<size_t, double>>> links(side * side);
+        auto findLink = [&links](size_t from, size_t to) {
+            return std::find_if(links[from].begin(), links[from].end(),
+                                [to](const std::pair<size_t, double>& link) { return link.first == to; });
+        };
+        auto setLink = [&](size_t from, size_t to, double linkCost) {
+            auto link = findLink(from, to);
+            if (link == links[from].end()) links[from].push_back({to, linkCost});
+            else link->second = linkCost;
+        };
+        for (size_t station = 0; station < layout.station_count(); ++station) {
+            for (size_t route = layout.route_begin(station); route < layout.route_end(station); ++route) {
+                size_t to = layout.target(route);
+                if (to == station) continue;
+                double linkCost = cost(layout.fuel_cost(route), layout.time_cost(route), layout.danger_level(route));
+                auto link = findLink(station, to);
+                if (link == links[station].end()) links[station].push_back({to, linkCost});
+                else link->second = std::min(link->second, linkCost);
+            }
+        }
+        std::vector<uint8_t> damaged(side * side, 0);
+        auto referenceDistances = [&]() {
+            std::vector<double> distance(side * side, std::numeric_limits<double>::infinity());
+            using PQElement = std::pair<double, size_t>;
+            std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> pq;
+            distance[evacuationPoint] = 0.0;
+            pq.push({0.0, evacuationPoint});
+            while (!pq.empty()) {
+                auto [current_dist, current] = pq.top();
+                pq.pop();
+                if (current_dist > distance[current]) continue;
+                for (auto [to, linkCost] : links[current]) {
+                    if (damaged[to] || current_dist + linkCost >= distance[to]) continue;
+                    distance[to] = current_dist + linkCost;
+                    pq.push({distance[to], to});
+                }
+            }
+            return distance;
+        };
+        auto matchesReference = [&]() {
+            std::vector<double> expected = referenceDistances();
+            size_t mismatches = 0;
+            for (size_t station = 0; station < expected.size(); ++station) {
+                bool reachable = !damaged[station] && expected[station] < std::numeric_limits<double>::max();
+                if (tree.reachable(station) != reachable ||
+                    (reachable && std::abs(tree.distance(station) - expected[station]) > 1e-9 * (1.0 + expected[station]))) {
+                    ++mismatches;
+                }
+            }
+            return mismatches;
+        };
+        REQUIRE(matchesReference() == 0);
+
+        std::mt19937 gen(13);
+        std::uniform_int_distribution<size_t> anyStation(0, side * side - 1);
+        std::uniform_int_distribution<int> anyChange(0, 4);
+        std::vector<size_t> damagedStations;
+        double updateTime = 0.0;
+        size_t updateWork = 0;
+        const size_t updates = 500;
+        for (size_t update = 1; update <= updates; ++update) {
+            size_t station = anyStation(gen);
+            int change = anyChange(gen);
+            begin = std::chrono::high_resolution_clock::now();
+            if (change == 0 && station != evacuationPoint && !damaged[station]) {
+                tree.disable_station(station);
+                damaged[station] = 1;
+                damagedStations.push_back(station);
+            } else if (change == 1 && !damagedStations.empty()) {
+                size_t restored = damagedStations[station % damagedStations.size()];
+                tree.restore_station(restored);
+                damaged[restored] = 0;
+                damagedStations.erase(std::find(damagedStations.begin(), damagedStations.end(), restored));
+            } else if (change == 2 && !links[station].empty()) {
+                // Congestion: a route takes three times as long
+                auto [to, linkCost] = links[station][station % links[station].size()];
+                tree.set_route(station, to, 0.0, linkCost * 3.0, 0.0);
+                setLink(station, to, cost(0.0, linkCost * 3.0, 0.0));
+                setLink(to, station, cost(0.0, linkCost * 3.0, 0.0));
+            } else if (change == 3) {
+                size_t to = anyStation(gen);
+                if (to != station) {
+                    tree.set_route(station, to, 0.0, 0.5, 0.0);
+                    setLink(station, to, cost(0.0, 0.5, 0.0));
+                    setLink(to, station, cost(0.0, 0.5, 0.0));
+                }
+            } else if (!links[station].empty()) {
+                size_t to = links[station][station % links[station].size()].first;
+                tree.remove_route(station, to);
+                links[station].erase(findLink(station, to));
+                links[to].erase(findLink(to, station));
+            }
+            updateTime += elapsedMs(begin);
+            updateWork += tree.last_update_work();
+
+            if (update % 25 == 0) {
+                INFO("After update " << update);
+                REQUIRE(matchesReference() == 0);
+            }
+        }
+
+        size_t sample = anyStation(gen);
+        while (!tree.reachable(sample)) sample = anyStation(gen);
+        std::vector<size_t> route = tree.path(sample);
+        CHECK(route.front() == sample);
+        CHECK(route.back() == evacuationPoint);
+
+        INFO("Full recompute (constructor): " << recomputeTime << " ms");
+        INFO("Incremental update: " << updateTime / updates << " ms, "
+             << static_cast<double>(updateWork) / updates << " stations settled on average");
+        CHECK(updateTime / updates * 10.0 < recomputeTime);
+        CHECK(updateWork / updates * 10 < side * side);
+    }
+
+    SECTION("Emergency evacuation avoids damaged stations") {
+        const size_t side = 60;
+        const size_t evacuationPoint = 0;
+        SpaceGraph graph = buildStationLattice(side, 14);
+        graph.freeze();
+        SpacePathfinder pathfinder(graph);
+        DynamicShortestPaths tree(graph, evacuationPoint, OptimizationGoal::MINIMUM_TIME,
+                                  DynamicShortestPaths::Direction::TO_ROOT);
+
+        std::mt19937 gen(15);
+        std::uniform_int_distribution<size_t> anyStation(1, side * side - 1);
+        std::vector<size_t> damaged;
+        for (size_t i = 0; i < side * side / 10; ++i) {
+            damaged.push_back(anyStation(gen));
+            tree.disable_station(damaged.back());
+        }
+
+        for (size_t i = 0; i < 20; ++i) {
+            size_t start = anyStation(gen);
+            PathResult evacuation = pathfinder.find_emergency_evacuation_path(start, evacuationPoint, damaged);
+            REQUIRE(evacuation.path_found == tree.reachable(start));
+            if (!evacuation.path_found) continue;
+            CHECK(evacuation.total_cost == Approx(tree.distance(start)).epsilon(1e-9));
+            for (size_t station : evacuation.path) {
+                CHECK(std::find(damaged.begin(), damaged.end(), station) == damaged.end());
+            }
+        }
+        CHECK_FALSE(pathfinder.find_emergency_evacuation_path(damaged.front(), evacuationPoint, damaged).path_found);
+    }
+
+    SECTION("Evacuation follows new routes, new stations and damage on the graph") {
+        const size_t side = 200;
+        const size_t evacuationPoint = side * side / 2 + side / 2;
+        SpaceGraph graph = buildStationLattice(side, 16);
+        graph.freeze();
+        SpacePathfinder pathfinder(graph);
+
+        // The first query builds the destination's tree
+        auto begin = std::chrono::high_resolution_clock::now();
+        REQUIRE(pathfinder.find_emergency_evacuation_path(0, evacuationPoint).path_found);
+        double buildTime = elapsedMs(begin);
+
+        std::mt19937 gen(17);
+        std::uniform_int_distribution<int> anyChange(0, 3);
+        auto anyStation = [&gen, &graph]() {
+            return std::uniform_int_distribution<size_t>(0, graph.station_count() - 1)(gen);
+        };
+        std::vector<size_t> reported;  // Passed with each query, not set on the graph
+        double queryTime = 0.0;
+        size_t queryWork = 0;
+        const size_t changes = 200;
+        for (size_t change = 1; change <= changes; ++change) {
+            size_t station = anyStation();
+            switch (anyChange(gen)) {
+                case 0:
+                    if (station != evacuationPoint) {
+                        graph.set_station_damaged(station, !graph.is_station_damaged(station));
+                    }
+                    break;
+                case 1:
+                    graph.add_route(station, anyStation(), 1.0, 0.05, 0.0, false, "emergency");
+                    break;
+                case 2: {
+                    size_t added = graph.add_station("Shelter " + std::to_string(change),
+                                                     graph.get_station(station).get_position());
+                    graph.add_route(added, station, 1.0, 0.01, 0.0);
+                    break;
+                }
+                default:
+                    if (station != evacuationPoint) reported.push_back(station);
+                    if (reported.size() > 20) reported.erase(reported.begin());
+                    break;
+            }
+
+            size_t start = anyStation();
+            begin = std::chrono::high_resolution_clock::now();
+            PathResult evacuation = pathfinder.find_emergency_evacuation_path(start, evacuationPoint, reported);
+            queryTime += elapsedMs(begin);
+            queryWork += evacuation.nodes_explored;
+
+            if (change % 25 == 0) {
+                // Full recompute over the network as it is now
+                DynamicShortestPaths reference(graph, evacuationPoint, OptimizationGoal::MINIMUM_TIME,
+                                               DynamicShortestPaths::Direction::TO_ROOT);
+                for (size_t damaged : reported) reference.disable_station(damaged);
+                REQUIRE(reference.station_count() == graph.station_count());
+                CHECK_FALSE(reference.station_disabled(graph.station_count()));
+
+                INFO("After change " << change);
+                REQUIRE(evacuation.path_found == reference.reachable(start));
+                if (evacuation.path_found) {
+                    CHECK(evacuation.total_cost == Approx(reference.distance(start)).epsilon(1e-9));
+                    for (size_t stop : evacuation.path) {
+                        CHECK_FALSE(graph.is_station_damaged(stop));
+                        CHECK(std::find(reported.begin(), reported.end(), stop) == reported.end());
+                    }
+                }
+            }
+        }
+
+        INFO("First evacuation query (builds the tree): " << buildTime << " ms");
+        INFO("Queries after one change: " << queryTime / changes << " ms, "
+             << static_cast<double>(queryWork) / changes << " stations settled on average");
+        CHECK(queryTime / changes * 10.0 < buildTime);
+    }
+}
@@ -0,0 +1,568 @@
+// File: tests/benchmark_tests/MathBenchmarks.cpp
+// Vector/matrix kernel benchmarks for CppVerseHub showcase
+
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <vector>
+#include <array>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <cstring>
+
+// Include math utilities
+#include "MathUtils.hpp"
+
+using namespace CppVerseHub::Utils::Math;
+
+namespace {
+
+/**
+ * @brief The generic Vector/Matrix loops, kept as a baseline for the SIMD
+ * kernels MathUtils uses for Vec3d, Vec4 division and 3x3/4x4 products.
+ * Sizes without kernels are measured too, as a control.
+ */
+namespace Generic {
+
+template<typename T, size_t N>
+T dot(const Vector<T, N>& a, const Vector<T, N>& b) {
+    T result = T(0);
+    for (size_t i = 0; i < N; ++i) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+template<typename T>
+Vector<T, 3> cross(const Vector<T, 3>& a, const Vector<T, 3>& b) {
+    return Vector<T, 3>(a[1] * b[2] - a[2] * b[1],
+                        a[2] * b[0] - a[0] * b[2],
+                        a[0] * b[1] - a[1] * b[0]);
+}
+
+template<typename T, size_t N>
+Vector<T, N> normalized(const Vector<T, N>& v) {
+    T len = std::sqrt(dot(v, v));
+    Vector<T, N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result[i] = v[i] / len;
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+Matrix<T, N, N> multiply(const Matrix<T, N, N>& a, const Matrix<T, N, N>& b) {
+    Matrix<T, N, N> result;
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            for (size_t k = 0; k < N; ++k) {
+                result[i][j] += a[i][k] * b[k][j];
+            }
+        }
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+Vector<T, N> transform(const Matrix<T, N, N>& m, const Vector<T, N>& v) {
+    Vector<T, N> result;
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            result[i] += m[i][j] * v[j];
+        }
+    }
+    return result;
+}
+
+} // namespace Generic
+
+constexpr size_t ElementCount = 4096;
+constexpr int Passes = 200;
+
+template<typename T, size_t N>
+std::vector<Vector<T, N>> randomVectors(std::mt19937& gen) {
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+    std::vector<Vector<T, N>> vectors(ElementCount);
+    for (auto& v : vectors) {
+        for (size_t i = 0; i < N; ++i) v[i] = static_cast<T>(dist(gen));
+    }
+    return vectors;
+}
+
+template<typename T, size_t N>
+std::vector<Matrix<T, N, N>> randomMatrices(std::mt19937& gen) {
+    std::uniform_real_distribution<double> dist(-2.0, 2.0);
+    std::vector<Matrix<T, N, N>> matrices(ElementCount);
+    for (auto& m : matrices) {
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < N; ++j) m[i][j] = static_cast<T>(dist(gen));
+        }
+    }
+    return matrices;
+}
+
+// Kernels sum in the generic order, but the compiler may contract the
+// generic loops into FMAs, so allow a few ulps of the operand magnitude
+template<typename T>
+bool closeTo(T actual, T expected) {
+    return std::abs(actual - expected) <= std::numeric_limits<T>::epsilon() * 1024;
+}
+
+template<typename T, size_t N>
+bool closeTo(const Vector<T, N>& actual, const Vector<T, N>& expected) {
+    for (size_t i = 0; i < N; ++i) {
+        if (!closeTo(actual[i], expected[i])) return false;
+    }
+    return true;
+}
+
+template<typename T, size_t N>
+bool closeTo(const Matrix<T, N, N>& actual, const Matrix<T, N, N>& expected) {
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            if (!closeTo(actual[i][j], expected[i][j])) return false;
+        }
+    }
+    return true;
+}
+
+template<typename T, size_t N>
+double sum(const Vector<T, N>& v) {
+    double total = 0.0;
+    for (size_t i = 0; i < N; ++i) total += v[i];
+    return total;
+}
+
+template<typename T, size_t N>
+double sum(const Matrix<T, N, N>& m) {
+    double total = 0.0;
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = 0; j < N; ++j) total += m[i][j];
+    }
+    return total;
+}
+
+/**
+ * @brief Runs op over every element Passes times. Returns ns per element;
+ * the sink keeps the results alive.
+ */
+template<typename Op>
+double nanosecondsPerElement(Op op, double& sink) {
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int pass = 0; pass < Passes; ++pass) {
+        for (size_t i = 0; i < ElementCount; ++i) {
+            sink += op(i);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / (double(Passes) * ElementCount);
+}
+
+template<typename T, size_t N>
+void compareVectorKernels(std::mt19937& gen) {
+    auto a = randomVectors<T, N>(gen);
+    auto b = randomVectors<T, N>(gen);
+    double sink = 0.0;
+
+    for (size_t i = 0; i < ElementCount; ++i) {
+        REQUIRE(closeTo(a[i].dot(b[i]), Generic::dot(a[i], b[i])));
+        REQUIRE(closeTo(a[i].normalized(), Generic::normalized(a[i])));
+        if constexpr (N == 3) {
+            REQUIRE(closeTo(a[i].cross(b[i]), Generic::cross(a[i], b[i])));
+        }
+    }
+
+    double genericDot = nanosecondsPerElement([&](size_t i) { return double(Generic::dot(a[i], b[i])); }, sink);
+    double kernelDot = nanosecondsPerElement([&](size_t i) { return double(a[i].dot(b[i])); }, sink);
+    double genericNormalize = nanosecondsPerElement([&](size_t i) { return sum(Generic::normalized(a[i])); }, sink);
+    double kernelNormalize = nanosecondsPerElement([&](size_t i) { return sum(a[i].normalized()); }, sink);
+
+    INFO("Vector<" << (sizeof(T) == 4 ? "float" : "double") << ", " << N << "> kernels "
+         << (Simd::has_kernels<T, N> ? "enabled" : "not available in this build"));
+    INFO("  dot: generic " << genericDot << " ns, kernel " << kernelDot << " ns");
+    INFO("  normalized: generic " << genericNormalize << " ns, kernel " << kernelNormalize << " ns");
+
+    if constexpr (N == 3) {
+        double genericCross = nanosecondsPerElement([&](size_t i) { return sum(Generic::cross(a[i], b[i])); }, sink);
+        double kernelCross = nanosecondsPerElement([&](size_t i) { return sum(a[i].cross(b[i])); }, sink);
+        INFO("  cross: generic " << genericCross << " ns, kernel " << kernelCross << " ns");
+    }
+
+    CHECK(std::isfinite(sink));
+}
+
+template<typename T, size_t N>
+void compareMatrixKernels(std::mt19937& gen) {
+    auto a = randomMatrices<T, N>(gen);
+    auto b = randomMatrices<T, N>(gen);
+    auto v = randomVectors<T, N>(gen);
+    double sink = 0.0;
+
+    for (size_t i = 0; i < ElementCount; ++i) {
+        REQUIRE(closeTo(a[i] * b[i], Generic::multiply(a[i], b[i])));
+        REQUIRE(closeTo(a[i] * v[i], Generic::transform(a[i], v[i])));
+    }
+
+    double genericMultiply = nanosecondsPerElement([&](size_t i) { return sum(Generic::multiply(a[i], b[i])); }, sink);
+    double kernelMultiply = nanosecondsPerElement([&](size_t i) { return sum(a[i] * b[i]); }, sink);
+    double genericTransform = nanosecondsPerElement([&](size_t i) { return sum(Generic::transform(a[i], v[i])); }, sink);
+    double kernelTransform = nanosecondsPerElement([&](size_t i) { return sum(a[i] * v[i]); }, sink);
+
+    INFO("Matrix<" << (sizeof(T) == 4 ? "float" : "double") << ", " << N << ", " << N << "> kernels "
+         << (Simd::has_kernels<T, N> ? "enabled" : "not available in this build"));
+    INFO("  matrix * matrix: generic " << genericMultiply << " ns, kernel " << kernelMultiply << " ns");
+    INFO("  matrix * vector: generic " << genericTransform << " ns, kernel " << kernelTransform << " ns");
+
+    CHECK(std::isfinite(sink));
+}
+
+template<typename Op>
+double millisecondsPerFrame(Op op, int frames) {
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        op();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - begin).count() / frames;
+}
+
+/**
+ * @brief Times each bulk operation as a per-element Vector loop and as one
+ * Vec3Batch call over the same data, and checks that both agree.
+ */
+template<typename T>
+void compareBatchKernels(std::mt19937& gen, size_t count, int frames) {
+    std::uniform_real_distribution<double> dist(-100.0, 100.0);
+    std::vector<Vector<T, 3>> positions(count);
+    std::vector<Vector<T, 3>> velocities(count);
+    for (size_t i = 0; i < count; ++i) {
+        positions[i] = Vector<T, 3>(dist(gen), dist(gen), dist(gen));
+        velocities[i] = Vector<T, 3>(dist(gen), dist(gen), dist(gen));
+    }
+    Matrix<T, 3, 3> rotation;
+    rotation[0] = {T(0.36), T(0.48), T(-0.8)};
+    rotation[1] = {T(-0.8), T(0.6), T(0)};
+    rotation[2] = {T(0.48), T(0.64), T(0.6)};
+    const Vector<T, 3> origin(1, 2, 3);
+    const T dt = T(0.001);
+
+    Vec3Batch<T> batchPositions(positions);
+    Vec3Batch<T> batchVelocities(velocities);
+    std::vector<T> distances(count);
+    std::vector<T> batchDistances(count);
+
+    double vectorAdd = millisecondsPerFrame([&]() {
+        for (size_t i = 0; i < count; ++i) positions[i] += velocities[i] * dt;
+    }, frames);
+    double batchAdd = millisecondsPerFrame([&]() { batchPositions.addScaled(batchVelocities, dt); }, frames);
+
+    double vectorTransform = millisecondsPerFrame([&]() {
+        for (size_t i = 0; i < count; ++i) positions[i] = rotation * positions[i];
+    }, frames);
+    double batchTransform = millisecondsPerFrame([&]() { batchPositions.transform(rotation); }, frames);
+
+    double vectorDistance = millisecondsPerFrame([&]() {
+        for (size_t i = 0; i < count; ++i) distances[i] = positions[i].distanceTo(origin);
+    }, frames);
+    double batchDistance = millisecondsPerFrame([&]() { batchPositions.distancesTo(origin, batchDistances.data()); }, frames);
+
+    for (size_t i = 0; i < count; ++i) {
+        REQUIRE(closeTo(batchPositions.get(i) * T(1e-3), positions[i] * T(1e-3)));
+        REQUIRE(closeTo(batchDistances[i] * T(1e-3), distances[i] * T(1e-3)));
+    }
+
+    std::vector<Vector<T, 3>> directions = positions;
+    Vec3Batch<T> batchDirections = batchPositions;
+    double vectorNormalize = millisecondsPerFrame([&]() {
+        for (size_t i = 0; i < count; ++i) directions[i].normalize();
+    }, frames);
+    double batchNormalize = millisecondsPerFrame([&]() { batchDirections.normalize(); }, frames);
+
+    for (size_t i = 0; i < count; ++i) {
+        REQUIRE(closeTo(batchDirections.get(i), directions[i]));
+    }
+
+    INFO("Vec3Batch<" << (sizeof(T) == 4 ? "float" : "double") << ">, " << count << " vectors (per-element Vector loop vs batch)");
+    INFO("  addScaled: " << vectorAdd << " ms vs " << batchAdd << " ms");
+    INFO("  transform: " << vectorTransform << " ms vs " << batchTransform << " ms");
+    INFO("  distancesTo: " << vectorDistance << " ms vs " << batchDistance << " ms");
+    INFO("  normalize: " << vectorNormalize << " ms vs " << batchNormalize << " ms");
+    CHECK(batchAdd > 0.0);
+}
+
+/**
+ * @brief Fills sim with count stars spread uniformly through a sphere of
+ * 1000 AU, roughly star-cluster scale, with small random velocities.
+ */
+void addCluster(Space::NBodySimulator& sim, size_t count, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::uniform_real_distribution<double> mass(0.1, 10.0);
+    const double radius = 1000.0 * Constants::ASTRONOMICAL_UNIT;
+    for (size_t i = 0; i < count; ++i) {
+        Vec3d p;
+        do {
+            p = Vec3d(unit(gen), unit(gen), unit(gen));
+        } while (p.lengthSquared() > 1.0);
+        Vec3d v(unit(gen), unit(gen), unit(gen));
+        sim.addBody(mass(gen) * Constants::SOLAR_MASS, p * radius, v * 1000.0);
+    }
+}
+
+/**
+ * @brief Runs one step with the given method and returns its wall time in
+ * milliseconds; the accelerations it used stay readable afterwards.
+ */
+double timedStep(Space::NBodySimulator& sim, Space::NBodySimulator::ForceMethod method, double theta) {
+    sim.setForceMethod(method, theta);
+    auto begin = std::chrono::high_resolution_clock::now();
+    sim.step();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+/**
+ * @brief Kinetic plus potential energy, summed directly.
+ */
+double totalEnergy(const Space::NBodySimulator& sim) {
+    double energy = 0.0;
+    for (size_t i = 0; i < sim.getBodyCount(); ++i) {
+        energy += 0.5 * sim.getBodyMass(i) * sim.getBodyVelocity(i).lengthSquared();
+        for (size_t j = i + 1; j < sim.getBodyCount(); ++j) {
+            energy -= Constants::GRAVITATIONAL_CONSTANT * sim.getBodyMass(i) * sim.getBodyMass(j)
+                      / sim.getBodyPosition(i).distanceTo(sim.getBodyPosition(j));
+        }
+    }
+    return energy;
+}
+
+constexpr double NoiseOrigin[3] = {-37.3, 12.9, -3.1};
+constexpr double NoiseStep[3] = {0.013, 0.017, 0.05};
+constexpr int NoiseOctaves = 6;
+
+/**
+ * @brief Times scalar octave(x, y, z) calls against fill(out, threads) over
+ * the same width x height x depth grid and requires the two to match bit for
+ * bit at every thread count. Like the library, this file must be built
+ * without FMA contraction for the reference coordinates to match.
+ */
+template<typename Octave, typename Fill>
+void compareNoiseGrid(const char* name, size_t width, size_t height, size_t depth, Octave octave, Fill fill) {
+    std::vector<double> reference(width * height * depth);
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (size_t k = 0; k < depth; ++k) {
+        for (size_t j = 0; j < height; ++j) {
+            for (size_t i = 0; i < width; ++i) {
+                reference[(k * height + j) * width + i] = octave(NoiseOrigin[0] + static_cast<double>(i) * NoiseStep[0],
+                                                                 NoiseOrigin[1] + static_cast<double>(j) * NoiseStep[1],
+                                                                 NoiseOrigin[2] + static_cast<double>(k) * NoiseStep[2]);
+            }
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double scalarTime = std::chrono::duration<double, std::milli>(end - begin).count();
+    INFO(name << " " << width << "x" << height << "x" << depth << ", scalar octaveNoise: " << scalarTime << " ms");
+
+    const size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t threads = 1; threads <= std::max<size_t>(4, hardwareThreads); threads *= 2) {
+        std::vector<double> grid(reference.size());
+        begin = std::chrono::high_resolution_clock::now();
+        fill(grid.data(), threads);
+        end = std::chrono::high_resolution_clock::now();
+        double gridTime = std::chrono::duration<double, std::milli>(end - begin).count();
+        INFO("fillGrid, " << threads << " threads: " << gridTime << " ms (" << scalarTime / gridTime << "x)");
+        REQUIRE(std::memcmp(grid.data(), reference.data(), grid.size() * sizeof(double)) == 0);
+    }
+}
+} // namespace
+
+TEST_CASE("Math Kernel Benchmarks", "[benchmark][math][simd]") {
+    std::mt19937 gen(42);
+
+    SECTION("Vec3/Vec4 dot, cross and normalize") {
+        compareVectorKernels<float, 3>(gen);
+        compareVectorKernels<float, 4>(gen);
+        compareVectorKernels<double, 3>(gen);
+        compareVectorKernels<double, 4>(gen);
+    }
+
+    SECTION("3x3/4x4 matrix products") {
+        compareMatrixKernels<float, 3>(gen);
+        compareMatrixKernels<float, 4>(gen);
+        compareMatrixKernels<double, 3>(gen);
+        compareMatrixKernels<double, 4>(gen);
+    }
+}
+
+TEST_CASE("Vec3 Batch Benchmarks", "[benchmark][math][batch]") {
+    std::mt19937 gen(7);
+
+    SECTION("Per-element Vector operators vs Vec3Batch kernels") {
+        compareBatchKernels<float>(gen, 4096, 500);
+        compareBatchKernels<double>(gen, 4096, 500);
+        compareBatchKernels<float>(gen, 1000000, 10);
+        compareBatchKernels<double>(gen, 1000000, 10);
+    }
+
+    SECTION("Load/store round trip and lengths") {
+        std::uniform_real_distribution<double> dist(-100.0, 100.0);
+        std::vector<Vec3d> vectors(1000);
+        for (auto& v : vectors) v = Vec3d(dist(gen), dist(gen), dist(gen));
+
+        Vec3dBatch batch(vectors);
+        REQUIRE(batch.size() == vectors.size());
+
+        std::vector<Vec3d> stored = batch.toVectors();
+        std::vector<double> lengths = batch.lengths();
+        for (size_t i = 0; i < vectors.size(); ++i) {
+            REQUIRE(stored[i].data() == vectors[i].data());
+            REQUIRE(closeTo(lengths[i] * 1e-3, vectors[i].length() * 1e-3));
+        }
+
+        Vec3dBatch zeros(3);
+        zeros.normalize();
+        CHECK(zeros.get(1).lengthSquared() == 0.0);
+        CHECK_THROWS_AS(zeros.addScaled(batch, 1.0), std::invalid_argument);
+    }
+}
+
+TEST_CASE("N-Body Force Benchmarks", "[benchmark][math][nbody]") {
+    using ForceMethod = Space::NBodySimulator::ForceMethod;
+
+    SECTION("Barnes-Hut accuracy and speed against direct summation") {
+        for (size_t count : {1000u, 4000u, 12000u}) {
+            Space::NBodySimulator direct(1.0);
+            addCluster(direct, count, 11);
+            double directTime = timedStep(direct, ForceMethod::Direct, 0.0);
+
+            INFO("Bodies: " << count << ", direct: " << directTime << " ms/step");
+            for (double theta : {0.0, 0.3, 0.5, 0.8}) {
+                Space::NBodySimulator tree(1.0);
+                addCluster(tree, count, 11);
+                double treeTime = timedStep(tree, ForceMethod::BarnesHut, theta);
+
+                double meanError = 0.0;
+                double maxError = 0.0;
+                for (size_t i = 0; i < count; ++i) {
+                    Vec3d expected = direct.getBodyAcceleration(i);
+                    double error = (tree.getBodyAcceleration(i) - expected).length() / expected.length();
+                    meanError += error / double(count);
+                    maxError = std::max(maxError, error);
+                }
+                INFO("  theta " << theta << ": " << treeTime << " ms/step, mean relative error "
+                     << meanError << ", max " << maxError);
+
+                if (theta == 0.0) {
+                    CHECK(maxError < 1e-10);
+                } else if (theta <= 0.5) {
+                    CHECK(meanError < 1e-2);
+                }
+            }
+        }
+    }
+
+    SECTION("Barnes-Hut at galaxy-scenario sizes") {
+        for (size_t count : {100000u, 200000u}) {
+            Space::NBodySimulator tree(1.0);
+            addCluster(tree, count, 13);
+            double treeTime = timedStep(tree, ForceMethod::BarnesHut, 0.5);
+            INFO("Bodies: " << count << ", Barnes-Hut theta 0.5: " << treeTime << " ms/step");
+            CHECK(std::isfinite(tree.getBodyAcceleration(count / 2).length()));
+        }
+    }
+
+    SECTION("Force evaluation thread scaling") {
+        const size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        INFO("Hardware threads: " << hardwareThreads);
+        for (auto [method, count] : {std::pair{ForceMethod::Direct, size_t(20000)},
+                                     std::pair{ForceMethod::BarnesHut, size_t(200000)}}) {
+            Space::NBodySimulator reference(1.0);
+            addCluster(reference, count, 17);
+            reference.setThreadCount(1);
+            double serialTime = timedStep(reference, method, 0.5);
+
+            for (size_t threads = 2; threads <= std::max<size_t>(16, hardwareThreads); threads *= 2) {
+                Space::NBodySimulator sim(1.0);
+                addCluster(sim, count, 17);
+                sim.setThreadCount(threads);
+                double parallelTime = timedStep(sim, method, 0.5);
+                INFO((method == ForceMethod::Direct ? "Direct" : "Barnes-Hut") << ", " << count << " bodies, "
+                     << threads << " threads: " << parallelTime << " ms/step (1 thread: " << serialTime
+                     << " ms, speedup " << serialTime / parallelTime << "x)");
+                for (size_t i = 0; i < count; i += 997) {
+                    REQUIRE(sim.getBodyAcceleration(i).data() == reference.getBodyAcceleration(i).data());
+                }
+            }
+        }
+    }
+
+    SECTION("Leapfrog keeps orbital energy bounded") {
+        double taylorDrift = 0.0;
+        double leapfrogDrift = 0.0;
+        for (auto integrator : {Space::NBodySimulator::Integrator::Taylor, Space::NBodySimulator::Integrator::Leapfrog}) {
+            // Sun and Earth, one-day steps for 20 years
+            Space::NBodySimulator sim(86400.0);
+            sim.setIntegrator(integrator);
+            double orbitalSpeed = std::sqrt(Constants::GRAVITATIONAL_CONSTANT * Constants::SOLAR_MASS / Constants::ASTRONOMICAL_UNIT);
+            sim.addBody(Constants::SOLAR_MASS, Vec3d(0, 0, 0), Vec3d(0, 0, 0));
+            sim.addBody(Constants::EARTH_MASS, Vec3d(Constants::ASTRONOMICAL_UNIT, 0, 0), Vec3d(0, orbitalSpeed, 0));
+
+            double initial = totalEnergy(sim);
+            double drift = 0.0;
+            for (int day = 0; day < 20 * 365; ++day) {
+                sim.step();
+                drift = std::max(drift, std::abs((totalEnergy(sim) - initial) / initial));
+            }
+            (integrator == Space::NBodySimulator::Integrator::Leapfrog ? leapfrogDrift : taylorDrift) = drift;
+        }
+        INFO("Max relative energy error over 20 years: Taylor " << taylorDrift << ", Leapfrog " << leapfrogDrift);
+        CHECK(leapfrogDrift < 1e-4);
+        CHECK(leapfrogDrift < taylorDrift);
+    }
+
+    SECTION("Opening angle validation") {
+        Space::NBodySimulator sim;
+        CHECK_THROWS_AS(sim.setForceMethod(ForceMethod::BarnesHut, -0.1), std::invalid_argument);
+        CHECK(sim.getForceMethod() == ForceMethod::Direct);
+    }
+}
+
+TEST_CASE("Noise Grid Benchmarks", "[benchmark][math][noise]") {
+    const double* o = NoiseOrigin;
+    const double* d = NoiseStep;
+
+    SECTION("Perlin fillGrid matches octaveNoise") {
+        Noise::PerlinNoise perlin(42);
+        for (auto [width, height] : {std::pair{size_t(1024), size_t(1024)}, std::pair{size_t(37), size_t(5)}}) {
+            compareNoiseGrid("Perlin 2D", width, height, 1,
+                [&](double x, double y, double) { return perlin.octaveNoise(x, y, 0.0, NoiseOctaves, 0.5); },
+                [&](double* out, size_t threads) {
+                    perlin.fillGrid(o[0], o[1], d[0], d[1], width, height, NoiseOctaves, out, 0.5, threads);
+                });
+        }
+        compareNoiseGrid("Perlin 3D", 256, 256, 16,
+            [&](double x, double y, double z) { return perlin.octaveNoise(x, y, z, NoiseOctaves, 0.5); },
+            [&](double* out, size_t threads) {
+                perlin.fillGrid(o[0], o[1], o[2], d[0], d[1], d[2], 256, 256, 16, NoiseOctaves, out, 0.5, threads);
+            });
+    }
+
+    SECTION("Simplex fillGrid matches octaveNoise") {
+        Noise::SimplexNoise simplex(42);
+        for (auto [width, height] : {std::pair{size_t(1024), size_t(1024)}, std::pair{size_t(37), size_t(5)}}) {
+            compareNoiseGrid("Simplex 2D", width, height, 1,
+                [&](double x, double y, double) { return simplex.octaveNoise(x, y, NoiseOctaves, 0.5); },
+                [&](double* out, size_t threads) {
+                    simplex.fillGrid(o[0], o[1], d[0], d[1], width, height, NoiseOctaves, out, 0.5, threads);
+                });
+        }
+        compareNoiseGrid("Simplex 3D", 256, 256, 16,
+            [&](double x, double y, double z) { return simplex.octaveNoise(x, y, z, NoiseOctaves, 0.5); },
+            [&](double* out, size_t threads) {
+                simplex.fillGrid(o[0], o[1], o[2], d[0], d[1], d[2], 256, 256, 16, NoiseOctaves, out, 0.5, threads);
+            });
+    }
+}
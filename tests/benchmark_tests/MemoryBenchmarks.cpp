@@ -0,0 +1,253 @@
+// File: tests/benchmark_tests/MemoryBenchmarks.cpp
+// Memory pool performance benchmarks for CppVerseHub showcase
+
+#include <catch2/catch.hpp>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <memory_resource>
+#include <functional>
+#include <string>
+
+// Include memory components
+#include "MemoryPools.hpp"
+#include "CustomAllocators.hpp"
+
+using namespace CppVerseHub::Memory;
+
+namespace {
+
+constexpr size_t BenchmarkBlockSize = 64;
+
+/**
+ * @brief The previous ThreadSafeMemoryPool front end, kept as a baseline:
+ * every operation looks its thread cache up in a map under a shared mutex
+ * before touching the cache.
+ */
+class MapCachedPool {
+public:
+    void* allocate() {
+        ThreadCache* cache = get_thread_cache();
+        if (cache->count == 0) {
+            cache->count = global_pool_.allocate_batch(cache->blocks, CacheSize / 2);
+        }
+        return cache->blocks[--cache->count];
+    }
+
+    void deallocate(void* ptr) {
+        ThreadCache* cache = get_thread_cache();
+        if (cache->count < CacheSize) {
+            cache->blocks[cache->count++] = ptr;
+            return;
+        }
+        global_pool_.deallocate(ptr);
+    }
+
+    ~MapCachedPool() {
+        for (auto& [thread_id, cache] : thread_caches_) {
+            global_pool_.deallocate_batch(cache->blocks, cache->count);
+        }
+    }
+
+private:
+    static constexpr size_t CacheSize = 32;
+
+    struct ThreadCache {
+        void* blocks[CacheSize];
+        size_t count = 0;
+    };
+
+    FixedSizePool<BenchmarkBlockSize> global_pool_;
+    std::mutex cache_mutex_;
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadCache>> thread_caches_;
+
+    ThreadCache* get_thread_cache() {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        auto& cache = thread_caches_[std::this_thread::get_id()];
+        if (!cache) {
+            cache = std::make_unique<ThreadCache>();
+        }
+        return cache.get();
+    }
+};
+
+/**
+ * @brief Each thread repeatedly allocates a burst of blocks, writes to them
+ * and frees them in reverse order. Returns elapsed microseconds.
+ */
+template<typename Allocate, typename Deallocate>
+double runAllocationWorkload(size_t numThreads, size_t burstsPerThread,
+                             Allocate allocate, Deallocate deallocate) {
+    constexpr size_t BurstSize = 64;
+    std::atomic<bool> start{false};
+    std::atomic<size_t> checksum{0};
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&]() {
+            void* blocks[BurstSize];
+            size_t local = 0;
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (size_t burst = 0; burst < burstsPerThread; ++burst) {
+                for (size_t i = 0; i < BurstSize; ++i) {
+                    blocks[i] = allocate();
+                    *static_cast<size_t*>(blocks[i]) = i;
+                }
+                for (size_t i = BurstSize; i-- > 0;) {
+                    local += *static_cast<size_t*>(blocks[i]);
+                    deallocate(blocks[i]);
+                }
+            }
+            checksum.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    REQUIRE(checksum.load() == numThreads * burstsPerThread * (BurstSize * (BurstSize - 1) / 2));
+    return std::chrono::duration<double, std::micro>(end - begin).count();
+}
+
+/**
+ * @brief Per-frame pmr::vector and pmr::unordered_map churn on one resource.
+ * Returns elapsed microseconds.
+ */
+double runPmrFrames(std::pmr::memory_resource* resource, size_t frames,
+                    const std::function<void()>& endOfFrame = {}) {
+    constexpr size_t EntriesPerFrame = 256;
+    size_t checksum = 0;
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (size_t frame = 0; frame < frames; ++frame) {
+        {
+            std::pmr::vector<size_t> values(resource);
+            std::pmr::unordered_map<size_t, std::pmr::string> names(resource);
+            for (size_t i = 0; i < EntriesPerFrame; ++i) {
+                values.push_back(i);
+                names.try_emplace(i, 16 + i % 48, 'n');
+            }
+            checksum += values.size() + names.size();
+        }
+        if (endOfFrame) endOfFrame();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    REQUIRE(checksum == frames * 2 * EntriesPerFrame);
+    return std::chrono::duration<double, std::micro>(end - begin).count();
+}
+
+} // namespace
+
+TEST_CASE("Memory Pool Allocation Benchmarks", "[benchmark][memory][pools]") {
+
+    SECTION("Thread-local magazines vs new/delete and mutex-guarded pools") {
+        const size_t totalBursts = 8192;
+
+        for (size_t numThreads : {1u, 2u, 4u, 8u, 16u, 32u}) {
+            const size_t burstsPerThread = std::max<size_t>(1, totalBursts / numThreads);
+            const double operations = 2.0 * 64 * burstsPerThread * numThreads;
+
+            double newDeleteTime = runAllocationWorkload(numThreads, burstsPerThread,
+                []() { return static_cast<void*>(new char[BenchmarkBlockSize]); },
+                [](void* ptr) { delete[] static_cast<char*>(ptr); });
+
+            FixedSizePool<BenchmarkBlockSize> fixedPool;
+            double fixedPoolTime = runAllocationWorkload(numThreads, burstsPerThread,
+                [&]() { return fixedPool.allocate(); },
+                [&](void* ptr) { fixedPool.deallocate(ptr); });
+
+            MapCachedPool mapCachedPool;
+            double mapCachedTime = runAllocationWorkload(numThreads, burstsPerThread,
+                [&]() { return mapCachedPool.allocate(); },
+                [&](void* ptr) { mapCachedPool.deallocate(ptr); });
+
+            ThreadSafeMemoryPool<BenchmarkBlockSize> magazinePool;
+            double magazineTime = runAllocationWorkload(numThreads, burstsPerThread,
+                [&]() { return magazinePool.allocate(); },
+                [&](void* ptr) { magazinePool.deallocate(ptr); });
+
+            INFO("Threads: " << numThreads);
+            INFO("new/delete: " << (newDeleteTime * 1000.0 / operations) << " ns/op");
+            INFO("FixedSizePool (mutex per op): " << (fixedPoolTime * 1000.0 / operations) << " ns/op");
+            INFO("Map-cached pool (previous design): " << (mapCachedTime * 1000.0 / operations) << " ns/op");
+            INFO("ThreadSafeMemoryPool (magazines): " << (magazineTime * 1000.0 / operations) << " ns/op");
+
+            CHECK(magazineTime > 0.0);
+        }
+    }
+
+    SECTION("Blocks freed on a different thread than they were allocated on") {
+        const size_t blocksPerRound = 4096;
+        const int rounds = 50;
+
+        ThreadSafeMemoryPool<BenchmarkBlockSize> pool;
+        std::vector<void*> blocks(blocksPerRound);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int round = 0; round < rounds; ++round) {
+            std::thread producer([&]() {
+                for (auto& block : blocks) {
+                    block = pool.allocate();
+                }
+            });
+            producer.join();
+
+            std::thread consumer([&]() {
+                for (void* block : blocks) {
+                    pool.deallocate(block);
+                }
+            });
+            consumer.join();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double totalTime = std::chrono::duration<double, std::micro>(end - start).count();
+        INFO("Producer/consumer hand-off: " << (totalTime * 1000.0 / (2.0 * blocksPerRound * rounds)) << " ns/op");
+        CHECK(totalTime > 0.0);
+    }
+}
+
+TEST_CASE("PMR Container Benchmarks", "[benchmark][memory][pmr]") {
+
+    SECTION("Per-frame containers on allocator memory resources") {
+        const size_t frames = 2000;
+
+        double newDeleteTime = runPmrFrames(std::pmr::new_delete_resource(), frames);
+
+        std::pmr::unsynchronized_pool_resource poolResource;
+        double poolResourceTime = runPmrFrames(&poolResource, frames);
+
+        MonotonicAllocator<65536> arena;
+        MonotonicAllocatorResource<65536> arenaResource(arena);
+        double arenaTime = runPmrFrames(&arenaResource, frames, [&]() { arenaResource.release(); });
+
+        auto stack = std::make_unique<StackAllocator<65536>>();
+        StackAllocatorResource<65536> stackResource(*stack);
+        double stackTime = runPmrFrames(&stackResource, frames, [&]() { stackResource.release(); });
+
+        SmallObjectAllocator<256, 16384> smallObjects;
+        SmallObjectAllocatorResource<256, 16384> smallObjectResource(smallObjects);
+        double smallObjectTime = runPmrFrames(&smallObjectResource, frames);
+
+        INFO("new_delete_resource: " << (newDeleteTime / frames) << " us/frame");
+        INFO("unsynchronized_pool_resource: " << (poolResourceTime / frames) << " us/frame");
+        INFO("MonotonicAllocatorResource: " << (arenaTime / frames) << " us/frame");
+        INFO("StackAllocatorResource: " << (stackTime / frames) << " us/frame");
+        INFO("SmallObjectAllocatorResource: " << (smallObjectTime / frames) << " us/frame");
+
+        CHECK(arenaResource.statistics().upstream_allocations == 0);
+        CHECK(arenaResource.statistics().bytes_in_use() == 0);
+        CHECK(smallObjectResource.statistics().bytes_in_use() == 0);
+    }
+}
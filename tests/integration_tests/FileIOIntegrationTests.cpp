@@ -11,6 +11,7 @@
 #include <chrono>
 #include <thread>
 #include <atomic>
+#include <limits>
 
 // Include file I/O system components
 #include "FileManager.hpp"
@@ -22,6 +23,7 @@
 #include "Mission.hpp"
 #include "Logger.hpp"
 #include "MemoryTracker.hpp"
+#include "FileParser.hpp"
 
 using namespace CppVerseHub::Core;
 using namespace CppVerseHub::IO;
@@ -541,4 +543,374 @@ TEST_CASE_METHOD(FileIOIntegrationTestFixture, "Concurrent File Operations", "[f
         REQUIRE(verifiedFiles == threadCount * writesPerThread);
         INFO("Concurrent writes verified: " << verifiedFiles);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(FileIOIntegrationTestFixture, "Arena JSON Document", "[file-io][integration][json]") {
+
+    SECTION("Escapes are decoded and unescaped strings point into the source") {
+        const std::string json =
+            R"({"text": "tab\there \"quoted\" back\\slash \/ line\nend",)"
+            R"( "unicode": "caf\u00e9 \ud83d\ude80", "lone": "\ud800!", "plain": "no escapes"})";
+        JsonDocument document = JsonDocument::parse(json);
+        JsonElement root = document.root();
+
+        REQUIRE(root["text"].asString() == "tab\there \"quoted\" back\\slash / line\nend");
+        REQUIRE(root["unicode"].asString() == "caf\xC3\xA9 \xF0\x9F\x9A\x80");
+        REQUIRE(root["lone"].asString() == "\xEF\xBF\xBD!");
+
+        std::string_view plain = root["plain"].asString();
+        REQUIRE(plain == "no escapes");
+        REQUIRE(plain.data() >= json.data());
+        REQUIRE(plain.data() < json.data() + json.size());
+    }
+
+    SECTION("Malformed input is rejected with its position") {
+        const std::vector<std::string> malformed = {
+            "", "   ", "{", "[1, 2", "[1 2]", "{\"a\" 1}", "{\"a\": 1,}", "{1: 2}",
+            "\"unterminated", "\"bad \\x escape\"", "\"\\u12G4\"", "tru", "nul",
+            "-", "[01]", "{\"a\": 1} trailing", "]"
+        };
+        for (const auto& input : malformed) {
+            INFO("input: " << input);
+            REQUIRE_THROWS_AS(JsonDocument::parse(input), JsonParseException);
+        }
+
+        try {
+            JsonDocument::parse("{\n  \"fleet\": ?\n}");
+            FAIL("expected a parse error");
+        } catch (const JsonParseException& e) {
+            REQUIRE(std::string(e.what()).find("line 2, column 12") != std::string::npos);
+        }
+    }
+
+    SECTION("Deep nesting is parsed without recursion") {
+        const size_t depth = 200000;
+        std::string arrays = std::string(depth, '[') + "42" + std::string(depth, ']');
+        JsonDocument document = JsonDocument::parse(arrays);
+        REQUIRE(document.nodeCount() == depth + 1);
+
+        JsonElement element = document.root();
+        for (size_t i = 0; i < depth; ++i) {
+            REQUIRE(element.size() == 1);
+            element = element[size_t{0}];
+        }
+        REQUIRE(element.asInt() == 42);
+
+        std::string objects;
+        for (size_t i = 0; i < 1000; ++i) objects += "{\"child\": ";
+        objects += "null";
+        objects += std::string(1000, '}');
+        JsonDocument nested = JsonDocument::parse(objects);
+        JsonElement leaf = nested.root();
+        for (size_t i = 0; i < 1000; ++i) leaf = leaf["child"];
+        REQUIRE(leaf.isNull());
+
+        REQUIRE_THROWS_AS(JsonDocument::parse(std::string(depth, '[')), JsonParseException);
+    }
+
+    SECTION("Documents parsed from a memory-mapped file") {
+        const std::string filename = testDir + "/arena_document.json";
+        {
+            std::ofstream out(filename);
+            out << "{\n  \"fleets\": [\n";
+            for (int i = 0; i < 500; ++i) {
+                out << "    {\"id\": " << i << ", \"name\": \"Fleet \\\"" << i << "\\\"\", \"active\": "
+                    << (i % 2 ? "true" : "false") << "}" << (i + 1 < 500 ? ",\n" : "\n");
+            }
+            out << "  ]\n}\n";
+        }
+
+        JsonDocument parsed = JsonDocument::parseFromFile(filename);
+        JsonElement fleets = parsed.root()["fleets"];
+        JsonDocument document = std::move(parsed);   // handles survive the move
+
+        REQUIRE(fleets.size() == 500);
+        int index = 0;
+        for (JsonElement fleet : fleets.elements()) {
+            REQUIRE(fleet["id"].asInt() == index);
+            REQUIRE(fleet["name"].asString() == "Fleet \"" + std::to_string(index) + "\"");
+            REQUIRE(fleet["active"].asBool() == (index % 2 == 1));
+            ++index;
+        }
+        REQUIRE(document.source().size() == fs::file_size(filename));
+
+        MappedFile mapped(filename);
+#if defined(__unix__) || defined(__APPLE__)
+        REQUIRE(mapped.isMapped());
+#endif
+        REQUIRE(mapped.view() == document.source());
+
+        std::ofstream(testDir + "/empty.json").close();
+        REQUIRE_THROWS_AS(JsonDocument::parseFromFile(testDir + "/empty.json"), JsonParseException);
+        REQUIRE_THROWS_AS(JsonDocument::parseFromFile(testDir + "/missing.json"), FileNotFoundException);
+    }
+}
+
+TEST_CASE_METHOD(FileIOIntegrationTestFixture, "Streaming JSON Reader", "[file-io][integration][json][streaming]") {
+
+    using Event = JsonReader::Event;
+
+    SECTION("The pull cursor reports every event in document order") {
+        const std::string json = R"({"name": "Vega", "ships": [1, 2.5, true, null, "x\ny"], "empty": {}})";
+        JsonReader reader(json);
+
+        REQUIRE(reader.next() == Event::StartObject);
+        REQUIRE(reader.depth() == 1);
+        REQUIRE(reader.next() == Event::Key);
+        REQUIRE(reader.stringValue() == "name");
+        REQUIRE(reader.next() == Event::String);
+        REQUIRE(reader.stringValue() == "Vega");
+        REQUIRE(reader.next() == Event::Key);
+        REQUIRE(reader.next() == Event::StartArray);
+        REQUIRE(reader.depth() == 2);
+        REQUIRE(reader.next() == Event::Number);
+        REQUIRE(reader.numberValue() == 1.0);
+        REQUIRE(reader.next() == Event::Number);
+        REQUIRE(reader.numberValue() == 2.5);
+        REQUIRE(reader.next() == Event::Boolean);
+        REQUIRE(reader.boolValue());
+        REQUIRE(reader.next() == Event::Null);
+        REQUIRE_THROWS_AS(reader.stringValue(), std::logic_error);
+        REQUIRE(reader.next() == Event::String);
+        REQUIRE(reader.stringValue() == "x\ny");
+        REQUIRE(reader.next() == Event::EndArray);
+        REQUIRE(reader.next() == Event::Key);
+        REQUIRE(reader.stringValue() == "empty");
+        REQUIRE(reader.next() == Event::StartObject);
+        REQUIRE(reader.next() == Event::EndObject);
+        REQUIRE(reader.next() == Event::EndObject);
+        REQUIRE(reader.depth() == 0);
+        REQUIRE(reader.next() == Event::EndOfDocument);
+        REQUIRE(reader.next() == Event::EndOfDocument);
+        REQUIRE(reader.offset() == json.size());
+    }
+
+    SECTION("skipValue steps over whole subtrees") {
+        JsonReader reader(R"({"skip": {"a": [1, {"b": [[]]}], "c": "}"}, "also": 7, "keep": "found"})");
+        REQUIRE(reader.next() == Event::StartObject);
+        std::string kept;
+        while (reader.next() == Event::Key) {
+            if (reader.stringValue() == "keep") {
+                REQUIRE(reader.next() == Event::String);
+                kept = std::string(reader.stringValue());
+            } else {
+                reader.skipValue();
+                REQUIRE(reader.depth() == 1);
+            }
+        }
+        REQUIRE(reader.event() == Event::EndObject);
+        REQUIRE(kept == "found");
+
+        JsonReader array("[[1, [2]], {\"x\": 3}, 4]");
+        REQUIRE(array.next() == Event::StartArray);
+        REQUIRE(array.nextElement());
+        array.skipValue();
+        REQUIRE(array.nextElement());
+        array.skipValue();
+        REQUIRE(array.nextElement());
+        REQUIRE(array.next() == Event::Number);
+        REQUIRE(array.numberValue() == 4.0);
+        REQUIRE_FALSE(array.nextElement());
+        REQUIRE(array.next() == Event::EndOfDocument);
+    }
+
+    SECTION("Elements are materialised one at a time and errors surface mid-stream") {
+        JsonReader reader(R"([{"id": 1, "tags": ["a"]}, {"id": 2, "tags": []}, {"id": 3, "tags": ["b", "c"]}])");
+        REQUIRE(reader.next() == Event::StartArray);
+        JsonDocument element;
+        std::vector<int> ids;
+        size_t tags = 0;
+        while (reader.nextElement()) {
+            reader.readDocument(element);
+            ids.push_back(element.root()["id"].asInt());
+            tags += element.root()["tags"].size();
+        }
+        REQUIRE(ids == std::vector<int>{1, 2, 3});
+        REQUIRE(tags == 3);
+
+        JsonReader misuse("{\"a\": 1}");
+        REQUIRE(misuse.next() == Event::StartObject);
+        REQUIRE_THROWS_AS(misuse.nextElement(), std::logic_error);
+
+        JsonReader broken("[1, 2 3]");
+        REQUIRE(broken.next() == Event::StartArray);
+        REQUIRE(broken.next() == Event::Number);
+        REQUIRE(broken.next() == Event::Number);
+        REQUIRE_THROWS_AS(broken.next(), JsonParseException);
+
+        JsonReader trailing("[1] x");
+        REQUIRE(trailing.next() == Event::StartArray);
+        REQUIRE(trailing.next() == Event::Number);
+        REQUIRE(trailing.next() == Event::EndArray);
+        REQUIRE_THROWS_AS(trailing.next(), JsonParseException);
+    }
+
+    SECTION("Released pages of a mapped file stay readable") {
+        const std::string filename = testDir + "/release.json";
+        std::string content = "[";
+        for (int i = 0; i < 100000; ++i) {
+            content += (i ? ", " : "") + std::to_string(i);
+        }
+        content += "]";
+        std::ofstream(filename) << content;
+
+        MappedFile file(filename);
+        file.releaseBefore(content.size() / 2);
+        file.releaseBefore(0);
+        file.releaseBefore(content.size() * 2);
+        REQUIRE(file.view() == content);
+
+        JsonReader reader = JsonReader::fromFile(filename);
+        REQUIRE(reader.next() == Event::StartArray);
+        double sum = 0;
+        while (reader.next() == Event::Number) {
+            sum += reader.numberValue();
+        }
+        REQUIRE(sum == 99999.0 * 100000.0 / 2.0);
+    }
+
+    SECTION("Fleet and mission records stream from top-level arrays or named members") {
+        const std::string fleetFile = testDir + "/fleets_stream.json";
+        std::ofstream(fleetFile) << R"({"meta": {"fleets": 2, "note": [1, 2]}, "fleets": [
+            {"fleet_id": 1, "commander": "Adama", "ship_count": 12, "fuel_level": 80.5,
+             "mission_type": "Patrol", "current_location": "Caprica"},
+            {"fleet_id": 2, "commander": "Cain", "ship_count": 3, "fuel_level": 15,
+             "mission_type": "Escort", "current_location": "Picon"}]})";
+
+        std::vector<SpaceGameParsers::FleetData> fleets;
+        size_t count = SpaceGameParsers::FleetDataParser::forEachFleetInJson(
+            fleetFile, [&](const SpaceGameParsers::FleetData& fleet) { fleets.push_back(fleet); });
+        REQUIRE(count == 2);
+        REQUIRE(fleets[0].commander == "Adama");
+        REQUIRE(fleets[0].fuel_level == 80.5);
+        REQUIRE(fleets[1].ship_count == 3);
+        REQUIRE(fleets[1].current_location == "Picon");
+
+        const std::string missionFile = testDir + "/missions_stream.json";
+        std::ofstream(missionFile) << R"([
+            {"mission_id": 7, "type": "Exploration", "priority": 3, "title": "Survey",
+             "objectives": ["Scan", "Report"], "parameters": {"sector": "7G", "probes": 4}},
+            {"mission_id": 8}])";
+        auto missions = SpaceGameParsers::MissionConfigParser::parseFromJson(missionFile);
+        REQUIRE(missions.size() == 2);
+        REQUIRE(missions[0].objectives == std::vector<std::string>{"Scan", "Report"});
+        REQUIRE(missions[0].parameters.at("sector") == "7G");
+        REQUIRE(missions[0].parameters.at("probes") == "4");
+        REQUIRE(missions[1].type == "Unknown");
+        REQUIRE(missions[1].priority == 1);
+
+        const std::string invalidFile = testDir + "/fleets_invalid.json";
+        std::ofstream(invalidFile) << R"([{"fleet_id": 1, "commander": "A", "ship_count": 1, "fuel_level": 1,
+            "mission_type": "M", "current_location": "L"}, {"fleet_id": 2}])";
+        try {
+            SpaceGameParsers::FleetDataParser::parseFromJson(invalidFile);
+            FAIL("expected an invalid fleet");
+        } catch (const ParseException& e) {
+            REQUIRE(std::string(e.what()).find("Invalid fleet at index 1") != std::string::npos);
+        }
+
+        std::ofstream(invalidFile) << R"({"fleets": {"fleet_id": 1}})";
+        REQUIRE_THROWS_AS(SpaceGameParsers::FleetDataParser::parseFromJson(invalidFile), ParseException);
+    }
+}
+
+TEST_CASE_METHOD(FileIOIntegrationTestFixture, "Columnar CSV Table", "[file-io][integration][csv]") {
+
+    SECTION("Quoted fields that cross chunk boundaries are kept whole") {
+        // Several megabytes so that the parallel parse cuts the input into
+        // chunks; most bytes sit inside quoted, multi-line notes fields
+        const std::string filename = testDir + "/chunked.csv";
+        const int rows = 40000;
+        auto notes = [](int i) {
+            return "line one of " + std::to_string(i) + "\nline two, with \"quotes\", commas\n" +
+                   std::string(static_cast<size_t>(40 + i % 50), 'n');
+        };
+        {
+            std::ofstream out(filename);
+            out << "id,name,notes,fuel\n";
+            for (int i = 0; i < rows; ++i) {
+                std::string quoted = notes(i);
+                std::string escaped;
+                for (char c : quoted) {
+                    escaped += c;
+                    if (c == '"') escaped += '"';
+                }
+                out << i << ",ship-" << i << ",\"" << escaped << "\",";
+                if (i == 30000) out << "12.5";
+                else if (i % 1000 == 7) out << "";
+                else if (i == 20001) out << "unknown";
+                else out << i % 100;
+                out << "\n";
+            }
+        }
+
+        CsvReadOptions parallel;
+        parallel.threads = 4;
+        CsvTable table = CsvTable::parseFromFile(filename, parallel);
+        CsvReadOptions serial;
+        serial.threads = 1;
+        CsvTable reference = CsvTable::parseFromFile(filename, serial);
+
+        REQUIRE(table.rowCount() == static_cast<size_t>(rows));
+        REQUIRE(table.columnCount() == 4);
+        REQUIRE(table.column("id").type() == CsvColumn::Type::Integer);
+        REQUIRE(table.column("notes").type() == CsvColumn::Type::String);
+        // Inferred as integers from the sample, widened by the 12.5 further down
+        REQUIRE(table.column("fuel").type() == CsvColumn::Type::Double);
+        REQUIRE(table.conversionErrors() == 1);
+        REQUIRE(table.column("fuel").nullCount() == static_cast<size_t>(rows / 1000 + 1));
+
+        bool matches = true;
+        for (int i = 0; i < rows; ++i) {
+            auto row = static_cast<size_t>(i);
+            matches = matches && table.column("id").integers()[row] == i &&
+                      table.column("notes").stringAt(row) == notes(i) &&
+                      table.column("notes").stringAt(row) == reference.column("notes").stringAt(row) &&
+                      table.column("fuel").isNull(row) == reference.column("fuel").isNull(row);
+        }
+        REQUIRE(matches);
+        REQUIRE(table.row(30000).get<double>("fuel") == 12.5);
+        REQUIRE(table.row(99).get<int>("fuel") == 99);
+    }
+
+    SECTION("Typed columns convert on access") {
+        CsvReadOptions options;
+        options.column_types = {{"code", CsvColumn::Type::String}};
+        CsvTable table = CsvTable::parseFromString(
+            "code,count,ratio,label\n"
+            "007,3,0.5,\"alpha, beta\"\n"
+            "010,,1.25,\"\"\n"
+            "042,-9223372036854775808,-2,plain\n", options);
+
+        REQUIRE(table.rowCount() == 3);
+        const CsvColumn& code = table.column("code");
+        REQUIRE(code.type() == CsvColumn::Type::String);
+        REQUIRE(code.get<std::string>(0) == "007");
+        REQUIRE_THROWS_AS(code.get<int>(0), std::runtime_error);
+        REQUIRE_THROWS_AS(code.integers(), std::runtime_error);
+
+        const CsvColumn& count = table.column("count");
+        REQUIRE(count.type() == CsvColumn::Type::Integer);
+        REQUIRE(count.get<int64_t>(0) == 3);
+        REQUIRE(count.get<double>(0) == 3.0);
+        REQUIRE_FALSE(count.get<int>(1).has_value());
+        REQUIRE(count.get<int64_t>(2) == std::numeric_limits<int64_t>::min());
+        REQUIRE_THROWS_AS(count.stringAt(0), std::runtime_error);
+
+        const CsvColumn& ratio = table.column("ratio");
+        REQUIRE(ratio.type() == CsvColumn::Type::Double);
+        REQUIRE(ratio.get<int>(1) == 1);
+        REQUIRE(ratio.doubles()[2] == -2.0);
+
+        // A quoted empty string is a value, an unquoted one would be null
+        const CsvColumn& label = table.column("label");
+        REQUIRE(label.get<std::string_view>(0) == "alpha, beta");
+        REQUIRE(label.get<std::string>(1) == "");
+        REQUIRE_FALSE(label.isNull(1));
+
+        REQUIRE(table.row(2).get<std::string>("label") == "plain");
+        REQUIRE_THROWS_AS(table.column("missing"), std::out_of_range);
+        REQUIRE_THROWS_AS(table.row(3), std::out_of_range);
+    }
+}
+
@@ -0,0 +1,897 @@
+// File: tests/unit_tests/algorithm_tests/GraphAlgorithmsTests.cpp
+// Space route graph and pathfinding tests for CppVerseHub algorithms showcase
+
+#include <catch2/catch.hpp>
+#include <vector>
+#include <queue>
+#include <set>
+#include <map>
+#include <random>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <memory>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "GraphAlgorithms.hpp"
+
+using namespace CppVerseHub::Algorithms;
+using OptimizationGoal = SpacePathfinder::OptimizationGoal;
+
+namespace {
+
+const std::vector<OptimizationGoal> AllGoals = {
+    OptimizationGoal::MINIMUM_FUEL,
+    OptimizationGoal::MINIMUM_TIME,
+    OptimizationGoal::MAXIMUM_SAFETY,
+    OptimizationGoal::BALANCED,
+    OptimizationGoal::MINIMUM_HOPS
+};
+
+/**
+ * @brief clusters star clusters of stationsPerCluster stations scattered in
+ * 3D. Each station is routed to its three nearest neighbours in its
+ * cluster, and random gateway pairs join the clusters with relay routes. A
+ * directed galaxy adds the return leg of about half the routes. The last
+ * station gets no routes, so some queries are unreachable.
+ *
+ * Costs follow SpaceGraph's fuel and time model plus a random danger level.
+ * No two routes join the same ordered pair of stations, and the jitter
+ * keeps shortest paths unique under every goal except MINIMUM_HOPS.
+ */
+SpaceGraph buildGalaxy(size_t clusters, size_t stationsPerCluster, bool directed, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> spread(-60.0, 60.0);
+    std::uniform_real_distribution<double> danger(0.0, 0.3);
+    std::uniform_int_distribution<size_t> member(0, stationsPerCluster - 1);
+    std::bernoulli_distribution returnLeg(0.5);
+
+    SpaceGraph graph(directed);
+    for (size_t cluster = 0; cluster < clusters; ++cluster) {
+        const double cx = static_cast<double>(cluster % 4) * 400.0;
+        const double cy = static_cast<double>(cluster / 4) * 400.0;
+        for (size_t i = 0; i < stationsPerCluster; ++i) {
+            graph.add_station("S" + std::to_string(cluster * stationsPerCluster + i),
+                              {cx + spread(gen), cy + spread(gen), spread(gen)});
+        }
+    }
+    graph.add_station("Isolated", {-5000.0, -5000.0, -5000.0});
+
+    std::set<std::pair<size_t, size_t>> linked;
+    auto link = [&](size_t from, size_t to, const std::string& type) {
+        if (from == to || linked.count({from, to}) || (!directed && linked.count({to, from}))) return;
+        linked.insert({from, to});
+        double distance = graph.get_station(from).get_position().distance_to(graph.get_station(to).get_position());
+        double fuel = distance * 2.5 + std::pow(distance / 100.0, 1.2) * 50.0;
+        graph.add_route(from, to, fuel, distance / 100.0, danger(gen), false, type);
+    };
+
+    for (size_t cluster = 0; cluster < clusters; ++cluster) {
+        const size_t base = cluster * stationsPerCluster;
+        for (size_t i = 0; i < stationsPerCluster; ++i) {
+            std::vector<std::pair<double, size_t>> nearest;
+            for (size_t j = 0; j < stationsPerCluster; ++j) {
+                if (i == j) continue;
+                nearest.push_back({graph.get_station(base + i).get_position().distance_to(
+                                       graph.get_station(base + j).get_position()), base + j});
+            }
+            std::sort(nearest.begin(), nearest.end());
+            for (size_t k = 0; k < 3 && k < nearest.size(); ++k) {
+                link(base + i, nearest[k].second, "direct");
+                if (directed && returnLeg(gen)) link(nearest[k].second, base + i, "direct");
+            }
+        }
+    }
+    for (size_t cluster = 0; cluster + 1 < clusters; ++cluster) {
+        for (size_t gateway = 0; gateway < 3; ++gateway) {
+            const size_t from = cluster * stationsPerCluster + member(gen);
+            const size_t to = (cluster + 1) * stationsPerCluster + member(gen);
+            link(from, to, "relay");
+            link(to, from, "relay");
+        }
+    }
+    return graph;
+}
+
+/**
+ * @struct ReferenceSearch
+ * @brief Distances and parents from one full single-source search
+ */
+struct ReferenceSearch {
+    std::vector<double> distance;
+    std::vector<size_t> parent;
+};
+
+/**
+ * @brief The adjacency-list Dijkstra SpacePathfinder ran before the CSR
+ * layout: it walks SpaceGraph's vector<vector<SpaceRoute>> routes with a
+ * std::priority_queue holding duplicate entries, and settles everything
+ * reachable from start.
+ */
+ReferenceSearch adjacencyListDijkstra(const SpaceGraph& graph, size_t start, OptimizationGoal goal) {
+    ReferenceSearch search{std::vector<double>(graph.station_count(), std::numeric_limits<double>::infinity()),
+                           std::vector<size_t>(graph.station_count(), SIZE_MAX)};
+    std::vector<bool> visited(graph.station_count(), false);
+
+    using PQElement = std::pair<double, size_t>;
+    std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> pq;
+    search.distance[start] = 0.0;
+    pq.push({0.0, start});
+
+    while (!pq.empty()) {
+        auto [current_dist, current] = pq.top();
+        pq.pop();
+        if (visited[current]) continue;
+        visited[current] = true;
+
+        for (const auto& route : graph.get_routes_from(current)) {
+            double new_dist = current_dist + SpacePathfinder::route_cost(route.fuel_cost, route.time_cost,
+                                                                         route.danger_level, goal);
+            if (new_dist < search.distance[route.to_station]) {
+                search.distance[route.to_station] = new_dist;
+                search.parent[route.to_station] = current;
+                pq.push({new_dist, route.to_station});
+            }
+        }
+    }
+    return search;
+}
+
+std::vector<size_t> referencePath(const ReferenceSearch& search, size_t destination) {
+    std::vector<size_t> path;
+    if (std::isinf(search.distance[destination])) return path;
+    for (size_t station = destination; station != SIZE_MAX; station = search.parent[station]) {
+        path.push_back(station);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+// Whether every consecutive pair of stations on path is joined by a route
+bool followsRoutes(const SpaceGraph& graph, const std::vector<size_t>& path) {
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        const auto& routes = graph.get_routes_from(path[i]);
+        if (std::none_of(routes.begin(), routes.end(),
+                         [&](const SpaceRoute& route) { return route.to_station == path[i + 1]; })) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Random (start, destination) pairs, the isolated last station included
+std::vector<std::pair<size_t, size_t>> queryPairs(const SpaceGraph& graph, size_t count, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<size_t> anyStation(0, graph.station_count() - 1);
+    std::vector<std::pair<size_t, size_t>> pairs;
+    for (size_t i = 0; i < count; ++i) {
+        pairs.push_back({anyStation(gen), anyStation(gen)});
+    }
+    pairs.push_back({0, graph.station_count() - 1});
+    pairs.push_back({graph.station_count() - 1, 0});
+    pairs.push_back({3, 3});
+    return pairs;
+}
+
+/**
+ * @struct RouteModel
+ * @brief The routes a DynamicShortestPaths tree should hold: the cheapest
+ * cost under one goal per ordered pair of stations, in travel direction,
+ * and which stations are disabled
+ */
+struct RouteModel {
+    std::vector<std::map<size_t, double>> routes;  // routes[from][to]
+    std::vector<bool> disabled;
+
+    void offer(size_t from, size_t to, double cost, bool directed) {
+        auto [route, inserted] = routes[from].insert({to, cost});
+        if (!inserted) route->second = std::min(route->second, cost);
+        if (!directed) offer(to, from, cost, true);
+    }
+};
+
+RouteModel modelOf(const SpaceGraph& graph, OptimizationGoal goal) {
+    RouteModel model{std::vector<std::map<size_t, double>>(graph.station_count()),
+                     std::vector<bool>(graph.station_count(), false)};
+    for (size_t station = 0; station < graph.station_count(); ++station) {
+        for (const auto& route : graph.get_routes_from(station)) {
+            model.offer(station, route.to_station,
+                        SpacePathfinder::route_cost(route.fuel_cost, route.time_cost, route.danger_level, goal), true);
+        }
+        model.disabled[station] = graph.is_station_damaged(station);
+    }
+    return model;
+}
+
+/**
+ * @brief A fresh Dijkstra over model from root, or towards root along
+ * reversed routes, passing through no disabled station
+ */
+ReferenceSearch modelDijkstra(const RouteModel& model, size_t root, bool towardsRoot) {
+    const size_t stations = model.routes.size();
+    std::vector<std::vector<std::pair<size_t, double>>> arcs(stations);
+    for (size_t from = 0; from < stations; ++from) {
+        for (auto [to, cost] : model.routes[from]) {
+            if (towardsRoot) {
+                arcs[to].push_back({from, cost});
+            } else {
+                arcs[from].push_back({to, cost});
+            }
+        }
+    }
+
+    ReferenceSearch search{std::vector<double>(stations, std::numeric_limits<double>::infinity()),
+                           std::vector<size_t>(stations, SIZE_MAX)};
+    if (model.disabled[root]) return search;
+    std::vector<bool> visited(stations, false);
+    using PQElement = std::pair<double, size_t>;
+    std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> pq;
+    search.distance[root] = 0.0;
+    pq.push({0.0, root});
+    while (!pq.empty()) {
+        auto [current_dist, current] = pq.top();
+        pq.pop();
+        if (visited[current]) continue;
+        visited[current] = true;
+        for (auto [next, cost] : arcs[current]) {
+            if (model.disabled[next] || !(current_dist + cost < search.distance[next])) continue;
+            search.distance[next] = current_dist + cost;
+            search.parent[next] = current;
+            pq.push({search.distance[next], next});
+        }
+    }
+    return search;
+}
+
+// Checks every station's distance and tree parent against a fresh Dijkstra
+void requireMatchesFreshSearch(const DynamicShortestPaths& tree, const RouteModel& model, bool towardsRoot) {
+    ReferenceSearch reference = modelDijkstra(model, tree.root(), towardsRoot);
+    REQUIRE(tree.station_count() == model.routes.size());
+    for (size_t station = 0; station < tree.station_count(); ++station) {
+        INFO("station " << station);
+        REQUIRE(tree.reachable(station) == !std::isinf(reference.distance[station]));
+        REQUIRE(tree.distance(station) == reference.distance[station]);
+        REQUIRE(tree.station_disabled(station) == model.disabled[station]);
+
+        // The station next to this one on its way back to root
+        std::vector<size_t> path = tree.path(station);
+        size_t parent = SIZE_MAX;
+        if (path.size() >= 2) parent = towardsRoot ? path[1] : path[path.size() - 2];
+        REQUIRE(parent == reference.parent[station]);
+    }
+}
+
+} // namespace
+
+TEST_CASE("FrozenSpaceGraph CSR Layout", "[algorithms][graph]") {
+
+    SECTION("Routes, costs and route types match the adjacency lists") {
+        for (bool directed : {false, true}) {
+            SpaceGraph graph = buildGalaxy(4, 24, directed, 7);
+            const size_t last = graph.station_count() - 1;
+            graph.add_route(last, 0, 10.0, 1.0, 0.1, true, "emergency");
+            graph.add_route(last, 1, 10.0, 1.0, 0.1, false, "wormhole");
+            auto routes = graph.frozen();
+
+            REQUIRE(routes->directed() == directed);
+            REQUIRE(routes->station_count() == graph.station_count());
+            size_t routeCount = 0;
+            for (size_t station = 0; station < graph.station_count(); ++station) {
+                const auto& expected = graph.get_routes_from(station);
+                REQUIRE(routes->route_end(station) - routes->route_begin(station) == expected.size());
+                for (size_t i = 0; i < expected.size(); ++i) {
+                    const size_t route = routes->route_begin(station) + i;
+                    REQUIRE(routes->target(route) == expected[i].to_station);
+                    REQUIRE(routes->fuel_cost(route) == expected[i].fuel_cost);
+                    REQUIRE(routes->time_cost(route) == expected[i].time_cost);
+                    REQUIRE(routes->danger_level(route) == expected[i].danger_level);
+                    REQUIRE(routes->requires_clearance(route) == expected[i].requires_special_clearance);
+                    REQUIRE(routes->route_type(route) == route_type_from_string(expected[i].route_type));
+                }
+                REQUIRE(routes->position(station) == graph.get_station(station).get_position());
+                routeCount += expected.size();
+            }
+            REQUIRE(routes->route_count() == routeCount);
+            REQUIRE(routes->route_type(routes->find_route(last, 0)) == RouteType::EMERGENCY);
+            REQUIRE(routes->requires_clearance(routes->find_route(last, 0)));
+            REQUIRE(routes->route_type(routes->find_route(last, 1)) == RouteType::OTHER);
+            REQUIRE(routes->find_route(last, 2) == FrozenSpaceGraph::npos);
+        }
+    }
+
+    SECTION("Incoming routes list every route arriving at a station once") {
+        for (bool directed : {false, true}) {
+            SpaceGraph graph = buildGalaxy(4, 24, directed, 11);
+            auto routes = graph.frozen();
+
+            size_t incomingCount = 0;
+            for (size_t station = 0; station < routes->station_count(); ++station) {
+                std::set<std::pair<size_t, size_t>> arriving;
+                for (size_t i = routes->incoming_begin(station); i < routes->incoming_end(station); ++i) {
+                    const size_t route = routes->incoming_route(i);
+                    const size_t source = routes->incoming_source(i);
+                    if (directed) {
+                        // The route itself, leaving source
+                        REQUIRE(routes->target(route) == station);
+                        REQUIRE(route >= routes->route_begin(source));
+                        REQUIRE(route < routes->route_end(source));
+                    } else {
+                        // The twin leaving station, which costs the same
+                        REQUIRE(route >= routes->route_begin(station));
+                        REQUIRE(route < routes->route_end(station));
+                        REQUIRE(routes->target(route) == source);
+                    }
+                    arriving.insert({source, route});
+                }
+                REQUIRE(arriving.size() == routes->incoming_end(station) - routes->incoming_begin(station));
+                incomingCount += arriving.size();
+            }
+            REQUIRE(incomingCount == routes->route_count());
+        }
+    }
+
+    SECTION("freeze() shares one layout until the graph changes") {
+        SpaceGraph graph = buildGalaxy(2, 16, false, 3);
+        REQUIRE_FALSE(graph.is_frozen());
+        REQUIRE(graph.frozen() != graph.frozen());
+
+        graph.freeze();
+        REQUIRE(graph.is_frozen());
+        auto shared = graph.frozen();
+        REQUIRE(graph.frozen() == shared);
+
+        const size_t routeCount = shared->route_count();
+        graph.add_route(0, 20, 5.0, 0.5);
+        REQUIRE_FALSE(graph.is_frozen());
+        REQUIRE(shared->route_count() == routeCount);
+        REQUIRE(graph.frozen()->route_count() == routeCount + 2);
+    }
+}
+
+TEST_CASE("SpacePathfinder CSR Search Matches Adjacency Lists", "[algorithms][graph][pathfinding]") {
+
+    SECTION("Dijkstra paths and costs") {
+        for (bool directed : {false, true}) {
+            SpaceGraph graph = buildGalaxy(8, 40, directed, directed ? 23u : 19u);
+            graph.freeze();
+            SpacePathfinder pathfinder(graph);
+
+            for (OptimizationGoal goal : AllGoals) {
+                for (auto [start, destination] : queryPairs(graph, 40, 5)) {
+                    ReferenceSearch reference = adjacencyListDijkstra(graph, start, goal);
+                    PathResult result = pathfinder.dijkstra_shortest_path(start, destination, goal);
+
+                    INFO("directed " << directed << ", goal " << static_cast<int>(goal)
+                         << ", " << start << " -> " << destination);
+                    REQUIRE(result.path_found == !std::isinf(reference.distance[destination]));
+                    if (!result.path_found) continue;
+                    REQUIRE(result.total_cost == Approx(reference.distance[destination]).epsilon(1e-9));
+                    REQUIRE(result.path.front() == start);
+                    REQUIRE(result.path.back() == destination);
+                    REQUIRE(followsRoutes(graph, result.path));
+                    if (goal != OptimizationGoal::MINIMUM_HOPS) {
+                        // Hop counts tie; every other goal has one shortest path
+                        REQUIRE(result.path == referencePath(reference, destination));
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("A* paths and costs") {
+        // The Euclidean heuristic only bounds fuel-based costs from below,
+        // so A* is only exact for those goals
+        for (bool directed : {false, true}) {
+            SpaceGraph graph = buildGalaxy(8, 40, directed, directed ? 29u : 31u);
+            SpacePathfinder pathfinder(graph);
+
+            for (OptimizationGoal goal : {OptimizationGoal::MINIMUM_FUEL, OptimizationGoal::BALANCED}) {
+                for (auto [start, destination] : queryPairs(graph, 40, 9)) {
+                    ReferenceSearch reference = adjacencyListDijkstra(graph, start, goal);
+                    PathResult result = pathfinder.a_star_pathfinding(start, destination, goal);
+
+                    INFO("directed " << directed << ", goal " << static_cast<int>(goal)
+                         << ", " << start << " -> " << destination);
+                    REQUIRE(result.path_found == !std::isinf(reference.distance[destination]));
+                    if (!result.path_found) continue;
+                    REQUIRE(result.total_cost == Approx(reference.distance[destination]).epsilon(1e-9));
+                    REQUIRE(result.path == referencePath(reference, destination));
+                }
+            }
+        }
+    }
+
+    SECTION("A pathfinder keeps searching the layout it was built on") {
+        SpaceGraph graph = buildGalaxy(4, 24, false, 37);
+        const size_t last = graph.station_count() - 1;
+        SpacePathfinder before(graph);
+
+        graph.add_route(0, last, 1.0, 0.1);
+        SpacePathfinder after(graph);
+
+        REQUIRE_FALSE(before.dijkstra_shortest_path(0, last).path_found);
+        PathResult result = after.dijkstra_shortest_path(0, last);
+        REQUIRE(result.path_found);
+        REQUIRE(result.path == std::vector<size_t>{0, last});
+        ReferenceSearch reference = adjacencyListDijkstra(graph, 0, OptimizationGoal::BALANCED);
+        REQUIRE(result.total_cost == Approx(reference.distance[last]));
+    }
+
+    SECTION("Stations out of range are rejected") {
+        SpaceGraph graph = buildGalaxy(2, 16, false, 41);
+        SpacePathfinder pathfinder(graph);
+
+        REQUIRE_FALSE(pathfinder.dijkstra_shortest_path(0, graph.station_count()).path_found);
+        REQUIRE_FALSE(pathfinder.a_star_pathfinding(graph.station_count(), 0).path_found);
+    }
+}
+
+TEST_CASE("IndexedDaryHeap Decrease-Key", "[algorithms][graph][heap]") {
+
+    SECTION("Pops each station once, in key order, under its lowest key") {
+        IndexedDaryHeap heap;
+        heap.reset(2000);
+        std::mt19937 gen(43);
+        std::uniform_int_distribution<size_t> anyStation(0, 1999);
+        std::uniform_real_distribution<double> anyKey(0.0, 1000.0);
+
+        // Enough entries for a four-level heap, with pushes that lower,
+        // raise and repeat the keys of queued stations
+        std::map<size_t, double> lowest;
+        for (int i = 0; i < 6000; ++i) {
+            const size_t station = anyStation(gen);
+            const double key = anyKey(gen);
+            heap.push(station, key);
+            auto [entry, inserted] = lowest.insert({station, key});
+            if (!inserted) entry->second = std::min(entry->second, key);
+            REQUIRE(heap.contains(station));
+            REQUIRE(heap.size() == lowest.size());
+        }
+
+        double previous = -1.0;
+        size_t popped = 0;
+        while (!heap.empty()) {
+            IndexedDaryHeap::Entry entry = heap.pop();
+            REQUIRE(entry.key >= previous);
+            REQUIRE(entry.key == lowest.at(entry.station));
+            REQUIRE_FALSE(heap.contains(entry.station));
+            previous = entry.key;
+            ++popped;
+        }
+        REQUIRE(popped == lowest.size());
+    }
+
+    SECTION("Decrease-key lifts the last leaf past every ancestor") {
+        IndexedDaryHeap heap;
+        heap.reset(85);
+        // 1 + 4 + 16 + 64 entries: four full levels
+        for (size_t station = 0; station < 85; ++station) {
+            heap.push(station, 100.0 + static_cast<double>(station));
+        }
+        heap.push(84, 500.0);
+        REQUIRE(heap.top().station == 0);
+
+        heap.push(84, 1.0);
+        REQUIRE(heap.size() == 85);
+        REQUIRE(heap.top().station == 84);
+        REQUIRE(heap.pop().key == 1.0);
+        REQUIRE(heap.pop().station == 0);
+        REQUIRE(heap.pop().station == 1);
+    }
+
+    SECTION("reset() forgets queued stations and grows the index") {
+        IndexedDaryHeap heap;
+        heap.reset(10);
+        for (size_t station = 0; station < 10; station += 2) {
+            heap.push(station, static_cast<double>(10 - station));
+        }
+        heap.pop();
+
+        heap.reset(20);
+        REQUIRE(heap.empty());
+        for (size_t station = 0; station < 20; ++station) {
+            REQUIRE_FALSE(heap.contains(station));
+        }
+
+        heap.push(19, 3.0);
+        heap.push(4, 7.0);
+        heap.push(4, 2.0);
+        REQUIRE(heap.size() == 2);
+        REQUIRE(heap.pop().station == 4);
+        REQUIRE(heap.pop().station == 19);
+        REQUIRE(heap.empty());
+    }
+}
+
+TEST_CASE("SearchWorkspace Generations", "[algorithms][graph][pathfinding]") {
+
+    SECTION("relax() keeps the best unsettled distance and settles in order") {
+        SearchWorkspace search;
+        search.start(6);
+        REQUIRE(search.relax(0, 0.0, SearchWorkspace::npos));
+        REQUIRE(search.relax(2, 9.0, 1));
+        REQUIRE(search.relax(2, 4.0, 0));
+        REQUIRE_FALSE(search.relax(2, 5.0, 3));
+        REQUIRE(search.relax(3, 6.0, 2, 1.0));
+
+        REQUIRE(search.settle_next() == 0);
+        REQUIRE(search.settle_next() == 3);  // Queued by key, not distance
+        REQUIRE(search.settled(3));
+        REQUIRE_FALSE(search.relax(3, 0.5, 0));
+        REQUIRE(search.settle_next() == 2);
+
+        REQUIRE(search.distance(2) == 4.0);
+        REQUIRE(search.parent(2) == 0);
+        REQUIRE(search.parent(0) == SearchWorkspace::npos);
+        REQUIRE(search.path_to(3) == std::vector<size_t>{0, 2, 3});
+        REQUIRE_FALSE(search.reached(5));
+        REQUIRE(std::isinf(search.distance(5)));
+        REQUIRE(search.path_to(5).empty());
+    }
+
+    SECTION("start() forgets the previous search without clearing it") {
+        SearchWorkspace search;
+        search.start(4);
+        search.relax(0, 0.0, SearchWorkspace::npos);
+        search.relax(1, 2.0, 0);
+        search.settle_next();
+
+        search.start(8);
+        for (size_t station = 0; station < 8; ++station) {
+            REQUIRE_FALSE(search.reached(station));
+            REQUIRE_FALSE(search.settled(station));
+            REQUIRE(search.parent(station) == SearchWorkspace::npos);
+        }
+        REQUIRE(search.queue().empty());
+        REQUIRE(search.relax(1, 5.0, SearchWorkspace::npos));
+        REQUIRE(search.distance(1) == 5.0);
+    }
+
+    SECTION("Searches stay exact across the generation wraparound") {
+        SpaceGraph graph = buildGalaxy(4, 24, true, 47);
+        auto routes = graph.frozen();
+        const size_t stations = routes->station_count();
+
+        // A few searches before start() runs out of stamps, and a few after;
+        // each leaves settled stamps near the top of the range behind
+        SearchWorkspace search(std::numeric_limits<uint32_t>::max() - 9);
+        for (size_t start = 0; start < 10; ++start) {
+            search.start(stations);
+            for (size_t station = 0; station < stations; ++station) {
+                REQUIRE_FALSE(search.reached(station));
+            }
+
+            search.relax(start, 0.0, SearchWorkspace::npos);
+            while (!search.queue().empty()) {
+                size_t current = search.settle_next();
+                for (size_t route = routes->route_begin(current); route < routes->route_end(current); ++route) {
+                    search.relax(routes->target(route), search.distance(current) +
+                                 SpacePathfinder::route_cost(routes->fuel_cost(route), routes->time_cost(route),
+                                                             routes->danger_level(route), OptimizationGoal::BALANCED),
+                                 current);
+                }
+            }
+
+            ReferenceSearch reference = adjacencyListDijkstra(graph, start, OptimizationGoal::BALANCED);
+            for (size_t station = 0; station < stations; ++station) {
+                INFO("search " << start << ", station " << station);
+                REQUIRE(search.settled(station) == !std::isinf(reference.distance[station]));
+                REQUIRE(search.distance(station) == reference.distance[station]);
+                REQUIRE(search.path_to(station) == referencePath(reference, station));
+            }
+        }
+    }
+}
+
+TEST_CASE("SpacePathfinder One-To-Many Routing", "[algorithms][graph][pathfinding]") {
+    SpaceGraph graph = buildGalaxy(8, 40, true, 53);
+    graph.freeze();
+    SpacePathfinder pathfinder(graph);
+    const size_t isolated = graph.station_count() - 1;
+    const size_t invalid = graph.station_count() + 5;
+
+    // Duplicates, the start itself, an unreachable and an invalid station
+    const std::vector<size_t> targets = {17, 250, 17, 3, invalid, isolated, 301, 250, 64};
+
+    SECTION("one_to_many matches independent single-pair searches") {
+        for (OptimizationGoal goal : AllGoals) {
+            for (size_t start : {size_t{3}, size_t{120}, size_t{299}}) {
+                std::vector<PathResult> results = pathfinder.one_to_many(start, targets, goal);
+                ReferenceSearch reference = adjacencyListDijkstra(graph, start, goal);
+                REQUIRE(results.size() == targets.size());
+
+                for (size_t i = 0; i < targets.size(); ++i) {
+                    INFO("goal " << static_cast<int>(goal) << ", " << start << " -> " << targets[i]);
+                    const PathResult& result = results[i];
+                    if (targets[i] == invalid) {
+                        REQUIRE_FALSE(result.path_found);
+                        REQUIRE(result.optimization_criteria == "Invalid vertices");
+                        continue;
+                    }
+                    PathResult single = pathfinder.dijkstra_shortest_path(start, targets[i], goal);
+                    REQUIRE(result.path_found == single.path_found);
+                    REQUIRE(result.path_found == !std::isinf(reference.distance[targets[i]]));
+                    if (!result.path_found) continue;
+                    REQUIRE(result.total_cost == Approx(reference.distance[targets[i]]).epsilon(1e-9));
+                    REQUIRE(result.total_cost == Approx(single.total_cost).epsilon(1e-9));
+                    if (goal != OptimizationGoal::MINIMUM_HOPS) {
+                        REQUIRE(result.path == referencePath(reference, targets[i]));
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("one_to_many rejects every target of an invalid start") {
+        std::vector<PathResult> results = pathfinder.one_to_many(invalid, targets);
+        REQUIRE(results.size() == targets.size());
+        for (const auto& result : results) {
+            REQUIRE_FALSE(result.path_found);
+        }
+        REQUIRE(pathfinder.one_to_many(0, {}).empty());
+    }
+
+    SECTION("distance_table matches independent single-pair searches") {
+        const std::vector<size_t> sources = {0, 120, invalid, 120, isolated, 317};
+        for (size_t threads : {size_t{1}, size_t{4}}) {
+            auto table = pathfinder.distance_table(sources, targets, OptimizationGoal::MINIMUM_TIME, threads);
+            REQUIRE(table.size() == sources.size());
+
+            for (size_t row = 0; row < sources.size(); ++row) {
+                REQUIRE(table[row].size() == targets.size());
+                for (size_t column = 0; column < targets.size(); ++column) {
+                    INFO(threads << " threads, " << sources[row] << " -> " << targets[column]);
+                    PathResult single = pathfinder.dijkstra_shortest_path(sources[row], targets[column],
+                                                                          OptimizationGoal::MINIMUM_TIME);
+                    if (single.path_found) {
+                        REQUIRE(table[row][column] == Approx(single.total_cost).epsilon(1e-9));
+                    } else {
+                        REQUIRE(std::isinf(table[row][column]));
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("ContractionHierarchy Queries", "[algorithms][graph][contraction]") {
+
+    SECTION("Queries match plain Dijkstra for every goal") {
+        for (bool directed : {false, true}) {
+            SpaceGraph graph = buildGalaxy(6, 30, directed, directed ? 59u : 61u);
+
+            for (OptimizationGoal goal : AllGoals) {
+                ContractionHierarchy hierarchy(graph, goal);
+                REQUIRE(hierarchy.goal() == goal);
+                REQUIRE(hierarchy.station_count() == graph.station_count());
+
+                for (auto [start, destination] : queryPairs(graph, 40, 67)) {
+                    ReferenceSearch reference = adjacencyListDijkstra(graph, start, goal);
+                    ContractionHierarchy::QueryResult result = hierarchy.query(start, destination);
+
+                    INFO("directed " << directed << ", goal " << static_cast<int>(goal)
+                         << ", " << start << " -> " << destination);
+                    if (std::isinf(reference.distance[destination])) {
+                        REQUIRE(std::isinf(result.cost));
+                        REQUIRE(result.path.empty());
+                        continue;
+                    }
+                    REQUIRE(result.cost == Approx(reference.distance[destination]).epsilon(1e-9));
+                    REQUIRE(hierarchy.distance(start, destination) == result.cost);
+                    REQUIRE(result.path.front() == start);
+                    REQUIRE(result.path.back() == destination);
+                    REQUIRE(followsRoutes(graph, result.path));
+                    if (goal != OptimizationGoal::MINIMUM_HOPS) {
+                        REQUIRE(result.path == referencePath(reference, destination));
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("dijkstra_shortest_path answers through an attached hierarchy") {
+        SpaceGraph graph = buildGalaxy(6, 30, false, 71);
+        SpacePathfinder pathfinder(graph);
+        auto hierarchy = std::make_shared<const ContractionHierarchy>(graph, OptimizationGoal::BALANCED);
+        pathfinder.use_contraction_hierarchy(hierarchy);
+        pathfinder.use_contraction_hierarchy(nullptr);
+
+        for (auto [start, destination] : queryPairs(graph, 20, 73)) {
+            ReferenceSearch reference = adjacencyListDijkstra(graph, start, OptimizationGoal::BALANCED);
+            PathResult result = pathfinder.dijkstra_shortest_path(start, destination, OptimizationGoal::BALANCED);
+
+            INFO(start << " -> " << destination);
+            REQUIRE(result.algorithm_name == "Dijkstra (CH)");
+            REQUIRE(result.path_found == !std::isinf(reference.distance[destination]));
+            if (!result.path_found) continue;
+            REQUIRE(result.total_cost == Approx(reference.distance[destination]).epsilon(1e-9));
+            REQUIRE(result.path == referencePath(reference, destination));
+        }
+
+        // Other goals still search the routes
+        REQUIRE(pathfinder.dijkstra_shortest_path(0, 1, OptimizationGoal::MINIMUM_FUEL).algorithm_name == "Dijkstra");
+    }
+
+    SECTION("save() and load() round-trip the index") {
+        SpaceGraph graph = buildGalaxy(6, 30, true, 79);
+        ContractionHierarchy hierarchy(graph, OptimizationGoal::MINIMUM_TIME);
+        const auto file = std::filesystem::temp_directory_path() / "cppversehub_ch_unit_test.idx";
+
+        hierarchy.save(file.string());
+        ContractionHierarchy loaded = ContractionHierarchy::load(file.string());
+        std::filesystem::remove(file);
+
+        REQUIRE(loaded.goal() == OptimizationGoal::MINIMUM_TIME);
+        REQUIRE(loaded.station_count() == hierarchy.station_count());
+        REQUIRE(loaded.arc_count() == hierarchy.arc_count());
+        for (auto [start, destination] : queryPairs(graph, 60, 83)) {
+            ContractionHierarchy::QueryResult expected = hierarchy.query(start, destination);
+            ContractionHierarchy::QueryResult actual = loaded.query(start, destination);
+            INFO(start << " -> " << destination);
+            REQUIRE((actual.cost == expected.cost || (std::isinf(actual.cost) && std::isinf(expected.cost))));
+            REQUIRE(actual.path == expected.path);
+            REQUIRE(actual.nodes_settled == expected.nodes_settled);
+        }
+    }
+
+    SECTION("load() rejects missing, truncated and foreign files") {
+        const auto file = std::filesystem::temp_directory_path() / "cppversehub_ch_unit_test_corrupt.idx";
+        REQUIRE_THROWS_AS(ContractionHierarchy::load(file.string()), std::runtime_error);
+
+        ContractionHierarchy(buildGalaxy(2, 16, false, 89), OptimizationGoal::MINIMUM_FUEL).save(file.string());
+        std::filesystem::resize_file(file, std::filesystem::file_size(file) - 7);
+        REQUIRE_THROWS_AS(ContractionHierarchy::load(file.string()), std::runtime_error);
+
+        {
+            std::ofstream out(file, std::ios::binary | std::ios::trunc);
+            out << "not a contraction hierarchy index";
+        }
+        REQUIRE_THROWS_AS(ContractionHierarchy::load(file.string()), std::runtime_error);
+        std::filesystem::remove(file);
+    }
+
+    SECTION("A hierarchy built for a different graph is refused") {
+        SpaceGraph graph = buildGalaxy(4, 24, false, 97);
+        SpaceGraph other = buildGalaxy(4, 25, false, 97);
+        auto hierarchy = std::make_shared<const ContractionHierarchy>(other, OptimizationGoal::BALANCED);
+        SpacePathfinder pathfinder(graph);
+
+        REQUIRE_THROWS_AS(pathfinder.use_contraction_hierarchy(hierarchy), std::invalid_argument);
+        REQUIRE(pathfinder.dijkstra_shortest_path(0, 1).algorithm_name == "Dijkstra");
+    }
+}
+
+TEST_CASE("DynamicShortestPaths Repairs Match Fresh Searches", "[algorithms][graph][dynamic]") {
+    using Direction = DynamicShortestPaths::Direction;
+    const OptimizationGoal goal = OptimizationGoal::BALANCED;
+
+    SECTION("Random route inserts, cost changes, deletions and station damage") {
+        for (bool directed : {false, true}) {
+            for (Direction direction : {Direction::FROM_ROOT, Direction::TO_ROOT}) {
+                SpaceGraph graph = buildGalaxy(4, 20, directed, directed ? 101u : 103u);
+                RouteModel model = modelOf(graph, goal);
+                const bool towardsRoot = direction == Direction::TO_ROOT;
+                DynamicShortestPaths tree(graph, 5, goal, direction);
+                requireMatchesFreshSearch(tree, model, towardsRoot);
+
+                std::mt19937 gen(directed ? 107u : 109u);
+                std::uniform_int_distribution<int> operation(0, 9);
+                std::uniform_real_distribution<double> fuel(20.0, 400.0);
+                std::uniform_real_distribution<double> danger(0.0, 0.3);
+                auto anyStation = [&]() {
+                    return std::uniform_int_distribution<size_t>(0, model.routes.size() - 1)(gen);
+                };
+
+                for (int step = 0; step < 400; ++step) {
+                    const size_t station = anyStation();
+                    const std::vector<size_t> treePath = tree.path(station);
+                    const int op = operation(gen);
+
+                    if (op <= 2) {
+                        // New or parallel route; only a cheaper one counts
+                        const size_t to = anyStation();
+                        const double fuelCost = fuel(gen), timeCost = fuelCost / 250.0, dangerLevel = danger(gen);
+                        tree.add_route(station, to, fuelCost, timeCost, dangerLevel);
+                        if (station != to) {
+                            model.offer(station, to, SpacePathfinder::route_cost(fuelCost, timeCost, dangerLevel, goal),
+                                        directed);
+                        }
+                    } else if (op <= 4 && treePath.size() >= 2) {
+                        // Reprice the tree route into station, often upwards
+                        const size_t from = towardsRoot ? station : treePath[treePath.size() - 2];
+                        const size_t to = towardsRoot ? treePath[1] : station;
+                        const double fuelCost = fuel(gen), timeCost = fuelCost / 250.0, dangerLevel = danger(gen);
+                        tree.set_route(from, to, fuelCost, timeCost, dangerLevel);
+                        const double cost = SpacePathfinder::route_cost(fuelCost, timeCost, dangerLevel, goal);
+                        model.routes[from][to] = cost;
+                        if (!directed) model.routes[to][from] = cost;
+                    } else if (op <= 6 && treePath.size() >= 2) {
+                        // Delete the tree route into station
+                        const size_t from = towardsRoot ? station : treePath[treePath.size() - 2];
+                        const size_t to = towardsRoot ? treePath[1] : station;
+                        tree.remove_route(from, to);
+                        model.routes[from].erase(to);
+                        if (!directed) model.routes[to].erase(from);
+                    } else if (op == 7) {
+                        tree.disable_station(station);
+                        model.disabled[station] = true;
+                    } else if (op == 8) {
+                        // Restores the root too, now and then
+                        const size_t restored = step % 7 == 0 ? tree.root() : station;
+                        tree.restore_station(restored);
+                        model.disabled[restored] = false;
+                    } else {
+                        tree.add_station();
+                        model.routes.emplace_back();
+                        model.disabled.push_back(false);
+                    }
+
+                    INFO("directed " << directed << ", towards root " << towardsRoot << ", step " << step
+                         << ", operation " << op);
+                    requireMatchesFreshSearch(tree, model, towardsRoot);
+                }
+            }
+        }
+    }
+
+    SECTION("sync() follows new stations, routes and damage on the graph") {
+        for (bool directed : {false, true}) {
+            for (Direction direction : {Direction::FROM_ROOT, Direction::TO_ROOT}) {
+                SpaceGraph graph = buildGalaxy(4, 20, directed, directed ? 113u : 127u);
+                const bool towardsRoot = direction == Direction::TO_ROOT;
+                DynamicShortestPaths tree(graph, 9, goal, direction);
+
+                std::mt19937 gen(directed ? 131u : 137u);
+                std::uniform_int_distribution<int> operation(0, 5);
+                std::uniform_int_distribution<int> batch(1, 4);
+                std::uniform_real_distribution<double> fuel(20.0, 400.0);
+                for (int step = 0; step < 150; ++step) {
+                    for (int change = batch(gen); change > 0; --change) {
+                        const size_t station = std::uniform_int_distribution<size_t>(0, graph.station_count() - 1)(gen);
+                        const size_t other = std::uniform_int_distribution<size_t>(0, graph.station_count() - 1)(gen);
+                        const int op = operation(gen);
+                        if (op <= 1) {
+                            graph.add_route(station, other, fuel(gen), 0.5, 0.1);
+                        } else if (op <= 3) {
+                            graph.set_station_damaged(station, !graph.is_station_damaged(station));
+                        } else if (op == 4) {
+                            size_t added = graph.add_station("Outpost", {0.0, 0.0, 0.0});
+                            graph.add_route(station, added, fuel(gen), 0.5, 0.1);
+                        } else {
+                            graph.set_station_damaged(tree.root(), !graph.is_station_damaged(tree.root()));
+                        }
+                    }
+                    tree.sync(graph);
+
+                    INFO("directed " << directed << ", towards root " << towardsRoot << ", step " << step);
+                    requireMatchesFreshSearch(tree, modelOf(graph, goal), towardsRoot);
+                }
+            }
+        }
+    }
+
+    SECTION("sync() catches up from a layout older than the change journal") {
+        SpaceGraph graph = buildGalaxy(4, 20, true, 139);
+        graph.freeze();
+        DynamicShortestPaths tree(graph, 2, goal, Direction::TO_ROOT);
+
+        // Far more damage reports than the journal keeps, so the tree is
+        // rebuilt from the frozen layout and reconciled with the damage
+        std::mt19937 gen(149);
+        std::uniform_int_distribution<size_t> anyStation(0, graph.station_count() - 1);
+        for (int change = 0; change < 5000; ++change) {
+            const size_t station = anyStation(gen);
+            graph.set_station_damaged(station, !graph.is_station_damaged(station));
+        }
+        REQUIRE(graph.first_revision() > 0);
+        REQUIRE(graph.is_frozen());
+
+        tree.sync(graph);
+        requireMatchesFreshSearch(tree, modelOf(graph, goal), true);
+    }
+}
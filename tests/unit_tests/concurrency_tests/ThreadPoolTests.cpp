@@ -12,9 +12,13 @@
 #include <memory>
 #include <mutex>
 #include <condition_variable>
+#include <random>
+#include <algorithm>
+#include <numeric>
 
 // Include the concurrency headers
 #include "ThreadPool.hpp"
+#include "SortingAlgorithms.hpp"
 #include "Planet.hpp"
 #include "Fleet.hpp"
 #include "Entity.hpp"
@@ -853,4 +857,214 @@ TEST_CASE("Thread Pool Exception Handling", "[threadpool][exceptions][error-hand
         REQUIRE(constructorCalls.load() == 10);
         REQUIRE(destructorCalls.load() == 10);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Work-Stealing Fork-Join", "[threadpool][work-stealing][fork-join]") {
+    
+    WorkStealingThreadPool pool(4);
+    
+    SECTION("TaskGroup spawn and sync") {
+        std::atomic<int> counter{0};
+        TaskGroup group(pool);
+        
+        for (int i = 0; i < 100; ++i) {
+            group.spawn([&counter]() { counter.fetch_add(1); });
+        }
+        group.sync();
+        
+        REQUIRE(counter.load() == 100);
+        REQUIRE(group.pending() == 0);
+    }
+    
+    SECTION("Nested parallel_invoke does not deadlock") {
+        // Deeper than the pool is wide: every worker ends up waiting on children
+        std::atomic<int> leaves{0};
+        std::function<void(int)> recurse = [&](int depth) {
+            if (depth == 0) {
+                leaves.fetch_add(1);
+                return;
+            }
+            pool.parallel_invoke([&]() { recurse(depth - 1); },
+                                 [&]() { recurse(depth - 1); });
+        };
+        
+        pool.parallel_invoke([&]() { recurse(10); });
+        
+        REQUIRE(leaves.load() == 1024);
+    }
+    
+    SECTION("Child exceptions are rethrown from sync") {
+        TaskGroup group(pool);
+        group.spawn([]() { throw std::runtime_error("Child task failure"); });
+        group.spawn([]() {});
+        
+        REQUIRE_THROWS_AS(group.sync(), std::runtime_error);
+        REQUIRE(group.pending() == 0);
+    }
+    
+    SECTION("Shutdown cancels children that never ran") {
+        WorkStealingThreadPool single(1);
+        TaskGroup group(single);
+        std::atomic<bool> release{false};
+        std::atomic<int> ran{0};
+        
+        group.spawn([&release]() {
+            while (!release.load()) std::this_thread::yield();
+        });
+        for (int i = 0; i < 10; ++i) {
+            group.spawn([&ran]() { ran.fetch_add(1); });
+        }
+        
+        // Hold the only worker until shutdown has begun, so the queued children are dropped
+        std::thread stopper([&single]() { single.shutdown(); });
+        while (true) {
+            try {
+                single.submit([]() {});
+                std::this_thread::yield();
+            } catch (const std::runtime_error&) {
+                break;
+            }
+        }
+        release = true;
+        stopper.join();
+        
+        REQUIRE_THROWS_AS(group.sync(), std::runtime_error);
+        REQUIRE(group.pending() == 0);
+        REQUIRE(ran.load() == 0);
+    }
+    
+    SECTION("ParallelSort runs on the shared pool") {
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<> dis(0, 10000);
+        std::vector<int> data(50000);
+        for (auto& value : data) value = dis(gen);
+        
+        auto quick = data;
+        auto merge = data;
+        CppVerseHub::Algorithms::ParallelSort<int>::parallel_quicksort(quick, pool);
+        CppVerseHub::Algorithms::ParallelSort<int>::parallel_mergesort(merge, pool);
+        
+        std::sort(data.begin(), data.end());
+        REQUIRE(quick == data);
+        REQUIRE(merge == data);
+    }
+}
+
+TEST_CASE("Bulk Submission and parallel_for", "[threadpool][bulk][parallel-for]") {
+    
+    std::vector<int> values(10000);
+    std::iota(values.begin(), values.end(), 0);
+    const long expectedSum = 10000L * 9999L / 2;
+    
+    SECTION("BasicThreadPool parallel_for covers every index once") {
+        BasicThreadPool pool(4);
+        std::vector<std::atomic<int>> hits(values.size());
+        
+        pool.parallel_for<size_t>(0, values.size(), 64, [&hits](size_t i) { hits[i].fetch_add(1); }).get();
+        
+        REQUIRE(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int>& h) { return h.load() == 1; }));
+    }
+    
+    SECTION("Central-queue parallel_for finishes on free workers while one is busy") {
+        PriorityThreadPool pool(2);
+        std::atomic<bool> release{false};
+        auto blocker = pool.submit(PriorityThreadPool::Priority::CRITICAL, [&release]() {
+            while (!release.load()) std::this_thread::yield();
+        });
+        
+        // The busy worker's runner starts late and finds the range already claimed
+        std::vector<std::atomic<int>> hits(values.size());
+        auto future = pool.parallel_for<size_t>(PriorityThreadPool::Priority::NORMAL, 0, values.size(), 0,
+                                                [&hits](size_t i) { hits[i].fetch_add(1); });
+        bool finishedWhileBusy = future.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+        release = true;
+        blocker.get();
+        future.get();
+        
+        REQUIRE(finishedWhileBusy);
+        REQUIRE(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int>& h) { return h.load() == 1; }));
+    }
+    
+    SECTION("A grain larger than the range runs as one piece") {
+        BasicThreadPool pool(4);
+        std::atomic<int> calls{0};
+        
+        pool.parallel_for(0, 100, 1000, [&calls](int) { calls.fetch_add(1); }).get();
+        
+        REQUIRE(calls.load() == 100);
+    }
+    
+    SECTION("submit_bulk returns a single completion handle") {
+        BasicThreadPool basicPool(4);
+        PriorityThreadPool priorityPool(4);
+        WorkStealingThreadPool stealingPool(4);
+        std::atomic<long> sum{0};
+        auto accumulate = [&sum](int value) { sum.fetch_add(value); };
+        
+        basicPool.submit_bulk(values, accumulate).get();
+        REQUIRE(sum.load() == expectedSum);
+        
+        sum = 0;
+        priorityPool.submit_bulk(PriorityThreadPool::Priority::HIGH, values, accumulate).get();
+        REQUIRE(sum.load() == expectedSum);
+        
+        sum = 0;
+        stealingPool.submit_bulk(values, accumulate).get();
+        REQUIRE(sum.load() == expectedSum);
+    }
+    
+    SECTION("Work-stealing parallel_for splits down to the grain") {
+        WorkStealingThreadPool pool(4);
+        std::atomic<long> sum{0};
+        
+        pool.parallel_for(0, 10000, 1, [&sum](int i) { sum.fetch_add(i); }).get();
+        
+        REQUIRE(sum.load() == expectedSum);
+    }
+    
+    SECTION("Empty range completes immediately") {
+        BasicThreadPool pool(2);
+        auto future = pool.parallel_for(5, 5, 0, [](int) { FAIL("Body must not run"); });
+        REQUIRE(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    }
+    
+    SECTION("Chunk exceptions surface through the completion handle") {
+        WorkStealingThreadPool pool(4);
+        auto future = pool.parallel_for(0, 1000, 10, [](int i) {
+            if (i == 500) throw std::runtime_error("Entity update failed");
+        });
+        REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+    }
+}
+
+TEST_CASE("Task Block Cache", "[threadpool][task-blocks]") {
+    
+    SECTION("Blocks freed on another thread are reused by the allocating thread") {
+        // The submit-from-outside pattern: this thread allocates, a worker frees
+        const size_t blockCount = 1000;
+        std::vector<void*> blocks(blockCount);
+        for (auto& block : blocks) block = detail::TaskBlockCache::allocate(64);
+        
+        std::thread releaser([&blocks]() {
+            for (void* block : blocks) detail::TaskBlockCache::deallocate(block, 64);
+        });
+        releaser.join();
+        std::sort(blocks.begin(), blocks.end());
+        
+        size_t reused = 0;
+        std::vector<void*> again(blockCount);
+        for (auto& block : again) {
+            block = detail::TaskBlockCache::allocate(64);
+            if (std::binary_search(blocks.begin(), blocks.end(), block)) ++reused;
+        }
+        for (void* block : again) detail::TaskBlockCache::deallocate(block, 64);
+        
+        // Only blocks already sitting in this thread's own cache may come from elsewhere
+        REQUIRE(reused + detail::TaskBlockCache::max_cached_per_class >= blockCount);
+    }
+    
+    SECTION("Oversized blocks bypass the cache") {
+        void* block = detail::TaskBlockCache::allocate(4096);
+        REQUIRE(block != nullptr);
+        detail::TaskBlockCache::deallocate(block, 4096);
+    }
+}
@@ -17,6 +17,7 @@
 #include "StackAllocator.hpp"
 #include "TrackingAllocator.hpp"
 #include "MemoryTracker.hpp"
+#include "MemoryPools.hpp"
 
 // Include core classes for testing
 #include "Planet.hpp"
@@ -910,4 +911,111 @@ TEST_CASE_METHOD(AllocatorTestFixture, "Real-World Allocator Applications", "[al
         
         REQUIRE(SimpleTrackingAllocator<Planet>::getActiveAllocations() == 0);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(AllocatorTestFixture, "Variable Size Pool", "[allocators][pool][variable]") {
+
+    SECTION("Requests are routed to their power-of-two size class") {
+        VariableSizePool pool;
+
+        void* small = pool.allocate(17);
+        REQUIRE(pool.total_allocated() == 32);
+        void* page = pool.allocate(4096);
+        REQUIRE(pool.total_allocated() == 32 + 4096);
+
+        // Above the largest class the system allocator is used and not counted
+        void* large = pool.allocate(5000);
+        REQUIRE(large != nullptr);
+        REQUIRE(pool.total_allocated() == 32 + 4096);
+        pool.deallocate(large, 5000);
+
+        // A freed block serves any request of its class, but not of another
+        pool.deallocate(small, 17);
+        void* tiny = pool.allocate(10);
+        REQUIRE(tiny != small);
+        void* sameClass = pool.allocate(32);
+        REQUIRE(sameClass == small);
+
+        pool.deallocate(tiny, 10);
+        pool.deallocate(sameClass, 32);
+        pool.deallocate(page, 4096);
+        REQUIRE(pool.total_allocated() == 0);
+        REQUIRE(pool.allocate(0) == nullptr);
+    }
+
+    SECTION("Chunks whose blocks are all freed are kept up to the high-water mark, then released") {
+        VariableSizePool pool(1);
+        const size_t blocksPerChunk = 64 * 1024 / 1024;
+
+        std::vector<void*> blocks;
+        for (size_t i = 0; i < 3 * blocksPerChunk; ++i) {
+            blocks.push_back(pool.allocate(1024));
+        }
+        REQUIRE(pool.total_chunks() == 3);
+        REQUIRE(pool.free_chunks() == 0);
+
+        // Freeing all but one block of a chunk keeps it in use
+        for (size_t i = 1; i < blocksPerChunk; ++i) {
+            pool.deallocate(blocks[i], 1024);
+        }
+        REQUIRE(pool.free_chunks() == 0);
+        pool.deallocate(blocks[0], 1024);
+        REQUIRE(pool.free_chunks() == 1);
+
+        for (size_t i = blocksPerChunk; i < 2 * blocksPerChunk; ++i) {
+            pool.deallocate(blocks[i], 1024);
+        }
+        REQUIRE(pool.free_chunks() == 1);
+        REQUIRE(pool.released_chunks() == 1);
+        REQUIRE(pool.total_chunks() == 2);
+        REQUIRE(pool.total_allocated() == blocksPerChunk * 1024);
+
+        for (size_t i = 2 * blocksPerChunk; i < 3 * blocksPerChunk; ++i) {
+            pool.deallocate(blocks[i], 1024);
+        }
+        REQUIRE(pool.total_allocated() == 0);
+    }
+
+    SECTION("A retired chunk is reused whole, never through its old free blocks") {
+        VariableSizePool pool(2);
+        const size_t blocksPerChunk = 64 * 1024 / 1024;
+
+        std::vector<void*> first;
+        for (size_t i = 0; i < blocksPerChunk; ++i) {
+            first.push_back(pool.allocate(1024));
+        }
+        std::vector<void*> second;
+        for (size_t i = 0; i < blocksPerChunk; ++i) {
+            second.push_back(pool.allocate(1024));
+        }
+        for (void* block : first) {
+            pool.deallocate(block, 1024);
+        }
+        REQUIRE(pool.free_chunks() == 1);
+
+        // The second chunk is full, so the idle first chunk is taken back and
+        // carved afresh, here into a different size class
+        std::vector<void*> reused;
+        for (size_t i = 0; i < 2 * blocksPerChunk; ++i) {
+            reused.push_back(pool.allocate(512));
+        }
+        REQUIRE(pool.free_chunks() == 0);
+        REQUIRE(pool.total_chunks() == 2);
+        auto lowest = std::min_element(first.begin(), first.end());
+        REQUIRE(std::find(reused.begin(), reused.end(), *lowest) != reused.end());
+
+        // The first chunk's old 1024-byte free blocks must not be handed out again
+        void* fresh = pool.allocate(1024);
+        REQUIRE(std::find(first.begin(), first.end(), fresh) == first.end());
+        REQUIRE(pool.total_chunks() == 3);
+
+        pool.deallocate(fresh, 1024);
+        for (void* block : reused) {
+            pool.deallocate(block, 512);
+        }
+        for (void* block : second) {
+            pool.deallocate(block, 1024);
+        }
+        REQUIRE(pool.total_allocated() == 0);
+    }
+}
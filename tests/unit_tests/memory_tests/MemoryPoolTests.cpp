@@ -0,0 +1,210 @@
+// File: tests/unit_tests/memory_tests/MemoryPoolTests.cpp
+// ThreadSafeMemoryPool magazine and depot lifetime tests for CppVerseHub memory management showcase
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+#include "MemoryPools.hpp"
+
+using namespace CppVerseHub::Memory;
+
+namespace {
+
+constexpr size_t TestBlockSize = 64;
+using TestPool = ThreadSafeMemoryPool<TestBlockSize>;
+
+// Every magazine is either parked in the depot or held by a live thread cache
+size_t depotMagazines(const TestPool& pool) {
+    return pool.depot_full_magazines() + pool.depot_empty_magazines();
+}
+
+// With no thread caches left, the only blocks still taken from the global
+// pool are those in use and those in full depot magazines
+size_t parkedBlocks(const TestPool& pool) {
+    return pool.depot_full_magazines() * TestPool::magazine_size();
+}
+
+// Spins until count reaches target; the threads under test signal progress
+// through plain atomics so each phase can be checked in between
+void waitFor(const std::atomic<int>& count, int target) {
+    while (count.load() < target) {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace
+
+TEST_CASE("ThreadSafeMemoryPool Magazines", "[memory][pools][threads]") {
+
+    SECTION("Blocks freed on a different thread than they were allocated on") {
+        TestPool pool;
+        const size_t initialMagazines = depotMagazines(pool);
+        const size_t blockCount = 5 * TestPool::magazine_size() + 7;
+        std::vector<void*> blocks(blockCount);
+
+        // Catch assertions are made on this thread only
+        for (int round = 0; round < 3; ++round) {
+            size_t producerAllocations = 0;
+            std::thread producer([&]() {
+                for (size_t i = 0; i < blocks.size(); ++i) {
+                    blocks[i] = pool.allocate();
+                    std::memset(blocks[i], static_cast<int>(i & 0xFF), TestBlockSize);
+                }
+                producerAllocations = pool.get_thread_allocations();
+            });
+            producer.join();
+            REQUIRE(producerAllocations == blockCount);
+
+            std::vector<void*> distinct(blocks);
+            std::sort(distinct.begin(), distinct.end());
+            REQUIRE(std::adjacent_find(distinct.begin(), distinct.end()) == distinct.end());
+            REQUIRE(pool.blocks_outstanding() >= blockCount);
+
+            size_t intactBlocks = 0;
+            size_t consumerDeallocations = 0;
+            size_t consumerAllocations = 0;
+            std::thread consumer([&]() {
+                for (size_t i = 0; i < blocks.size(); ++i) {
+                    const auto* bytes = static_cast<const unsigned char*>(blocks[i]);
+                    if (bytes[0] == (i & 0xFF) && bytes[TestBlockSize - 1] == (i & 0xFF)) {
+                        ++intactBlocks;
+                    }
+                    pool.deallocate(blocks[i]);
+                }
+                consumerDeallocations = pool.get_thread_deallocations();
+                consumerAllocations = pool.get_thread_allocations();
+            });
+            consumer.join();
+            REQUIRE(intactBlocks == blockCount);
+            REQUIRE(consumerDeallocations == blockCount);
+            REQUIRE(consumerAllocations == 0);
+
+            REQUIRE(pool.thread_cache_count() == 0);
+            REQUIRE(depotMagazines(pool) == initialMagazines);
+            REQUIRE(pool.blocks_outstanding() == parkedBlocks(pool));
+        }
+
+        // The blocks the consumer parked are handed out again here
+        void* reused = pool.allocate();
+        REQUIRE(reused != nullptr);
+        REQUIRE(pool.get_thread_allocations() == 1);
+        pool.deallocate(reused);
+    }
+
+    SECTION("Magazines go back to the depot when their thread exits") {
+        TestPool pool;
+        const size_t initialMagazines = depotMagazines(pool);
+        std::atomic<int> ready{0};
+        std::atomic<int> release{0};
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 4; ++t) {
+            workers.emplace_back([&, t]() {
+                // Leave the caches part full so both hand-back paths run:
+                // full magazines are parked, partial ones drained to the pool
+                std::vector<void*> held;
+                for (size_t i = 0; i < TestPool::magazine_size() * 2 + static_cast<size_t>(t) * 5; ++i) {
+                    held.push_back(pool.allocate());
+                }
+                for (void* block : held) {
+                    pool.deallocate(block);
+                }
+                ready.fetch_add(1);
+                waitFor(release, 1);
+            });
+        }
+
+        waitFor(ready, 4);
+        REQUIRE(pool.thread_cache_count() == 4);
+        REQUIRE(depotMagazines(pool) < initialMagazines);
+
+        release.store(1);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        REQUIRE(pool.thread_cache_count() == 0);
+        REQUIRE(depotMagazines(pool) == initialMagazines);
+        REQUIRE(pool.blocks_outstanding() == parkedBlocks(pool));
+    }
+
+    SECTION("Pool destroyed while other threads still hold its caches") {
+        auto pool = std::make_unique<TestPool>();
+        TestPool successor;
+        std::atomic<int> cached{0};
+        std::atomic<int> destroyed{0};
+        std::atomic<int> finished{0};
+        std::atomic<int> successorAllocations{0};
+        std::atomic<int> checked{0};
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 4; ++t) {
+            workers.emplace_back([&]() {
+                std::vector<void*> held;
+                for (size_t i = 0; i < TestPool::magazine_size() + 3; ++i) {
+                    held.push_back(pool->allocate());
+                }
+                for (void* block : held) {
+                    pool->deallocate(block);
+                }
+                cached.fetch_add(1);
+                waitFor(destroyed, 1);
+
+                // Registering with another pool drops the dead pool's cache
+                // and hands its magazines back to the depot it kept alive
+                void* block = successor.allocate();
+                successor.deallocate(block);
+                successorAllocations.fetch_add(static_cast<int>(successor.get_thread_allocations()));
+                finished.fetch_add(1);
+                waitFor(checked, 1);
+            });
+        }
+
+        waitFor(cached, 4);
+        pool->deallocate(pool->allocate());
+        pool.reset();
+        destroyed.store(1);
+
+        waitFor(finished, 4);
+        REQUIRE(successorAllocations.load() == 4);
+        REQUIRE(successor.thread_cache_count() == 4);
+        checked.store(1);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        REQUIRE(successor.thread_cache_count() == 0);
+        REQUIRE(successor.blocks_outstanding() == parkedBlocks(successor));
+    }
+
+    SECTION("Thread exits after its pool was destroyed without touching another pool") {
+        auto pool = std::make_unique<TestPool>();
+        std::atomic<int> cached{0};
+        std::atomic<int> destroyed{0};
+
+        std::thread worker([&]() {
+            std::vector<void*> held;
+            for (size_t i = 0; i < 3 * TestPool::magazine_size(); ++i) {
+                held.push_back(pool->allocate());
+            }
+            for (void* block : held) {
+                pool->deallocate(block);
+            }
+            cached.fetch_add(1);
+            waitFor(destroyed, 1);
+            // Exiting releases the cache into the depot the thread kept alive
+        });
+
+        waitFor(cached, 1);
+        REQUIRE(pool->thread_cache_count() == 1);
+        pool.reset();
+        destroyed.store(1);
+        worker.join();
+        SUCCEED("Thread cache outlived its pool and was released at thread exit");
+    }
+}
@@ -0,0 +1,177 @@
+// File: tests/unit_tests/memory_tests/MemoryResourceTests.cpp
+// std::pmr memory resource adapter tests for CppVerseHub memory management showcase
+
+#include <catch2/catch.hpp>
+#include <memory_resource>
+#include <vector>
+#include <unordered_map>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+#include "CustomAllocators.hpp"
+
+using namespace CppVerseHub::Memory;
+
+namespace {
+
+/**
+ * @brief Upstream resource that counts what the adapters forward to it
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t outstanding = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        ++outstanding;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        --outstanding;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+bool alignedTo(const void* ptr, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+// Fills a pmr::vector and a pmr::unordered_map from `resource` and checks
+// that every allocation is given back once they are destroyed
+void exerciseContainers(AllocatorResource& resource) {
+    {
+        std::pmr::vector<int> values(&resource);
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+        std::pmr::unordered_map<int, std::pmr::string> names(&resource);
+        for (int i = 0; i < 200; ++i) {
+            names.emplace(i, std::pmr::string("station-" + std::to_string(i)));
+        }
+
+        REQUIRE(values.get_allocator().resource() == &resource);
+        REQUIRE(names.get_allocator().resource() == &resource);
+        long long sum = 0;
+        for (int value : values) {
+            sum += value;
+        }
+        REQUIRE(sum == 999 * 1000 / 2);
+        REQUIRE(names.size() == 200);
+        REQUIRE(names.at(42) == "station-42");
+        REQUIRE(names.at(42).get_allocator().resource() == &resource);
+    }
+
+    const ResourceStatistics& stats = resource.statistics();
+    REQUIRE(stats.allocations > 0);
+    REQUIRE(stats.allocations == stats.deallocations);
+    REQUIRE(stats.bytes_in_use() == 0);
+    REQUIRE(stats.peak_bytes_in_use > 0);
+}
+
+// Naturally aligned requests stay local; over-aligned ones go upstream and
+// still honour their alignment
+void checkAlignment(AllocatorResource& resource, CountingResource& upstream) {
+    size_t before = upstream.allocations;
+    void* natural = resource.allocate(24, alignof(double));
+    REQUIRE(alignedTo(natural, alignof(double)));
+    REQUIRE(upstream.allocations == before);
+
+    void* over = resource.allocate(100, 64);
+    REQUIRE(alignedTo(over, 64));
+    REQUIRE(upstream.allocations == before + 1);
+    REQUIRE(resource.statistics().upstream_allocations >= 1);
+
+    resource.deallocate(over, 100, 64);
+    resource.deallocate(natural, 24, alignof(double));
+    REQUIRE(upstream.outstanding == 0);
+}
+
+void checkEquality(AllocatorResource& resource, AllocatorResource& sibling) {
+    REQUIRE(resource.is_equal(resource));
+    REQUIRE_FALSE(resource.is_equal(sibling));
+    REQUIRE_FALSE(resource.is_equal(*std::pmr::new_delete_resource()));
+    REQUIRE(resource == resource);
+    REQUIRE(resource != sibling);
+}
+
+} // namespace
+
+TEST_CASE("Allocator Memory Resources", "[allocators][pmr]") {
+
+    CountingResource upstream;
+
+    SECTION("StackAllocatorResource") {
+        auto allocator = std::make_unique<StackAllocator<64 * 1024>>();
+        auto siblingAllocator = std::make_unique<StackAllocator<64 * 1024>>();
+        StackAllocatorResource<64 * 1024> resource(*allocator, &upstream);
+        StackAllocatorResource<64 * 1024> sibling(*siblingAllocator, &upstream);
+
+        exerciseContainers(resource);
+        resource.release();
+        REQUIRE(allocator->bytes_used() == 0);
+        checkAlignment(resource, upstream);
+        checkEquality(resource, sibling);
+        REQUIRE(resource.upstream_resource() == &upstream);
+    }
+
+    SECTION("PoolAllocatorResource") {
+        auto allocator = std::make_unique<PoolAllocator<64, 256>>();
+        auto siblingAllocator = std::make_unique<PoolAllocator<64, 256>>();
+        PoolAllocatorResource<64, 256> resource(*allocator, &upstream);
+        PoolAllocatorResource<64, 256> sibling(*siblingAllocator, &upstream);
+
+        exerciseContainers(resource);
+        REQUIRE(allocator->allocated_count() == 0);
+        REQUIRE(upstream.outstanding == 0);
+        checkAlignment(resource, upstream);
+        checkEquality(resource, sibling);
+    }
+
+    SECTION("MonotonicAllocatorResource") {
+        MonotonicAllocator<4096> allocator;
+        MonotonicAllocator<4096> siblingAllocator;
+        MonotonicAllocatorResource<4096> resource(allocator, &upstream);
+        MonotonicAllocatorResource<4096> sibling(siblingAllocator, &upstream);
+
+        exerciseContainers(resource);
+        REQUIRE(upstream.outstanding == 0);
+        resource.release();
+        checkAlignment(resource, upstream);
+        checkEquality(resource, sibling);
+    }
+
+    SECTION("SmallObjectAllocatorResource") {
+        SmallObjectAllocator<256, 4096> allocator;
+        SmallObjectAllocator<256, 4096> siblingAllocator;
+        SmallObjectAllocatorResource<256, 4096> resource(allocator, &upstream);
+        SmallObjectAllocatorResource<256, 4096> sibling(siblingAllocator, &upstream);
+
+        exerciseContainers(resource);
+        REQUIRE(upstream.outstanding == 0);
+        checkAlignment(resource, upstream);
+        checkEquality(resource, sibling);
+    }
+
+    SECTION("Containers on different adapters do not share storage") {
+        MonotonicAllocator<4096> first;
+        MonotonicAllocator<4096> second;
+        MonotonicAllocatorResource<4096> firstResource(first, &upstream);
+        MonotonicAllocatorResource<4096> secondResource(second, &upstream);
+
+        std::pmr::vector<int> a({1, 2, 3}, &firstResource);
+        std::pmr::vector<int> b(&secondResource);
+        b = a;
+        REQUIRE(b.get_allocator().resource() == &secondResource);
+        REQUIRE(b == a);
+        REQUIRE(secondResource.statistics().allocations == 1);
+    }
+}
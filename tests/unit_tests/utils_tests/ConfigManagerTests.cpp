@@ -0,0 +1,318 @@
+// File: tests/unit_tests/utils_tests/ConfigManagerTests.cpp
+// Configuration snapshot and reload notification tests for CppVerseHub utilities
+
+#include <catch2/catch.hpp>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+
+#include "ConfigManager.hpp"
+
+using namespace CppVerseHub::Utils;
+
+namespace {
+
+/**
+ * @brief What the reload and change listeners saw. ConfigManager is a
+ * singleton and its listeners outlive a test case, so they hold this through
+ * a shared_ptr and only record changes to the section under test.
+ */
+struct ListenerLog {
+    std::mutex mutex;
+    std::vector<ConfigDiff> reloads;
+    std::vector<ConfigValue> changes;
+};
+
+std::shared_ptr<ListenerLog> watchSection(ConfigManager& config, const std::string& section,
+                                          const std::string& key) {
+    auto log = std::make_shared<ListenerLog>();
+    config.addReloadListener([log, section](const ConfigDiff& diff) {
+        ConfigDiff mine{diff.from_version, diff.to_version, {}};
+        for (const auto& change : diff.changes) {
+            if (change.section == section) mine.changes.push_back(change);
+        }
+        if (mine.empty()) return;
+        std::lock_guard<std::mutex> lock(log->mutex);
+        log->reloads.push_back(std::move(mine));
+    });
+    config.addChangeListener(section, key, [log](const std::string&, const ConfigValue& value) {
+        std::lock_guard<std::mutex> lock(log->mutex);
+        log->changes.push_back(value);
+    });
+    return log;
+}
+
+const ConfigChange* findChange(const ConfigDiff& diff, const std::string& key) {
+    for (const auto& change : diff.changes) {
+        if (change.key == key) return &change;
+    }
+    return nullptr;
+}
+
+void writeFile(const std::filesystem::path& path, const std::string& content) {
+    std::ofstream file(path);
+    file << content;
+}
+
+} // namespace
+
+TEST_CASE("Config Snapshots", "[config][snapshot]") {
+
+    ConfigManager& config = ConfigManager::getInstance();
+
+    SECTION("Pinned snapshots do not see later writes") {
+        config.set("SnapshotPin", "value", 1);
+        auto pinned = config.snapshot();
+        uint64_t version = config.getVersion();
+
+        config.set("SnapshotPin", "value", 2);
+        REQUIRE(pinned->get<int>("SnapshotPin", "value") == 1);
+        REQUIRE(config.get<int>("SnapshotPin", "value") == 2);
+        REQUIRE(config.getVersion() > version);
+        REQUIRE(config.snapshot()->version() == config.getVersion());
+        config.removeSection("SnapshotPin");
+    }
+
+    SECTION("Edits copy only the section they touch") {
+        config.set("SnapshotShareA", "value", 1);
+        config.set("SnapshotShareB", "value", 1);
+        auto before = config.snapshot();
+
+        config.getSection("SnapshotShareA").set("value", 5);
+        auto after = config.snapshot();
+        REQUIRE(after->get<int>("SnapshotShareA", "value") == 5);
+        REQUIRE(after->sections().at("SnapshotShareB") == before->sections().at("SnapshotShareB"));
+        REQUIRE(after->sections().at("SnapshotShareA") != before->sections().at("SnapshotShareA"));
+
+        config.removeSection("SnapshotShareA");
+        REQUIRE_FALSE(config.snapshot()->has("SnapshotShareA", "value"));
+        REQUIRE(config.snapshot()->sections().at("SnapshotShareB") == before->sections().at("SnapshotShareB"));
+        config.removeSection("SnapshotShareB");
+    }
+
+    SECTION("Readers see whole reloads while a writer publishes") {
+        constexpr int Reloads = 300;
+        config.loadFromJson(R"({"SnapshotRace": {"first": 0, "second": 0}})");
+
+        std::atomic<bool> done{false};
+        std::atomic<int> torn{0};
+        std::atomic<int> backwards{0};
+        std::atomic<long> reads{0};
+
+        auto reader = [&]() {
+            uint64_t last_version = 0;
+            int last_value = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                auto snapshot = config.snapshot();
+                int first = snapshot->get<int>("SnapshotRace", "first", -1);
+                int second = snapshot->get<int>("SnapshotRace", "second", -2);
+                if (first != second) torn.fetch_add(1);
+                if (snapshot->version() < last_version || first < last_value) backwards.fetch_add(1);
+                last_version = snapshot->version();
+                last_value = first;
+
+                // The lock-free convenience path reads one snapshot too
+                int current = config.get<int>("SnapshotRace", "first", -1);
+                if (current < first) backwards.fetch_add(1);
+                reads.fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 3; ++i) readers.emplace_back(reader);
+        for (int i = 1; i <= Reloads; ++i) {
+            std::string value = std::to_string(i);
+            config.loadFromJson(R"({"SnapshotRace": {"first": )" + value + R"(, "second": )" + value + "}}");
+        }
+        done.store(true, std::memory_order_release);
+        for (auto& thread : readers) thread.join();
+
+        REQUIRE(reads.load() > 0);
+        REQUIRE(torn.load() == 0);
+        REQUIRE(backwards.load() == 0);
+        REQUIRE(config.get<int>("SnapshotRace", "first") == Reloads);
+        config.removeSection("SnapshotRace");
+    }
+}
+
+TEST_CASE("Config Reload Notifications", "[config][reload]") {
+
+    ConfigManager& config = ConfigManager::getInstance();
+    auto path = std::filesystem::temp_directory_path() / "cppversehub_config_reload_test.json";
+
+    SECTION("A file reload reports added, modified and removed keys once") {
+        writeFile(path, R"({"ReloadDiff": {"keep": 1, "drop": 2}})");
+        REQUIRE(config.loadFromFile(path.string()));
+        config.set("ReloadDiff", "manual", 7);
+        auto log = watchSection(config, "ReloadDiff", "keep");
+
+        writeFile(path, R"({"ReloadDiff": {"keep": 3, "add": 4}})");
+        REQUIRE(config.loadFromFile(path.string()));
+
+        REQUIRE(log->reloads.size() == 1);
+        const ConfigDiff& diff = log->reloads.front();
+        REQUIRE(diff.size() == 3);
+        REQUIRE(diff.to_version > diff.from_version);
+
+        const ConfigChange* keep = findChange(diff, "keep");
+        REQUIRE(keep);
+        REQUIRE(keep->kind == ConfigChange::Kind::Modified);
+        REQUIRE(keep->old_value->get<int>() == 1);
+        REQUIRE(keep->new_value->get<int>() == 3);
+
+        const ConfigChange* add = findChange(diff, "add");
+        REQUIRE(add);
+        REQUIRE(add->kind == ConfigChange::Kind::Added);
+        REQUIRE_FALSE(add->old_value);
+
+        const ConfigChange* drop = findChange(diff, "drop");
+        REQUIRE(drop);
+        REQUIRE(drop->kind == ConfigChange::Kind::Removed);
+        REQUIRE(drop->old_value->get<int>() == 2);
+        REQUIRE_FALSE(drop->new_value);
+        REQUIRE_FALSE(config.snapshot()->has("ReloadDiff", "drop"));
+
+        // Keys set in code are not part of the file and survive the reload
+        REQUIRE(config.get<int>("ReloadDiff", "manual") == 7);
+
+        REQUIRE(log->changes.size() == 1);
+        REQUIRE(log->changes.front().get<int>() == 3);
+
+        // Reloading an unchanged file notifies nobody
+        REQUIRE(config.loadFromFile(path.string()));
+        REQUIRE(log->reloads.size() == 1);
+        REQUIRE(log->changes.size() == 1);
+
+        config.removeSection("ReloadDiff");
+    }
+
+    SECTION("Rejected values keep the previous value") {
+        writeFile(path, R"({"ReloadValidate": {"limit": 10}})");
+        REQUIRE(config.loadFromFile(path.string()));
+        config.addValidator("ReloadValidate", "limit", [](const ConfigValue& value) {
+            return value.get<int>() <= 100;
+        });
+        auto log = watchSection(config, "ReloadValidate", "limit");
+
+        writeFile(path, R"({"ReloadValidate": {"limit": 500}})");
+        REQUIRE(config.loadFromFile(path.string()));
+        REQUIRE(config.get<int>("ReloadValidate", "limit") == 10);
+        REQUIRE(log->reloads.empty());
+        REQUIRE(log->changes.empty());
+
+        config.removeSection("ReloadValidate");
+    }
+
+    SECTION("reloadAsync reads the current file and swaps in one snapshot") {
+        writeFile(path, R"({"ReloadAsync": {"level": 1}})");
+        config.setAutoSave(false, path.string());
+        REQUIRE(config.getCurrentConfigFile() == path.string());
+        REQUIRE(config.reload());
+        auto before = config.snapshot();
+        auto log = watchSection(config, "ReloadAsync", "level");
+
+        writeFile(path, R"({"ReloadAsync": {"level": 2, "extra": true}})");
+        std::future<bool> reloaded = config.reloadAsync();
+        REQUIRE(reloaded.get());
+
+        REQUIRE(config.get<int>("ReloadAsync", "level") == 2);
+        REQUIRE(before->get<int>("ReloadAsync", "level") == 1);
+        REQUIRE(log->reloads.size() == 1);
+        REQUIRE(log->reloads.front().size() == 2);
+        REQUIRE(log->changes.size() == 1);
+
+        config.removeSection("ReloadAsync");
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Typed Config Keys", "[config][keys]") {
+
+    ConfigManager& config = ConfigManager::getInstance();
+
+    SECTION("Handles resolve to the stored value or their default") {
+        config.set("TypedKeys", "width", 1280);
+        auto width = config.registerKey<int>("TypedKeys", "width", 640);
+        auto missing = config.registerKey<std::string>("TypedKeys", "title", std::string("untitled"));
+        auto wrong_type = config.registerKey<std::vector<std::string>>("TypedKeys", "width", {"fallback"});
+
+        REQUIRE(config.get(width) == 1280);
+        REQUIRE(config.get(missing) == "untitled");
+        REQUIRE(config.get(wrong_type) == std::vector<std::string>{"fallback"});
+
+        // Registering the same section/key again hands back the same slot
+        auto again = config.registerKey<int>("TypedKeys", "width", 0);
+        REQUIRE(again.index() == width.index());
+
+        config.set(width, 1920);
+        REQUIRE(config.get(width) == 1920);
+        REQUIRE(config.get<int>("TypedKeys", "width") == 1920);
+        config.removeSection("TypedKeys");
+        REQUIRE(config.get(width) == 640);
+    }
+
+    SECTION("Reads stay valid across later reads and reloads") {
+        config.set("TypedKeysRef", "names", std::vector<std::string>{"alpha", "beta"});
+        config.set("TypedKeysRef", "title", std::string("first"));
+        auto names = config.registerKey<std::vector<std::string>>("TypedKeysRef", "names");
+        auto title = config.registerKey<std::string>("TypedKeysRef", "title");
+
+        // Each read may replace this thread's cached snapshot; values read
+        // before a change must not point into the one it frees
+        std::vector<std::string> before = config.get(names);
+        config.set(names, std::vector<std::string>{"gamma"});
+        std::string combined = config.get(title) + "/" + config.get(names).front();
+        REQUIRE(before == std::vector<std::string>{"alpha", "beta"});
+        REQUIRE(combined == "first/gamma");
+
+        // A pinned snapshot reads by reference and keeps its version
+        auto pinned = config.snapshot();
+        REQUIRE(&pinned->get(names) == &pinned->get(names));
+        config.set(names, std::vector<std::string>{"delta", "epsilon", "zeta"});
+        REQUIRE(config.get(names).size() == 3);
+        REQUIRE(pinned->get(names) == std::vector<std::string>{"gamma"});
+        config.removeSection("TypedKeysRef");
+    }
+
+    SECTION("Keys registered after a snapshot read as their default there") {
+        config.set("TypedKeysLate", "count", 3);
+        auto pinned = config.snapshot();
+        auto count = config.registerKey<int>("TypedKeysLate", "count", -1);
+        REQUIRE(pinned->get(count) == -1);
+        REQUIRE(config.get(count) == 3);
+        config.removeSection("TypedKeysLate");
+    }
+
+    SECTION("Validators run when values are stored, not when they are read") {
+        auto validations = std::make_shared<std::atomic<int>>(0);
+        auto fps = config.registerKey<int>("TypedKeysValid", "fps", 60, [validations](const int& value) {
+            validations->fetch_add(1);
+            return value >= 30 && value <= 240;
+        });
+
+        config.set(fps, 144);
+        REQUIRE(validations->load() == 1);
+        REQUIRE_THROWS_AS(config.set(fps, 10), std::runtime_error);
+        REQUIRE(validations->load() == 2);
+        REQUIRE(config.get(fps) == 144);
+
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(config.get(fps) == 144);
+        }
+        REQUIRE(validations->load() == 2);
+
+        config.loadFromJson(R"({"TypedKeysValid": {"fps": 500}})");
+        REQUIRE(validations->load() == 3);
+        REQUIRE(config.get(fps) == 144);
+
+        config.loadFromJson(R"({"TypedKeysValid": {"fps": 120}})");
+        REQUIRE(config.get(fps) == 120);
+        config.removeSection("TypedKeysValid");
+    }
+}
@@ -0,0 +1,549 @@
+// File: tests/unit_tests/utils_tests/LoggerTests.cpp
+// Logging backend tests for CppVerseHub utilities
+
+#include <catch2/catch.hpp>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <filesystem>
+#include <cstdio>
+#include <stdexcept>
+
+#include "Logger.hpp"
+
+using namespace CppVerseHub::Utils;
+
+namespace {
+
+/**
+ * @brief Appender that records every entry it receives. It can hold the
+ * logger's worker inside appendBatch(), or a flush() caller (and with it the
+ * appender lock the worker needs) until released, which lets tests fill the
+ * ring buffer deterministically.
+ */
+class RecordingAppender : public LogAppender {
+public:
+    struct Shared {
+        std::mutex mutex;
+        std::vector<LogEntry> entries;
+        std::atomic<bool> holdAppend{false};
+        std::atomic<bool> holdFlush{false};
+        std::atomic<bool> holding{false};
+        std::atomic<int> flushes{0};
+
+        size_t size() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return entries.size();
+        }
+    };
+
+    explicit RecordingAppender(std::shared_ptr<Shared> shared, bool readsMessage = true)
+        : shared_(std::move(shared)), readsMessage_(readsMessage) {}
+
+    void append(const LogEntry& entry) override {
+        const LogEntry* single = &entry;
+        appendBatch(&single, 1);
+    }
+
+    void appendBatch(const LogEntry* const* entries, size_t count) override {
+        while (shared_->holdAppend.load()) {
+            shared_->holding = true;
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(shared_->mutex);
+        for (size_t i = 0; i < count; ++i) {
+            shared_->entries.push_back(*entries[i]);
+        }
+    }
+
+    void flush() override {
+        while (shared_->holdFlush.load()) {
+            shared_->holding = true;
+            std::this_thread::yield();
+        }
+        ++shared_->flushes;
+    }
+    void setFormatter(std::unique_ptr<LogFormatter>) override {}
+    bool needsRenderedMessage() const override { return readsMessage_; }
+    std::unique_ptr<LogAppender> clone() const override {
+        return std::make_unique<RecordingAppender>(shared_, readsMessage_);
+    }
+
+private:
+    std::shared_ptr<Shared> shared_;
+    bool readsMessage_;
+};
+
+void waitUntil(const std::atomic<bool>& flag) {
+    while (!flag.load()) {
+        std::this_thread::yield();
+    }
+}
+
+enum class Thruster : uint8_t { IDLE = 0, BURN = 7 };
+
+std::vector<char> readFile(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string& filename, const std::vector<char>& bytes) {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+// Writes a single deferred entry "value {}" with one int64 argument
+void writeSingleArgumentLog(const std::string& filename, int64_t value) {
+    std::remove(filename.c_str());
+    BinaryLogAppender appender(filename);
+    LogEntry entry(LogLevel::INFO, "binary", "", "Nav.cpp", "plot", 12);
+    entry.format = "value {}";
+    entry.args.append(value);
+    appender.append(entry);
+    appender.flush();
+}
+
+bool readAll(const std::string& filename) {
+    BinaryLogReader reader(filename);
+    LogEntry entry;
+    while (reader.next(entry)) {
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Log Ring Buffer", "[logger][ring-buffer]") {
+
+    SECTION("Many producers and one consumer keep every entry in per-producer order") {
+        LogRingBuffer ring(64);
+        const int producers = 8;
+        const int perProducer = 20000;
+        std::vector<std::thread> threads;
+
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&ring, p]() {
+                for (int i = 0; i < perProducer; ++i) {
+                    while (!ring.tryPush([p, i](LogEntry& entry) {
+                        entry.level = static_cast<LogLevel>(p % 6);
+                        entry.line = p * perProducer + i;
+                    })) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        std::vector<int> lastSeen(producers, -1);
+        std::vector<LogEntry*> scratch;
+        bool ordered = true;
+        int received = 0;
+        while (received < producers * perProducer) {
+            size_t popped = ring.tryPopBatch(scratch, 16, [&](LogEntry* const* entries, size_t count) {
+                for (size_t i = 0; i < count; ++i) {
+                    int producer = entries[i]->line / perProducer;
+                    int sequence = entries[i]->line % perProducer;
+                    ordered = ordered && sequence == lastSeen[static_cast<size_t>(producer)] + 1;
+                    lastSeen[static_cast<size_t>(producer)] = sequence;
+                }
+            });
+            received += static_cast<int>(popped);
+            if (popped == 0) std::this_thread::yield();
+        }
+        for (auto& thread : threads) thread.join();
+
+        REQUIRE(ordered);
+        REQUIRE(ring.empty());
+        REQUIRE(std::all_of(lastSeen.begin(), lastSeen.end(), [](int last) { return last == perProducer - 1; }));
+    }
+
+    SECTION("A full buffer rejects pushes without touching the entry") {
+        LogRingBuffer ring(3);
+        REQUIRE(ring.capacity() == 4);
+
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(ring.tryPush([i](LogEntry& entry) { entry.line = i; }));
+        }
+        bool filled = false;
+        REQUIRE_FALSE(ring.tryPush([&filled](LogEntry&) { filled = true; }));
+        REQUIRE_FALSE(filled);
+
+        int oldest = -1;
+        REQUIRE(ring.tryPop([&oldest](const LogEntry& entry) { oldest = entry.line; }));
+        REQUIRE(oldest == 0);
+        REQUIRE(ring.tryPush([](LogEntry& entry) { entry.line = 4; }));
+    }
+}
+
+TEST_CASE("Async Logger Backend", "[logger][async]") {
+
+    SECTION("Concurrent producers lose nothing and stay in order under BLOCK") {
+        auto shared = std::make_shared<RecordingAppender::Shared>();
+        AsyncLogger logger("producers", LogLevel::TRACE, 64, OverflowPolicy::BLOCK);
+        logger.addAppender(std::make_unique<RecordingAppender>(shared));
+        const int producers = 8;
+        const int perProducer = 5000;
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&logger, p]() {
+                const std::string source = "producer-" + std::to_string(p);
+                for (int i = 0; i < perProducer; ++i) {
+                    logger.log(LogLevel::INFO, "tick", source, "", i);
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        logger.flush();
+
+        REQUIRE(shared->size() == static_cast<size_t>(producers * perProducer));
+        REQUIRE(logger.getDroppedCount() == 0);
+        std::vector<int> next(producers, 0);
+        bool ordered = true;
+        for (const auto& entry : shared->entries) {
+            auto producer = static_cast<size_t>(std::stoi(entry.file.substr(9)));
+            ordered = ordered && entry.line == next[producer]++;
+        }
+        REQUIRE(ordered);
+    }
+
+    SECTION("DROP_NEWEST discards what does not fit while the worker is stalled") {
+        auto shared = std::make_shared<RecordingAppender::Shared>();
+        AsyncLogger logger("drop-newest", LogLevel::TRACE, 4, OverflowPolicy::DROP_NEWEST);
+        logger.addAppender(std::make_unique<RecordingAppender>(shared));
+        shared->holdFlush = true;
+        std::thread flusher([&logger]() { logger.flush(); });
+        waitUntil(shared->holding);
+
+        for (int i = 0; i < 10; ++i) {
+            logger.log(LogLevel::INFO, "burst", "", "", i);
+        }
+        REQUIRE(logger.getDroppedCount() == 6);
+
+        shared->holdFlush = false;
+        flusher.join();
+        logger.flush();
+        REQUIRE(shared->size() == 4);
+        REQUIRE(shared->entries.front().line == 0);
+        REQUIRE(shared->entries.back().line == 3);
+    }
+
+    SECTION("DROP_OLDEST keeps the most recent entries") {
+        auto shared = std::make_shared<RecordingAppender::Shared>();
+        AsyncLogger logger("drop-oldest", LogLevel::TRACE, 4, OverflowPolicy::DROP_OLDEST);
+        logger.addAppender(std::make_unique<RecordingAppender>(shared));
+        shared->holdFlush = true;
+        std::thread flusher([&logger]() { logger.flush(); });
+        waitUntil(shared->holding);
+
+        for (int i = 0; i < 10; ++i) {
+            logger.log(LogLevel::INFO, "burst", "", "", i);
+        }
+        REQUIRE(logger.getDroppedCount() == 6);
+
+        shared->holdFlush = false;
+        flusher.join();
+        logger.flush();
+        REQUIRE(shared->size() == 4);
+        REQUIRE(shared->entries.front().line == 6);
+        REQUIRE(shared->entries.back().line == 9);
+    }
+
+    SECTION("DROP_OLDEST does not block while the worker is writing out the next slot") {
+        auto shared = std::make_shared<RecordingAppender::Shared>();
+        AsyncLogger logger("drop-in-flight", LogLevel::TRACE, 4, OverflowPolicy::DROP_OLDEST);
+        logger.addAppender(std::make_unique<RecordingAppender>(shared));
+        shared->holdAppend = true;
+        logger.info("first");
+        waitUntil(shared->holding);
+
+        // The worker owns the first entry's slot, which is the one a full ring needs next
+        for (int i = 0; i < 10; ++i) {
+            logger.log(LogLevel::INFO, "burst", "", "", i);
+        }
+        REQUIRE(logger.getDroppedCount() == 7);
+
+        shared->holdAppend = false;
+        logger.flush();
+        REQUIRE(shared->size() == 4);
+        REQUIRE(shared->entries[0].message == "first");
+        REQUIRE(shared->entries[3].line == 2);
+    }
+
+    SECTION("BLOCK waits for room instead of dropping") {
+        auto shared = std::make_shared<RecordingAppender::Shared>();
+        AsyncLogger logger("block", LogLevel::TRACE, 4, OverflowPolicy::BLOCK);
+        logger.addAppender(std::make_unique<RecordingAppender>(shared));
+        shared->holdFlush = true;
+        std::thread flusher([&logger]() { logger.flush(); });
+        waitUntil(shared->holding);
+
+        std::atomic<int> logged{0};
+        std::thread producer([&logger, &logged]() {
+            for (int i = 0; i < 100; ++i) {
+                logger.log(LogLevel::INFO, "burst", "", "", i);
+                ++logged;
+            }
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        REQUIRE(logged.load() == 4);
+
+        shared->holdFlush = false;
+        flusher.join();
+        producer.join();
+        logger.flush();
+        REQUIRE(shared->size() == 100);
+        REQUIRE(logger.getDroppedCount() == 0);
+    }
+
+    SECTION("Deferred arguments are rendered only for appenders that read the message") {
+        auto raw = std::make_shared<RecordingAppender::Shared>();
+        {
+            AsyncLogger logger("raw-only", LogLevel::TRACE, 64, OverflowPolicy::BLOCK);
+            logger.addAppender(std::make_unique<RecordingAppender>(raw, false));
+            logger.logf(LogLevel::INFO, "deferred {} of {}", 1, 2);
+            logger.info("eager");
+            logger.flush();
+        }
+        REQUIRE(raw->size() == 2);
+        REQUIRE(raw->entries[0].message.empty());
+        REQUIRE(raw->entries[0].args.count() == 2);
+        REQUIRE(raw->entries[1].message == "eager");
+
+        // Registered after the raw appender, so that one still sees the entry unrendered
+        raw->entries.clear();
+        auto text = std::make_shared<RecordingAppender::Shared>();
+        {
+            AsyncLogger logger("mixed", LogLevel::TRACE, 64, OverflowPolicy::BLOCK);
+            logger.addAppender(std::make_unique<RecordingAppender>(raw, false));
+            logger.addAppender(std::make_unique<RecordingAppender>(text));
+            logger.logf(LogLevel::INFO, "deferred {} of {}", 1, 2);
+            logger.flush();
+        }
+        REQUIRE(raw->size() == 1);
+        REQUIRE(raw->entries[0].message.empty());
+        REQUIRE(text->size() == 1);
+        REQUIRE(text->entries[0].message == "deferred 1 of 2");
+    }
+
+    SECTION("Shutdown drains everything already logged and flushes the appenders") {
+        auto shared = std::make_shared<RecordingAppender::Shared>();
+        const int producers = 4;
+        const int perProducer = 10000;
+        {
+            AsyncLogger logger("shutdown", LogLevel::TRACE, 256, OverflowPolicy::BLOCK);
+            logger.addAppender(std::make_unique<RecordingAppender>(shared));
+
+            std::vector<std::thread> threads;
+            for (int p = 0; p < producers; ++p) {
+                threads.emplace_back([&logger]() {
+                    for (int i = 0; i < perProducer; ++i) {
+                        logger.logf(LogLevel::DEBUG, "entry {}", i);
+                    }
+                });
+            }
+            for (auto& thread : threads) thread.join();
+            logger.shutdown();
+
+            REQUIRE(shared->flushes.load() >= 1);
+            logger.info("after shutdown");
+        }
+
+        REQUIRE(shared->size() == static_cast<size_t>(producers * perProducer));
+        REQUIRE(shared->entries.back().message.rfind("entry ", 0) == 0);
+    }
+}
+
+TEST_CASE("Binary Log Format", "[logger][binary]") {
+
+    SECTION("Every argument type survives a write and read round trip") {
+        const std::string filename = "logger_binary_roundtrip.bin";
+        std::remove(filename.c_str());
+        int marker = 0;
+        const void* address = &marker;
+        char pointerText[32];
+        std::snprintf(pointerText, sizeof(pointerText), "%p", address);
+
+        {
+            BinaryLogAppender appender(filename);
+            LogEntry entry(LogLevel::WARN, "binary", "", "Nav.cpp", "plot", 42);
+            entry.format = "{} {} {} {} {} {} {} {} {{literal}}";
+            entry.args.append(int64_t{-9000000000});
+            entry.args.append(uint64_t{18000000000000000000u});
+            entry.args.append(0.25);
+            entry.args.append(true);
+            entry.args.append('x');
+            entry.args.append(std::string("orbit"));
+            entry.args.append(address);
+            entry.args.append(Thruster::BURN);
+            appender.append(entry);
+
+            LogEntry raw(LogLevel::ERROR, "binary", "plain text", "Nav.cpp", "plot", 43);
+            appender.append(raw);
+
+            LogEntry truncated(LogLevel::DEBUG, "binary", "", "Nav.cpp", "plot", 44);
+            truncated.format = "{}";
+            truncated.args.append(std::string(LogArgBuffer::capacity * 2, 'z'));
+            appender.append(truncated);
+            appender.flush();
+        }
+
+        BinaryLogReader reader(filename);
+        LogEntry entry;
+        REQUIRE(reader.next(entry));
+        REQUIRE(entry.level == LogLevel::WARN);
+        REQUIRE(entry.logger_name == "binary");
+        REQUIRE(entry.file == "Nav.cpp");
+        REQUIRE(entry.function == "plot");
+        REQUIRE(entry.line == 42);
+        REQUIRE(entry.message == "-9000000000 18000000000000000000 0.25 true x orbit " +
+                                 std::string(pointerText) + " 7 {literal}");
+
+        REQUIRE(reader.next(entry));
+        REQUIRE(entry.level == LogLevel::ERROR);
+        REQUIRE(entry.message == "plain text");
+
+        REQUIRE(reader.next(entry));
+        REQUIRE(entry.args.truncated());
+        REQUIRE(entry.message.size() < LogArgBuffer::capacity + 20);
+        REQUIRE(entry.message.rfind(" [truncated]") == entry.message.size() - 12);
+
+        REQUIRE_FALSE(reader.next(entry));
+        std::remove(filename.c_str());
+    }
+
+    SECTION("Truncated and corrupt records are rejected") {
+        const std::string filename = "logger_binary_corrupt.bin";
+        writeSingleArgumentLog(filename, 1234);
+        const std::vector<char> good = readFile(filename);
+        REQUIRE(readAll(filename));
+
+        // Cut short inside the argument block
+        writeFile(filename, std::vector<char>(good.begin(), good.end() - 3));
+        REQUIRE_THROWS_AS(readAll(filename), std::runtime_error);
+
+        // The argument block is the last 9 bytes: a type tag and an int64
+        std::vector<char> badTag = good;
+        badTag[badTag.size() - 9] = 0x7F;
+        writeFile(filename, badTag);
+        REQUIRE_THROWS_AS(readAll(filename), std::runtime_error);
+
+        // An argument count the block cannot hold
+        std::vector<char> badCount = good;
+        badCount[badCount.size() - 11] = 5;
+        writeFile(filename, badCount);
+        REQUIRE_THROWS_AS(readAll(filename), std::runtime_error);
+
+        // A string definition claiming far more bytes than the file has
+        std::vector<char> badLength(good.begin(), good.begin() + 8);
+        const char stringRecord[] = {'S', 0, 0, 0, 0, '\xFF', '\xFF', '\xFF', '\x7F', 'a'};
+        badLength.insert(badLength.end(), std::begin(stringRecord), std::end(stringRecord));
+        writeFile(filename, badLength);
+        REQUIRE_THROWS_AS(readAll(filename), std::runtime_error);
+
+        // A level past OFF; the entry record is the last 43 bytes and its level follows the tag and timestamp
+        std::vector<char> badLevel = good;
+        badLevel[badLevel.size() - 43 + 9] = 9;
+        writeFile(filename, badLevel);
+        REQUIRE_THROWS_AS(readAll(filename), std::runtime_error);
+
+        std::remove(filename.c_str());
+    }
+}
+
+TEST_CASE("Buffered Log File", "[logger][file]") {
+
+    SECTION("Writes out at the size threshold, after the interval, or when urgent") {
+        const std::string filename = "logger_buffered.log";
+        std::remove(filename.c_str());
+        {
+            BufferedLogFile file(16, std::chrono::milliseconds(50));
+            REQUIRE(file.open(filename));
+
+            file.buffer() += "short\n";
+            REQUIRE_FALSE(file.due());
+            file.buffer() += "long enough now\n";
+            REQUIRE(file.due());
+            file.writeIfDue();
+            REQUIRE(readFile(filename).size() == 22);
+            REQUIRE(file.size() == std::streampos(22));
+
+            file.buffer() += "idle\n";
+            REQUIRE_FALSE(file.due());
+            std::this_thread::sleep_for(std::chrono::milliseconds(60));
+            REQUIRE(file.due());
+            file.writeIfDue();
+            REQUIRE(readFile(filename).size() == 27);
+
+            file.buffer() += "alarm\n";
+            file.markUrgent();
+            REQUIRE(file.due());
+            file.writeIfDue();
+            REQUIRE_FALSE(file.due());
+            REQUIRE(readFile(filename).size() == 33);
+
+            file.buffer() += "tail\n";
+        }
+        REQUIRE(readFile(filename).size() == 38);
+        std::remove(filename.c_str());
+    }
+
+    SECTION("File appenders hold INFO entries in batches but write ERROR entries at once") {
+        const std::string filename = "logger_file_appender.log";
+        std::remove(filename.c_str());
+        FileAppender appender(filename, 0, 0, 64 * 1024, std::chrono::milliseconds(60000));
+
+        LogEntry info(LogLevel::INFO, "file", "routine status");
+        const LogEntry* quiet[] = {&info, &info};
+        appender.appendBatch(quiet, 2);
+        REQUIRE(readFile(filename).empty());
+
+        LogEntry error(LogLevel::ERROR, "file", "hull breach");
+        const LogEntry* batch[] = {&info, &error, &info};
+        appender.appendBatch(batch, 3);
+        const std::vector<char> bytes = readFile(filename);
+        const std::string written(bytes.begin(), bytes.end());
+        REQUIRE(written.find("hull breach") != std::string::npos);
+        REQUIRE(std::count(written.begin(), written.end(), '\n') == 5);
+
+        appender.appendBatch(quiet, 1);
+        REQUIRE(readFile(filename).size() == written.size());
+        appender.flush();
+        REQUIRE(readFile(filename).size() > written.size());
+        std::remove(filename.c_str());
+    }
+
+    SECTION("Direct appends are written at once with no worker to flush them later") {
+        const std::string filename = "logger_direct_append.log";
+        std::remove(filename.c_str());
+        {
+            FileAppender appender(filename, 0, 0, 64 * 1024, std::chrono::milliseconds(60000));
+            appender.append(LogEntry(LogLevel::INFO, "file", "last words"));
+            const std::vector<char> bytes = readFile(filename);
+            REQUIRE(std::string(bytes.begin(), bytes.end()).find("last words") != std::string::npos);
+        }
+        std::remove(filename.c_str());
+
+        // The rotating appender's file name carries the time it was opened
+        const std::string base = "logger_direct_rotating";
+        RotatingFileAppender rotating(base, std::chrono::hours(24), 64 * 1024, std::chrono::milliseconds(60000));
+        rotating.append(LogEntry(LogLevel::INFO, "file", "last words"));
+        std::vector<std::string> opened;
+        for (const auto& file : std::filesystem::directory_iterator(".")) {
+            if (file.path().filename().string().rfind(base + ".", 0) == 0) {
+                opened.push_back(file.path().string());
+            }
+        }
+        REQUIRE(opened.size() == 1);
+        const std::vector<char> rotated = readFile(opened[0]);
+        REQUIRE(std::string(rotated.begin(), rotated.end()).find("last words") != std::string::npos);
+        std::remove(opened[0].c_str());
+    }
+}